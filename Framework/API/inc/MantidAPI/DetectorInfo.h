@@ -7,6 +7,7 @@
 
 #include <boost/shared_ptr.hpp>
 
+#include <atomic>
 #include <mutex>
 #include <unordered_map>
 #include <vector>
@@ -30,6 +31,12 @@ class SpectrumInfo;
   DetectorInfo provides easy access to commonly used parameters of individual
   detectors, such as mask and monitor flags, L1, L2, and 2-theta.
 
+  The positions, rotations and mask and monitor flags of all detectors are
+  computed on first use and kept in flat arrays, so looking them up does not
+  go through the parameterized instrument. Positions and rotations are
+  computed again after a change of the ParameterMap, mask flags only after a
+  change of the mask.
+
   This class is thread safe with OpenMP BUT NOT WITH ANY OTHER THREADING LIBRARY
   such as Poco threads or Intel TBB.
 
@@ -84,8 +91,7 @@ public:
   double l1() const;
 
   const std::vector<detid_t> &detectorIDs() const;
-  /// Returns the index of the detector with the given detector ID.
-  size_t indexOf(const detid_t id) const { return m_detIDToIndex.at(id); }
+  size_t indexOf(const detid_t id) const;
 
   friend class SpectrumInfo;
 
@@ -93,22 +99,26 @@ private:
   const Geometry::IDetector &getDetector(const size_t index) const;
   boost::shared_ptr<const Geometry::IDetector>
   getDetectorPtr(const size_t index) const;
-  void setCachedDetector(
-      size_t index,
-      boost::shared_ptr<const Geometry::IDetector> detector) const;
-  const Geometry::IComponent &getSource() const;
-  const Geometry::IComponent &getSample() const;
 
   void cacheSource() const;
   void cacheSample() const;
+  void cacheGeometry() const;
+  void cacheMasks() const;
+  size_t parameterGeneration() const;
+  size_t maskGeneration() const;
+  void updateCachedGeometry(const size_t index, const bool wasCached);
 
   // These cache init functions are not thread-safe! Use only in combination
   // with std::call_once!
   void doCacheSource() const;
   void doCacheSample() const;
   void cacheL1() const;
+  void doCacheGeometry() const;
+  void doCacheMasks() const;
 
   Geometry::ParameterMap *m_pmap;
+  /// The map of the parameterized instrument, null if it is not parameterized
+  const Geometry::ParameterMap *m_parameters{nullptr};
   boost::shared_ptr<const Geometry::Instrument> m_instrument;
   std::vector<detid_t> m_detectorIDs;
   std::unordered_map<detid_t, size_t> m_detIDToIndex;
@@ -125,6 +135,17 @@ private:
   mutable std::once_flag m_sampleCached;
   mutable std::once_flag m_L1Cached;
 
+  // Geometry of all detectors, valid while m_geometryGeneration is equal to
+  // parameterGeneration().
+  mutable std::vector<Kernel::V3D> m_positions;
+  mutable std::vector<Kernel::Quat> m_rotations;
+  mutable std::vector<char> m_isMonitor;
+  mutable std::atomic<size_t> m_geometryGeneration{0};
+  // Mask flags, valid while m_maskGeneration is equal to maskGeneration().
+  mutable std::vector<char> m_isMasked;
+  mutable std::atomic<size_t> m_maskGeneration{0};
+  mutable std::mutex m_geometryMutex;
+
   mutable std::vector<boost::shared_ptr<const Geometry::IDetector>>
       m_lastDetector;
   mutable std::vector<size_t> m_lastIndex;
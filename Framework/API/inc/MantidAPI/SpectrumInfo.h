@@ -6,6 +6,7 @@
 
 #include <boost/shared_ptr.hpp>
 
+#include <set>
 #include <vector>
 
 namespace Mantid {
@@ -85,8 +86,7 @@ public:
 
 private:
   const Geometry::IDetector &getDetector(const size_t index) const;
-  std::vector<boost::shared_ptr<const Geometry::IDetector>>
-  getDetectorVector(const size_t index) const;
+  const std::set<detid_t> &getDetectorIDs(const size_t index) const;
 
   const MatrixWorkspace &m_workspace;
   DetectorInfo *m_mutableDetectorInfo{nullptr};
@@ -99,6 +99,8 @@ struct MANTID_API_DLL WorkspaceHelpers {
                            const bool firstOnly = false);
   // Checks whether a the X vectors in a workspace are actually the same vector
   static bool sharedXData(const MatrixWorkspace_const_sptr WS);
+  // Makes spectra with identical X values share one X vector
+  static size_t shareIdenticalX(MatrixWorkspace_sptr workspace);
   // Divides the data in a workspace by the bin width to make it a distribution
   // (or the reverse)
   static void makeDistribution(MatrixWorkspace_sptr workspace,
@@ -30,16 +30,23 @@ DetectorInfo::DetectorInfo(
   m_detectorIDs = instrument->getDetectorIDs(false /* do not skip monitors */);
   for (size_t i = 0; i < m_detectorIDs.size(); ++i)
     m_detIDToIndex[m_detectorIDs[i]] = i;
+
+  if (m_pmap)
+    m_parameters = m_pmap;
+  else if (m_instrument->isParametrized())
+    m_parameters = m_instrument->getParameterMap().get();
 }
 
 /// Returns true if the detector is a monitor.
 bool DetectorInfo::isMonitor(const size_t index) const {
-  return getDetector(index).isMonitor();
+  cacheGeometry();
+  return m_isMonitor[index] != 0;
 }
 
 /// Returns true if the detector is a masked.
 bool DetectorInfo::isMasked(const size_t index) const {
-  return getDetector(index).isMasked();
+  cacheMasks();
+  return m_isMasked[index] != 0;
 }
 
 /** Returns L2 (distance from sample to spectrum).
@@ -49,9 +56,9 @@ bool DetectorInfo::isMasked(const size_t index) const {
  */
 double DetectorInfo::l2(const size_t index) const {
   if (!isMonitor(index))
-    return getDetector(index).getDistance(getSample());
+    return m_positions[index].distance(samplePosition());
   else
-    return getDetector(index).getDistance(getSource()) - l1();
+    return m_positions[index].distance(sourcePosition()) - l1();
 }
 
 /// Returns 2 theta (scattering angle w.r.t. to beam direction).
@@ -64,7 +71,8 @@ double DetectorInfo::twoTheta(const size_t index) const {
         "Source and sample are at same position!");
   }
 
-  return getDetector(index).getTwoTheta(samplePos, beamLine);
+  cacheGeometry();
+  return (m_positions[index] - samplePos).angle(beamLine);
 }
 
 /// Returns signed 2 theta (signed scattering angle w.r.t. to beam direction).
@@ -79,36 +87,49 @@ double DetectorInfo::signedTwoTheta(const size_t index) const {
   // Get the instrument up axis.
   const Kernel::V3D &instrumentUpAxis =
       m_instrument->getReferenceFrame()->vecPointingUp();
-  return getDetector(index)
-      .getSignedTwoTheta(samplePos, beamLine, instrumentUpAxis);
+  cacheGeometry();
+  const Kernel::V3D sampleDetVec = m_positions[index] - samplePos;
+  double angle = sampleDetVec.angle(beamLine);
+
+  const Kernel::V3D cross = beamLine.cross_prod(sampleDetVec);
+  const Kernel::V3D normToSurface = beamLine.cross_prod(instrumentUpAxis);
+  if (normToSurface.scalar_prod(cross) < 0)
+    angle *= -1;
+  return angle;
 }
 
 /// Returns the position of the detector with given index.
 Kernel::V3D DetectorInfo::position(const size_t index) const {
-  return getDetector(index).getPos();
+  cacheGeometry();
+  return m_positions[index];
 }
 
 /// Returns the rotation of the detector with given index.
 Kernel::Quat DetectorInfo::rotation(const size_t index) const {
-  return getDetector(index).getRotation();
+  cacheGeometry();
+  return m_rotations[index];
 }
 
 /// Set the absolute position of the detector with given index.
 void DetectorInfo::setPosition(const size_t index,
                                const Kernel::V3D &position) {
+  const bool wasCached = m_geometryGeneration == parameterGeneration();
   const auto &det = getDetector(index);
   using namespace Geometry::ComponentHelper;
   TransformType positionType = Absolute;
   moveComponent(det, *m_pmap, position, positionType);
+  updateCachedGeometry(index, wasCached);
 }
 
 /// Set the absolute rotation of the detector with given index.
 void DetectorInfo::setRotation(const size_t index,
                                const Kernel::Quat &rotation) {
+  const bool wasCached = m_geometryGeneration == parameterGeneration();
   const auto &det = getDetector(index);
   using namespace Geometry::ComponentHelper;
   TransformType rotationType = Absolute;
   rotateComponent(det, *m_pmap, rotation, rotationType);
+  updateCachedGeometry(index, wasCached);
 }
 
 /** Set the absolute position of the component `comp`.
@@ -117,21 +138,22 @@ void DetectorInfo::setRotation(const size_t index,
  * typically still influence detector positions. */
 void DetectorInfo::setPosition(const Geometry::IComponent &comp,
                                const Kernel::V3D &pos) {
+  const bool wasCached = m_geometryGeneration == parameterGeneration();
   using namespace Geometry::ComponentHelper;
   TransformType positionType = Absolute;
   moveComponent(comp, *m_pmap, pos, positionType);
 
-  if (!dynamic_cast<const Geometry::Detector *>(&comp)) {
-    // If comp is a detector cached positions stay valid. In all other cases
-    // (higher level in instrument tree, or other leaf component such as sample
-    // or source) we flush all cached positions.
+  if (const auto det = dynamic_cast<const Geometry::Detector *>(&comp)) {
+    // If comp is a detector only its own cached position changes.
+    updateCachedGeometry(indexOf(det->getID()), wasCached);
+  } else {
+    // In all other cases (higher level in instrument tree, or other leaf
+    // component such as sample or source) we flush all cached positions. The
+    // change of the ParameterMap has already invalidated detector positions.
     if (m_source)
       m_sourcePos = m_source->getPos();
     if (m_sample)
       m_samplePos = m_sample->getPos();
-    // Detector positions are currently not cached, the cached pointers to
-    // detectors stay valid. Once we store positions in DetectorInfo we need to
-    // update detector positions here.
   }
 }
 
@@ -141,21 +163,23 @@ void DetectorInfo::setPosition(const Geometry::IComponent &comp,
  * typically still influence detector positions rotations. */
 void DetectorInfo::setRotation(const Geometry::IComponent &comp,
                                const Kernel::Quat &rot) {
+  const bool wasCached = m_geometryGeneration == parameterGeneration();
   using namespace Geometry::ComponentHelper;
   TransformType rotationType = Absolute;
   rotateComponent(comp, *m_pmap, rot, rotationType);
 
-  if (!dynamic_cast<const Geometry::Detector *>(&comp)) {
-    // If comp is a detector cached positions and rotations stay valid. In all
-    // other cases/ (higher level in instrument tree, or other leaf component
-    // such as sample or source) we flush all cached positions and rotations.
+  if (const auto det = dynamic_cast<const Geometry::Detector *>(&comp)) {
+    // If comp is a detector only its own cached rotation changes.
+    updateCachedGeometry(indexOf(det->getID()), wasCached);
+  } else {
+    // In all other cases (higher level in instrument tree, or other leaf
+    // component such as sample or source) we flush all cached positions and
+    // rotations. The change of the ParameterMap has already invalidated
+    // detector positions and rotations.
     if (m_source)
       m_sourcePos = m_source->getPos();
     if (m_sample)
       m_samplePos = m_sample->getPos();
-    // Detector positions and rotations are currently not cached, the cached
-    // pointers to detectors stay valid. Once we store positions and rotations
-    // in DetectorInfo we need to update detector positions and rotations here.
   }
 }
 
@@ -184,6 +208,15 @@ const std::vector<detid_t> &DetectorInfo::detectorIDs() const {
   return m_detectorIDs;
 }
 
+/** Returns the index of the detector with the given detector ID.
+ * @throws Kernel::Exception::NotFoundError if there is no such detector. */
+size_t DetectorInfo::indexOf(const detid_t id) const {
+  const auto it = m_detIDToIndex.find(id);
+  if (it == m_detIDToIndex.end())
+    throw Kernel::Exception::NotFoundError("DetectorInfo: detector ID", id);
+  return it->second;
+}
+
 const Geometry::IDetector &DetectorInfo::getDetector(const size_t index) const {
   size_t thread = static_cast<size_t>(PARALLEL_THREAD_NUMBER);
   if (m_lastIndex[thread] != index) {
@@ -202,26 +235,59 @@ DetectorInfo::getDetectorPtr(const size_t index) const {
   return m_lastDetector[thread];
 }
 
-/// Sets the cached detector. This is an optimization used by SpectrumInfo.
-void DetectorInfo::setCachedDetector(
-    size_t index, boost::shared_ptr<const Geometry::IDetector> detector) const {
-  size_t thread = static_cast<size_t>(PARALLEL_THREAD_NUMBER);
-  m_lastIndex[thread] = index;
-  m_lastDetector[thread] = detector;
+/// Computes the geometry of all detectors unless it is already up to date.
+void DetectorInfo::cacheGeometry() const {
+  const size_t generation = parameterGeneration();
+  if (m_geometryGeneration == generation)
+    return;
+  std::lock_guard<std::mutex> lock(m_geometryMutex);
+  if (m_geometryGeneration == generation)
+    return;
+  doCacheGeometry();
+  m_geometryGeneration = generation;
 }
 
-/// Returns a reference to the source component. The value is cached, so calling
-/// it repeatedly is cheap.
-const Geometry::IComponent &DetectorInfo::getSource() const {
-  cacheSource();
-  return *m_source;
+/// Computes the mask flags of all detectors unless they are already up to
+/// date.
+void DetectorInfo::cacheMasks() const {
+  const size_t generation = maskGeneration();
+  if (m_maskGeneration == generation)
+    return;
+  std::lock_guard<std::mutex> lock(m_geometryMutex);
+  if (m_maskGeneration == generation)
+    return;
+  doCacheMasks();
+  m_maskGeneration = generation;
 }
 
-/// Returns a reference to the sample component. The value is cached, so calling
-/// it repeatedly is cheap.
-const Geometry::IComponent &DetectorInfo::getSample() const {
-  cacheSample();
-  return *m_sample;
+/// Returns the generation of the ParameterMap, offset by 1 so that 0 means
+/// that the geometry was never computed.
+size_t DetectorInfo::parameterGeneration() const {
+  return m_parameters ? m_parameters->generation() + 1 : 1;
+}
+
+/// Returns the mask generation of the ParameterMap, offset by 1 so that 0
+/// means that the mask flags were never computed.
+size_t DetectorInfo::maskGeneration() const {
+  return m_parameters ? m_parameters->maskGeneration() + 1 : 1;
+}
+
+/** Updates the cached geometry of a detector after it was moved or rotated.
+ *
+ * Moving a detector changes the ParameterMap and therefore invalidates the
+ * geometry of all detectors. If it was valid before the change, only the
+ * geometry of this detector needs to be updated instead of all of it.
+ * @param index :: index of the detector
+ * @param wasCached :: true if the geometry was valid before the change
+ */
+void DetectorInfo::updateCachedGeometry(const size_t index,
+                                        const bool wasCached) {
+  if (!wasCached)
+    return;
+  const auto &det = getDetector(index);
+  m_positions[index] = det.getPos();
+  m_rotations[index] = det.getRotation();
+  m_geometryGeneration = parameterGeneration();
 }
 
 void DetectorInfo::cacheSource() const {
@@ -260,5 +326,29 @@ void DetectorInfo::doCacheSample() const {
 
 void DetectorInfo::cacheL1() const { m_L1 = m_source->getDistance(*m_sample); }
 
+void DetectorInfo::doCacheGeometry() const {
+  const size_t numDetectors = m_detectorIDs.size();
+  m_positions.resize(numDetectors);
+  m_rotations.resize(numDetectors);
+  m_isMonitor.resize(numDetectors);
+
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < static_cast<int64_t>(numDetectors); ++i) {
+    const auto det = m_instrument->getDetector(m_detectorIDs[i]);
+    m_positions[i] = det->getPos();
+    m_rotations[i] = det->getRotation();
+    m_isMonitor[i] = det->isMonitor();
+  }
+}
+
+void DetectorInfo::doCacheMasks() const {
+  const size_t numDetectors = m_detectorIDs.size();
+  m_isMasked.resize(numDetectors);
+
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < static_cast<int64_t>(numDetectors); ++i)
+    m_isMasked[i] = m_instrument->getDetector(m_detectorIDs[i])->isMasked();
+}
+
 } // namespace API
 } // namespace Mantid
@@ -19,6 +19,7 @@
 #include <cmath>
 
 #include <numeric>
+#include <unordered_set>
 
 using Mantid::Kernel::DateAndTime;
 using Mantid::Kernel::TimeSeriesProperty;
@@ -1061,12 +1062,12 @@ size_t MatrixWorkspace::getMemorySize() const {
 */
 size_t MatrixWorkspace::getMemorySizeForXAxes() const {
   size_t total = 0;
-  auto lastX = this->refX(0);
+  // Count X vectors shared by several spectra once
+  std::unordered_set<const HistogramData::HistogramX *> counted;
   for (size_t wi = 0; wi < getNumberHistograms(); wi++) {
-    auto X = this->refX(wi);
-    // If the pointers are the same
-    if (!(X == lastX) || wi == 0)
-      total += (*X).size() * sizeof(double);
+    const auto &X = this->x(wi);
+    if (counted.insert(&X).second)
+      total += X.size() * sizeof(double);
   }
   return total;
 }
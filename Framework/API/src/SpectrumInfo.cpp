@@ -26,12 +26,18 @@ SpectrumInfo::~SpectrumInfo() = default;
 
 /// Returns true if the detector(s) associated with the spectrum are monitors.
 bool SpectrumInfo::isMonitor(const size_t index) const {
-  return getDetector(index).isMonitor();
+  for (const auto &id : getDetectorIDs(index))
+    if (!m_detectorInfo.isMonitor(m_detectorInfo.indexOf(id)))
+      return false;
+  return true;
 }
 
 /// Returns true if the detector(s) associated with the spectrum are masked.
 bool SpectrumInfo::isMasked(const size_t index) const {
-  return getDetector(index).isMasked();
+  for (const auto &id : getDetectorIDs(index))
+    if (!m_detectorInfo.isMasked(m_detectorInfo.indexOf(id)))
+      return false;
+  return true;
 }
 
 /** Returns L2 (distance from sample to spectrum).
@@ -41,12 +47,9 @@ bool SpectrumInfo::isMasked(const size_t index) const {
  */
 double SpectrumInfo::l2(const size_t index) const {
   double l2{0.0};
-  const auto &dets = getDetectorVector(index);
-  for (const auto &det : dets) {
-    const auto &detIndex = m_detectorInfo.indexOf(det->getID());
-    m_detectorInfo.setCachedDetector(detIndex, det);
-    l2 += m_detectorInfo.l2(detIndex);
-  }
+  const auto &dets = getDetectorIDs(index);
+  for (const auto &id : dets)
+    l2 += m_detectorInfo.l2(m_detectorInfo.indexOf(id));
   return l2 / static_cast<double>(dets.size());
 }
 
@@ -60,12 +63,9 @@ double SpectrumInfo::twoTheta(const size_t index) const {
         "Two theta (scattering angle) is not defined for monitors.");
 
   double twoTheta{0.0};
-  const auto &dets = getDetectorVector(index);
-  for (const auto &det : dets) {
-    const auto &detIndex = m_detectorInfo.indexOf(det->getID());
-    m_detectorInfo.setCachedDetector(detIndex, det);
-    twoTheta += m_detectorInfo.twoTheta(detIndex);
-  }
+  const auto &dets = getDetectorIDs(index);
+  for (const auto &id : dets)
+    twoTheta += m_detectorInfo.twoTheta(m_detectorInfo.indexOf(id));
   return twoTheta / static_cast<double>(dets.size());
 }
 
@@ -80,24 +80,18 @@ double SpectrumInfo::signedTwoTheta(const size_t index) const {
         "Two theta (scattering angle) is not defined for monitors.");
 
   double signedTwoTheta{0.0};
-  const auto &dets = getDetectorVector(index);
-  for (const auto &det : dets) {
-    const auto &detIndex = m_detectorInfo.indexOf(det->getID());
-    m_detectorInfo.setCachedDetector(detIndex, det);
-    signedTwoTheta += m_detectorInfo.signedTwoTheta(detIndex);
-  }
+  const auto &dets = getDetectorIDs(index);
+  for (const auto &id : dets)
+    signedTwoTheta += m_detectorInfo.signedTwoTheta(m_detectorInfo.indexOf(id));
   return signedTwoTheta / static_cast<double>(dets.size());
 }
 
 /// Returns the position of the spectrum with given index.
 Kernel::V3D SpectrumInfo::position(const size_t index) const {
   Kernel::V3D newPos;
-  const auto &dets = getDetectorVector(index);
-  for (const auto &det : dets) {
-    const auto &detIndex = m_detectorInfo.indexOf(det->getID());
-    m_detectorInfo.setCachedDetector(detIndex, det);
-    newPos += m_detectorInfo.position(detIndex);
-  }
+  const auto &dets = getDetectorIDs(index);
+  for (const auto &id : dets)
+    newPos += m_detectorInfo.position(m_detectorInfo.indexOf(id));
   return newPos / static_cast<double>(dets.size());
 }
 
@@ -186,17 +180,18 @@ const Geometry::IDetector &SpectrumInfo::getDetector(const size_t index) const {
   return *m_lastDetector[thread];
 }
 
-std::vector<Geometry::IDetector_const_sptr>
-SpectrumInfo::getDetectorVector(const size_t index) const {
-  const auto &det = getDetector(index);
-  const auto &ndet = det.nDets();
-  if (ndet > 1) {
-    const auto group = dynamic_cast<const Geometry::DetectorGroup *>(&det);
-    return group->getDetectors();
-  } else {
-    size_t thread = static_cast<size_t>(PARALLEL_THREAD_NUMBER);
-    return {m_lastDetector[thread]};
-  }
+/** Returns the IDs of the detectors of the spectrum with given index.
+ *
+ * Throws if there are none, as getDetector() does. */
+const std::set<detid_t> &
+SpectrumInfo::getDetectorIDs(const size_t index) const {
+  const auto &dets = m_workspace.getSpectrum(index).getDetectorIDs();
+  if (dets.empty())
+    throw Kernel::Exception::NotFoundError("MatrixWorkspace::getDetector(): No "
+                                           "detectors for this workspace "
+                                           "index.",
+                                           "");
+  return dets;
 }
 
 } // namespace API
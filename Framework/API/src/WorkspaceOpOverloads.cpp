@@ -14,7 +14,10 @@
 #include "MantidAPI/IMDHistoWorkspace.h"
 #include "MantidAPI/WorkspaceGroup_fwd.h"
 
+#include <boost/functional/hash.hpp>
+
 #include <numeric>
+#include <unordered_map>
 
 namespace Mantid {
 namespace API {
@@ -527,6 +530,49 @@ bool WorkspaceHelpers::sharedXData(const MatrixWorkspace_const_sptr WS) {
   return true;
 }
 
+/** Makes the spectra of a workspace that have identical X values share one X
+ * vector, freeing the copies. Algorithms that compute the X values of each
+ * spectrum separately end up with one vector per spectrum even when they are
+ * all the same.
+ *  @param workspace :: The workspace to modify
+ *  @return The number of spectra that were given the X vector of another one
+ */
+size_t WorkspaceHelpers::shareIdenticalX(MatrixWorkspace_sptr workspace) {
+  const size_t numHist = workspace->getNumberHistograms();
+  // The first spectrum with each distinct X vector, by hash of the values
+  std::unordered_multimap<size_t, size_t> distinct;
+  size_t numShared = 0;
+  for (size_t i = 0; i < numHist; ++i) {
+    const auto &x = workspace->x(i);
+    // Usually a spectrum has the same X values as the one before
+    if (i > 0) {
+      const auto &previous = workspace->x(i - 1);
+      if (&x == &previous)
+        continue;
+      if (x.rawData() == previous.rawData()) {
+        workspace->setSharedX(i, workspace->sharedX(i - 1));
+        ++numShared;
+        continue;
+      }
+    }
+    const size_t hash = boost::hash_range(x.cbegin(), x.cend());
+    const auto candidates = distinct.equal_range(hash);
+    auto match = std::find_if(candidates.first, candidates.second,
+                              [&](const std::pair<const size_t, size_t> &c) {
+                                const auto &other = workspace->x(c.second);
+                                return &other == &x ||
+                                       other.rawData() == x.rawData();
+                              });
+    if (match == candidates.second) {
+      distinct.emplace(hash, i);
+    } else if (&workspace->x(match->second) != &x) {
+      workspace->setSharedX(i, workspace->sharedX(match->second));
+      ++numShared;
+    }
+  }
+  return numShared;
+}
+
 /** Divides the data in a workspace by the bin width to make it a distribution.
  *  Can also reverse this operation (i.e. multiply by the bin width).
  *  Sets the isDistribution() flag accordingly.
@@ -5,6 +5,7 @@
 
 #include "MantidAPI/DetectorInfo.h"
 #include "MantidAPI/WorkspaceFactory.h"
+#include "MantidGeometry/Instrument/ComponentHelper.h"
 #include "MantidTestHelpers/FakeObjects.h"
 #include "MantidTestHelpers/InstrumentCreationHelper.h"
 
@@ -266,6 +267,32 @@ public:
     detInfo.setRotation(*root, oldRot);
   }
 
+  void test_cached_geometry_follows_changes_of_the_parameter_map() {
+    auto &pmap = m_workspace.instrumentParameters();
+    const auto instrument = m_workspace.getInstrument();
+    DetectorInfo info(instrument, &pmap);
+    TS_ASSERT_EQUALS(info.position(0), V3D(0.0, -0.1, 5.0));
+    TS_ASSERT_DELTA(info.l2(0), 5.0009999, 1e-6);
+    TS_ASSERT_EQUALS(info.isMasked(0), true);
+
+    // Change the map directly, not through DetectorInfo
+    const auto root = instrument->getComponentByName("SimpleFakeInstrument");
+    const auto det = instrument->getDetector(info.detectorIDs()[0]);
+    using namespace ComponentHelper;
+    moveComponent(*root, pmap, V3D(1.0, 0.0, 0.0), Relative);
+    pmap.addBool(det.get(), "masked", false);
+
+    TS_ASSERT_EQUALS(info.position(0), V3D(1.0, -0.1, 5.0));
+    TS_ASSERT_EQUALS(info.isMasked(0), false);
+    TS_ASSERT_EQUALS(info.isMasked(3), true);
+
+    // Restore old state
+    moveComponent(*root, pmap, V3D(-1.0, 0.0, 0.0), Relative);
+    pmap.addBool(det.get(), "masked", true);
+    TS_ASSERT_EQUALS(info.position(0), V3D(0.0, -0.1, 5.0));
+    TS_ASSERT_EQUALS(info.isMasked(0), true);
+  }
+
   void test_detectorIDs() {
     WorkspaceTester workspace;
     int32_t numberOfHistograms = 5;
@@ -293,6 +320,19 @@ public:
     TS_ASSERT_EQUALS(ids, sorted_ids);
   }
 
+  void test_indexOf() {
+    const auto &info = m_workspace.detectorInfo();
+    const auto &ids = info.detectorIDs();
+    for (size_t i = 0; i < ids.size(); ++i)
+      TS_ASSERT_EQUALS(info.indexOf(ids[i]), i);
+  }
+
+  void test_indexOf_unknown_id_throws_NotFoundError() {
+    const auto &info = m_workspace.detectorInfo();
+    TS_ASSERT_THROWS(info.indexOf(-17),
+                     Mantid::Kernel::Exception::NotFoundError);
+  }
+
 private:
   WorkspaceTester m_workspace;
   WorkspaceTester m_workspaceNoInstrument;
@@ -288,6 +288,17 @@ public:
     m_workspace.getSpectrum(1).setDetectorID(2);
   }
 
+  void test_bad_IDs_throw_NotFoundError() {
+    const auto &spectrumInfo = m_workspace.spectrumInfo();
+    m_workspace.getSpectrum(1).setDetectorID(0);
+    TS_ASSERT_THROWS(spectrumInfo.l2(1),
+                     Mantid::Kernel::Exception::NotFoundError);
+    TS_ASSERT_THROWS(spectrumInfo.twoTheta(1),
+                     Mantid::Kernel::Exception::NotFoundError);
+    // Restore old value
+    m_workspace.getSpectrum(1).setDetectorID(2);
+  }
+
   void test_hasUniqueDetector() {
     const auto &spectrumInfo = m_workspace.spectrumInfo();
     TS_ASSERT(spectrumInfo.hasUniqueDetector(0));
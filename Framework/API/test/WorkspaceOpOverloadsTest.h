@@ -148,6 +148,27 @@ public:
     TS_ASSERT(WorkspaceHelpers::sharedXData(ws));
   }
 
+  void test_shareIdenticalX() {
+    auto ws = boost::make_shared<WorkspaceTester>();
+    ws->init(5, 3, 2);
+    ws->dataX(2)[1] = 7.0;
+    ws->dataX(4)[1] = 7.0;
+    // Spectra 1 and 3 get the X of spectrum 0, spectrum 4 that of spectrum 2
+    TS_ASSERT_EQUALS(WorkspaceHelpers::shareIdenticalX(ws), 3);
+    TS_ASSERT_EQUALS(&ws->x(1), &ws->x(0));
+    TS_ASSERT_EQUALS(&ws->x(3), &ws->x(0));
+    TS_ASSERT_EQUALS(&ws->x(4), &ws->x(2));
+    TS_ASSERT_DIFFERS(&ws->x(2), &ws->x(0));
+    TS_ASSERT_EQUALS(ws->x(4)[1], 7.0);
+    TS_ASSERT_EQUALS(ws->x(3)[1], 1.0);
+    // Nothing is left to share
+    TS_ASSERT_EQUALS(WorkspaceHelpers::shareIdenticalX(ws), 0);
+    // Changing a shared X vector only changes that spectrum
+    ws->dataX(3)[1] = 2.0;
+    TS_ASSERT_EQUALS(ws->x(0)[1], 1.0);
+    TS_ASSERT_EQUALS(ws->x(1)[1], 1.0);
+  }
+
   void test_makeDistribution() {
     // N.B. This is also tested in the tests for the
     // Convert[To/From]Distribution algorithms.
@@ -107,14 +107,12 @@ protected:
   checkSizeCompatibility(const API::MatrixWorkspace_const_sptr lhs,
                          const API::MatrixWorkspace_const_sptr rhs) const;
 
-  /// Checks if the spectra at the given index of either input workspace is
-  /// masked. If so then the output spectra has zeroed data
-  /// and is also masked. The function returns true if further processing is not
-  /// required on the spectra.
-  virtual bool propagateSpectraMask(const API::MatrixWorkspace_const_sptr lhs,
-                                    const API::MatrixWorkspace_const_sptr rhs,
-                                    const int64_t index,
-                                    API::MatrixWorkspace_sptr out);
+  /// Checks which spectra of either input workspace are masked. The
+  /// operation is not performed on those and the output spectra are masked
+  /// instead, with zeroed data.
+  virtual std::vector<char>
+  findMaskedSpectra(const API::MatrixWorkspace &lhs,
+                    const API::MatrixWorkspace &rhs);
 
   /** Carries out the binary operation on a single spectrum, with another
    *spectrum as the right-hand operand.
@@ -89,6 +89,9 @@ private:
 
   void createOutputWorkspaces();
 
+  /// Convert the splitters to boundaries for splitting in one pass
+  void flattenSplitters();
+
   /// Set up detector calibration parameters
   void setupDetectorTOFCalibration();
 
@@ -151,6 +154,12 @@ private:
   /// Flag to group workspace
   bool m_toGroupWS;
 
+  /// Boundaries of the table splitters in nanoseconds
+  std::vector<int64_t> m_splitTimes;
+  /// Position in m_outputWS of the output before, between and after each of
+  /// m_splitTimes
+  std::vector<size_t> m_splitTargets;
+
   /// Vector for splitting time
   std::vector<int64_t> m_vecSplitterTime;
   /// Vector for splitting grouip
@@ -1,5 +1,6 @@
 #include "MantidAlgorithms/BinaryOperation.h"
 #include "MantidAPI/FrameworkManager.h"
+#include "MantidAPI/SpectrumInfo.h"
 #include "MantidAPI/Axis.h"
 #include "MantidAPI/WorkspaceFactory.h"
 #include "MantidAPI/WorkspaceProperty.h"
@@ -9,6 +10,7 @@
 #include "MantidDataObjects/WorkspaceSingleValue.h"
 #include "MantidGeometry/IDetector.h"
 #include "MantidGeometry/Instrument/ParameterMap.h"
+#include "MantidKernel/Exception.h"
 #include "MantidKernel/Timer.h"
 
 #include <boost/make_shared.hpp>
@@ -21,6 +23,23 @@ using std::size_t;
 
 namespace Mantid {
 namespace Algorithms {
+namespace {
+/**
+ * Returns true if the spectrum has detectors and all of them are masked. A
+ * spectrum that also lists detector IDs missing from the instrument counts as
+ * unmasked.
+ * @param spectrumInfo :: The SpectrumInfo of the workspace
+ * @param index :: The workspace index to check
+ */
+bool isMaskedSpectrum(const SpectrumInfo &spectrumInfo, const size_t index) {
+  try {
+    return spectrumInfo.hasDetectors(index) && spectrumInfo.isMasked(index);
+  } catch (Exception::NotFoundError &) {
+    return false;
+  }
+}
+} // namespace
+
 BinaryOperation::BinaryOperation()
     : API::Algorithm(), m_lhs(), m_elhs(), m_rhs(), m_erhs(), m_out(), m_eout(),
       m_AllowDifferentNumberSpectra(false), m_ClearRHSWorkspace(false),
@@ -429,36 +448,30 @@ std::string BinaryOperation::checkSizeCompatibility(
 }
 
 /**
- * Checks if the spectra at the given index of either input workspace is masked.
- * If so then the output spectra has zeroed data
- * and is also masked.
- * @param lhs :: A pointer to the left-hand operand
- * @param rhs :: A pointer to the right-hand operand
- * @param index :: The workspace index to check
- * @param out :: A pointer to the output workspace
- * @returns True if further processing is not required on the spectra, false if
- * the binary operation should be performed.
+ * Checks which spectra of either input workspace are masked, looking at all
+ * spectra in one pass before any output is written. The operation is not
+ * performed on masked spectra, and the corresponding output spectra are
+ * zeroed and masked instead.
+ * @param lhs :: The left-hand operand
+ * @param rhs :: The right-hand operand, with as many spectra as lhs
+ * @returns A flag for each spectrum, non-zero if it is masked in either input
  */
-bool BinaryOperation::propagateSpectraMask(
-    const API::MatrixWorkspace_const_sptr lhs,
-    const API::MatrixWorkspace_const_sptr rhs, const int64_t index,
-    API::MatrixWorkspace_sptr out) {
-  bool continueOp(true);
-  IDetector_const_sptr det_lhs, det_rhs;
-  try {
-    det_lhs = lhs->getDetector(index);
-    det_rhs = rhs->getDetector(index);
-  } catch (std::runtime_error &) {
-  } catch (std::domain_error &) {
-    // try statement will throw a domain_error when the axis is not a spectra
-    // axis.
-    return continueOp;
-  }
-  if ((det_lhs && det_lhs->isMasked()) || (det_rhs && det_rhs->isMasked())) {
-    continueOp = false;
-    out->maskWorkspaceIndex(index);
+std::vector<char>
+BinaryOperation::findMaskedSpectra(const API::MatrixWorkspace &lhs,
+                                   const API::MatrixWorkspace &rhs) {
+  const auto &lhsSpectrumInfo = lhs.spectrumInfo();
+  const auto &rhsSpectrumInfo = rhs.spectrumInfo();
+  const int64_t numHists = lhs.getNumberHistograms();
+  std::vector<char> masked(numHists, 0);
+  PARALLEL_FOR_IF(Kernel::threadSafe(lhs, rhs))
+  for (int64_t i = 0; i < numHists; ++i) {
+    PARALLEL_START_INTERUPT_REGION
+    masked[i] = isMaskedSpectrum(lhsSpectrumInfo, i) ||
+                isMaskedSpectrum(rhsSpectrumInfo, i);
+    PARALLEL_END_INTERUPT_REGION
   }
-  return continueOp;
+  PARALLEL_CHECK_INTERUPT_REGION
+  return masked;
 }
 
 /**
@@ -522,6 +535,7 @@ void BinaryOperation::doSingleColumn() {
   // value from each m_rhs 'spectrum'
   // and then calling the virtual function
   const int64_t numHists = m_lhs->getNumberHistograms();
+  const auto masked = findMaskedSpectra(*m_lhs, *m_rhs);
   if (m_eout) {
     // ---- The output is an EventWorkspace ------
     PARALLEL_FOR_IF(Kernel::threadSafe(*m_lhs, *m_rhs, *m_out))
@@ -531,7 +545,9 @@ void BinaryOperation::doSingleColumn() {
       const double rhsE = m_rhs->readE(i)[0];
 
       // m_out->setX(i, m_lhs->refX(i)); //unnecessary - that was copied before.
-      if (propagateSpectraMask(m_lhs, m_rhs, i, m_out)) {
+      if (masked[i]) {
+        m_out->maskWorkspaceIndex(i);
+      } else {
         performEventBinaryOperation(m_eout->getSpectrum(i), rhsY, rhsE);
       }
       m_progress->report(this->name());
@@ -547,7 +563,9 @@ void BinaryOperation::doSingleColumn() {
       const double rhsE = m_rhs->readE(i)[0];
 
       m_out->setX(i, m_lhs->refX(i));
-      if (propagateSpectraMask(m_lhs, m_rhs, i, m_out)) {
+      if (masked[i]) {
+        m_out->maskWorkspaceIndex(i);
+      } else {
         // Get reference to output vectors here to break any sharing outside the
         // function call below
         // where the order of argument evaluation is not guaranteed (if it's
@@ -666,6 +684,10 @@ void BinaryOperation::do2D(bool mismatchedSpectra) {
   if (mismatchedSpectra) {
     table = BinaryOperation::buildBinaryOperationTable(m_lhs, m_rhs);
   }
+  // Without a table the spectra are matched by index and masking propagates
+  std::vector<char> masked;
+  if (!table)
+    masked = findMaskedSpectra(*m_lhs, *m_rhs);
 
   // Propagate any masking first or it could mess up the numbers
   // TODO: Check if this works for event workspaces...
@@ -690,8 +712,10 @@ void BinaryOperation::do2D(bool mismatchedSpectra) {
             continue;
         } else {
           // Check for masking except when mismatched sizes
-          if (!propagateSpectraMask(m_lhs, m_rhs, i, m_out))
+          if (masked[i]) {
+            m_out->maskWorkspaceIndex(i);
             continue;
+          }
         }
         // Reach here? Do the division
         // Perform the operation on the event list on the output (== lhs)
@@ -722,8 +746,10 @@ void BinaryOperation::do2D(bool mismatchedSpectra) {
             continue;
         } else {
           // Check for masking except when mismatched sizes
-          if (!propagateSpectraMask(m_lhs, m_rhs, i, m_out))
+          if (masked[i]) {
+            m_out->maskWorkspaceIndex(i);
             continue;
+          }
         }
 
         // Reach here? Do the division
@@ -760,8 +786,10 @@ void BinaryOperation::do2D(bool mismatchedSpectra) {
           continue;
       } else {
         // Check for masking except when mismatched sizes
-        if (!propagateSpectraMask(m_lhs, m_rhs, i, m_out))
+        if (masked[i]) {
+          m_out->maskWorkspaceIndex(i);
           continue;
+        }
       }
       // Reach here? Do the division
       // Get reference to output vectors here to break any sharing outside the
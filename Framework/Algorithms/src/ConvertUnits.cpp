@@ -234,6 +234,10 @@ ConvertUnits::executeUnitConversion(const API::MatrixWorkspace_sptr inputWS) {
   bool alignBins = getProperty("AlignBins");
   if (alignBins && !WorkspaceHelpers::commonBoundaries(outputWS))
     outputWS = this->alignBins(outputWS);
+  else
+    // Spectra converted separately may have ended up with the same X values,
+    // e.g. those of detectors at the same distance and angle
+    WorkspaceHelpers::shareIdenticalX(outputWS);
 
   // If appropriate, put back the bin width division into Y/E.
   if (m_distribution && !m_inputEvents) // Never do this for event workspaces
@@ -544,6 +548,9 @@ ConvertUnits::convertViaTOF(Kernel::Unit_const_sptr fromUnit,
   assert(static_cast<bool>(eventWS) == m_inputEvents); // Sanity check
 
   const auto &outSpectrumInfo = outputWS->spectrumInfo();
+  // Local copies of the units, initialized for each spectrum in turn
+  auto localFromUnit = std::unique_ptr<Unit>(fromUnit->clone());
+  auto localOutputUnit = std::unique_ptr<Unit>(outputUnit->clone());
   // Loop over the histograms (detector spectra)
   for (int64_t i = 0; i < numberOfSpectra_i; ++i) {
     double efixed = efixedProp;
@@ -554,11 +561,6 @@ ConvertUnits::convertViaTOF(Kernel::Unit_const_sptr fromUnit,
     if (getDetectorValues(outSpectrumInfo, *outputUnit, emode, *outputWS,
                           signedTheta, i, efixed, l2, twoTheta)) {
 
-      // Make local copies of the units. This allows running the loop in
-      // parallel
-      auto localFromUnit = std::unique_ptr<Unit>(fromUnit->clone());
-      auto localOutputUnit = std::unique_ptr<Unit>(outputUnit->clone());
-
       /// @todo Don't yet consider hold-off (delta)
       const double delta = 0.0;
 
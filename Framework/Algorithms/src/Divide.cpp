@@ -4,6 +4,8 @@
 #include "MantidAlgorithms/Divide.h"
 #include "MantidDataObjects/WorkspaceSingleValue.h"
 
+#include <cmath>
+
 using namespace Mantid::API;
 using namespace Mantid::Kernel;
 using namespace Mantid::DataObjects;
@@ -34,9 +36,9 @@ void Divide::performBinaryOperation(const MantidVec &lhsX,
                                     MantidVec &EOut) {
   (void)lhsX; // Avoid compiler warning
 
-  const int bins = static_cast<int>(lhsE.size());
+  const size_t bins = lhsE.size();
 
-  for (int j = 0; j < bins; ++j) {
+  for (size_t j = 0; j < bins; ++j) {
     // Get references to the input Y's
     const double leftY = lhsY[j];
     const double rightY = rhsY[j];
@@ -48,13 +50,14 @@ void Divide::performBinaryOperation(const MantidVec &lhsX,
     // (Sa c/a)2 + (Sb c/b)2 = (Sc)2
     // = (Sa 1/b)2 + (Sb (a/b2))2
     // (Sc)2 = (1/b)2( (Sa)2 + (Sb a/b)2 )
-    EOut[j] =
-        sqrt(pow(lhsE[j], 2) + pow(leftY * rhsE[j] / rightY, 2)) / fabs(rightY);
+    const double leftE = lhsE[j];
+    const double rightTerm = leftY * rhsE[j] / rightY;
+    EOut[j] = std::sqrt(leftE * leftE + rightTerm * rightTerm) /
+              std::abs(rightY);
 
     // Copy the result last in case one of the input workspaces is also any
     // output
     YOut[j] = leftY / rightY;
-    ;
   }
 }
 
@@ -71,14 +74,16 @@ void Divide::performBinaryOperation(const MantidVec &lhsX,
                     << "\n";
 
   // Do the right-hand part of the error calculation just once
-  const double rhsFactor = pow(rhsE / rhsY, 2);
-  const int bins = static_cast<int>(lhsE.size());
-  for (int j = 0; j < bins; ++j) {
+  const double rhsFactor = (rhsE / rhsY) * (rhsE / rhsY);
+  const size_t bins = lhsE.size();
+  for (size_t j = 0; j < bins; ++j) {
     // Get reference to input Y
     const double leftY = lhsY[j];
+    const double leftE = lhsE[j];
 
     // see comment in the function above for the error formula
-    EOut[j] = sqrt(pow(lhsE[j], 2) + pow(leftY, 2) * rhsFactor) / fabs(rhsY);
+    EOut[j] =
+        std::sqrt(leftE * leftE + leftY * leftY * rhsFactor) / std::abs(rhsY);
     // Copy the result last in case one of the input workspaces is also any
     // output
     YOut[j] = leftY / rhsY;
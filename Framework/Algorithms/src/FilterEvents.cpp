@@ -164,6 +164,8 @@ void FilterEvents::exec() {
   m_progress = 0.1;
   progress(m_progress, "Create Output Workspaces.");
   createOutputWorkspaces();
+  if (m_useTableSplitters)
+    flattenSplitters();
 
   // Optionall import corrections
   m_progress = 0.20;
@@ -793,8 +795,49 @@ void FilterEvents::setupCustomizedTOFCorrection() {
   }
 }
 
+/** Convert the sorted table splitters to the boundaries of their intervals
+ * and the position in m_outputWS of the workspace that gets the events of
+ * each interval, so that events can be split in one pass. Where splitters
+ * overlap, the earlier one takes the events. Events before and between the
+ * splitters go to the unfiltered workspace. Events after the last splitter
+ * are dropped: their target is m_outputWS.size(), which has no output.
+ */
+void FilterEvents::flattenSplitters() {
+  std::map<int, size_t> positions;
+  for (const auto &ws : m_outputWS)
+    positions.emplace(ws.first, positions.size());
+  const size_t unfiltered = positions.at(-1);
+
+  m_splitTimes.clear();
+  m_splitTimes.reserve(2 * m_splitters.size());
+  m_splitTargets.assign(1, unfiltered);
+  m_splitTargets.reserve(2 * m_splitters.size() + 1);
+  for (const auto &splitter : m_splitters) {
+    int64_t start = splitter.start().totalNanoseconds();
+    const int64_t stop = splitter.stop().totalNanoseconds();
+    if (!m_splitTimes.empty())
+      start = std::max(start, m_splitTimes.back());
+    if (start >= stop)
+      continue;
+
+    if (m_splitTimes.empty() || start > m_splitTimes.back()) {
+      m_splitTimes.push_back(start);
+      m_splitTargets.push_back(positions.at(splitter.index()));
+    } else {
+      // starts where the previous interval stops
+      m_splitTargets.back() = positions.at(splitter.index());
+    }
+    m_splitTimes.push_back(stop);
+    m_splitTargets.push_back(unfiltered);
+  }
+  if (!m_splitTimes.empty())
+    m_splitTargets.back() = positions.size();
+}
+
 /** Main filtering method
-  * Structure: per spectrum --> per workspace
+  * Structure: per spectrum, in one pass over its events. Each spectrum only
+  * writes to its own event list of each output workspace, so no locking is
+  * needed.
  */
 void FilterEvents::filterEventsBySplitters(double progressamount) {
   size_t numberOfSpectra = m_eventWS->getNumberHistograms();
@@ -804,35 +847,44 @@ void FilterEvents::filterEventsBySplitters(double progressamount) {
   g_log.debug() << "Number of spectra in input/source EventWorkspace = "
                 << numberOfSpectra << ".\n";
 
-  // FIXME - Turn on parallel:
+  // Get the output event lists (should be empty) of all spectra first, in
+  // the order of m_splitTargets. Non-const getSpectrum() changes the
+  // workspace, so it is not called in the parallel loop. The last output is
+  // null, for the events that are dropped.
+  std::vector<std::vector<DataObjects::EventList *>> outputLists(
+      numberOfSpectra);
+  for (size_t iws = 0; iws < numberOfSpectra; ++iws) {
+    if (m_vecSkip[iws])
+      continue;
+    auto &outputs = outputLists[iws];
+    outputs.reserve(m_outputWS.size() + 1);
+    for (auto &ws : m_outputWS)
+      outputs.push_back(&ws.second->getSpectrum(iws));
+    outputs.push_back(nullptr);
+  }
+
+  const DataObjects::EventWorkspace &inputWS = *m_eventWS;
+  const bool docorrection =
+      !m_FilterByPulseTime && m_tofCorrType != NoneCorrect;
+
   PARALLEL_FOR_NO_WSP_CHECK()
   for (int64_t iws = 0; iws < int64_t(numberOfSpectra); ++iws) {
     PARALLEL_START_INTERUPT_REGION
 
     // Filter the non-skipped
     if (!m_vecSkip[iws]) {
-      // Get the output event lists (should be empty) to be a map
-      std::map<int, DataObjects::EventList *> outputs;
-      PARALLEL_CRITICAL(build_elist) {
-        for (auto &ws : m_outputWS) {
-          int index = ws.first;
-          auto &output_el = ws.second->getSpectrum(iws);
-          outputs.emplace(index, &output_el);
-        }
-      }
+      const auto &outputs = outputLists[iws];
 
       // Get a holder on input workspace's event list of this spectrum
-      const DataObjects::EventList &input_el = m_eventWS->getSpectrum(iws);
+      const DataObjects::EventList &input_el = inputWS.getSpectrum(iws);
 
-      // Perform the filtering (using the splitting function and just one
-      // output)
-      if (m_FilterByPulseTime) {
-        input_el.splitByPulseTime(m_splitters, outputs);
-      } else if (m_tofCorrType != NoneCorrect) {
-        input_el.splitByFullTime(m_splitters, outputs, true,
-                                 m_detTofFactors[iws], m_detTofOffsets[iws]);
+      if (docorrection) {
+        input_el.splitByTimeBoundaries(m_splitTimes, m_splitTargets, outputs,
+                                       false, true, m_detTofFactors[iws],
+                                       m_detTofOffsets[iws]);
       } else {
-        input_el.splitByFullTime(m_splitters, outputs, false, 1.0, 0.0);
+        input_el.splitByTimeBoundaries(m_splitTimes, m_splitTargets, outputs,
+                                       m_FilterByPulseTime, false, 1.0, 0.0);
       }
     }
 
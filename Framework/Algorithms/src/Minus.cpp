@@ -4,6 +4,8 @@
 #include "MantidAlgorithms/Minus.h"
 #include "MantidKernel/VectorHelper.h"
 
+#include <cmath>
+
 using namespace Mantid::API;
 using namespace Mantid::Kernel;
 
@@ -19,10 +21,15 @@ void Minus::performBinaryOperation(const MantidVec &lhsX, const MantidVec &lhsY,
                                    const MantidVec &rhsE, MantidVec &YOut,
                                    MantidVec &EOut) {
   (void)lhsX; // Avoid compiler warning
-  std::transform(lhsY.begin(), lhsY.end(), rhsY.begin(), YOut.begin(),
-                 std::minus<double>());
-  std::transform(lhsE.begin(), lhsE.end(), rhsE.begin(), EOut.begin(),
-                 VectorHelper::SumGaussError<double>());
+  // Values and errors in a single pass. The output may be one of the inputs,
+  // so each bin is read completely before it is written.
+  const size_t bins = lhsE.size();
+  for (size_t j = 0; j < bins; ++j) {
+    const double leftE = lhsE[j];
+    const double rightE = rhsE[j];
+    YOut[j] = lhsY[j] - rhsY[j];
+    EOut[j] = std::sqrt(leftE * leftE + rightE * rightE);
+  }
 }
 
 void Minus::performBinaryOperation(const MantidVec &lhsX, const MantidVec &lhsY,
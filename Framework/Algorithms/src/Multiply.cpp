@@ -4,6 +4,8 @@
 #include "MantidAlgorithms/Multiply.h"
 #include "MantidDataObjects/WorkspaceSingleValue.h"
 
+#include <cmath>
+
 using namespace Mantid::API;
 using namespace Mantid::Kernel;
 using namespace Mantid::DataObjects;
@@ -32,7 +34,9 @@ void Multiply::performBinaryOperation(const MantidVec &lhsX,
     // (Sa/a)2 + (Sb/b)2 = (Sc/c)2
     // (Sc)2 = (Sa c/a)2 + (Sb c/b)2
     //       = (Sa b)2 + (Sb a)2
-    EOut[j] = sqrt(pow(lhsE[j] * rightY, 2) + pow(rhsE[j] * leftY, 2));
+    const double leftTerm = lhsE[j] * rightY;
+    const double rightTerm = rhsE[j] * leftY;
+    EOut[j] = std::sqrt(leftTerm * leftTerm + rightTerm * rightTerm);
 
     // Copy the result last in case one of the input workspaces is also any
     // output
@@ -52,7 +56,9 @@ void Multiply::performBinaryOperation(const MantidVec &lhsX,
     const double leftY = lhsY[j];
 
     // see comment in the function above for the error formula
-    EOut[j] = sqrt(pow(lhsE[j] * rhsY, 2) + pow(rhsE * leftY, 2));
+    const double leftTerm = lhsE[j] * rhsY;
+    const double rightTerm = rhsE * leftY;
+    EOut[j] = std::sqrt(leftTerm * leftTerm + rightTerm * rightTerm);
 
     // Copy the result last in case one of the input workspaces is also any
     // output
@@ -7,6 +7,7 @@
 #include "MantidAPI/WorkspaceOpOverloads.h"
 #include "MantidDataObjects/EventWorkspace.h"
 #include "MantidGeometry/Instrument.h"
+#include "MantidHistogramData/Expression.h"
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/CompositeValidator.h"
 #include "MantidKernel/EnabledWhenProperty.h"
@@ -610,38 +611,15 @@ void NormaliseToMonitor::normaliseBinByBin(
       // ---------------------------------------
       auto &YOut = outputWorkspace->mutableY(i);
       auto &EOut = outputWorkspace->mutableE(i);
-      const auto &inY = inputWorkspace->y(i);
-      const auto &inE = inputWorkspace->e(i);
       outputWorkspace->mutableX(i) = inputWorkspace->x(i);
 
-      // The code below comes more or less straight out of Divide.cpp
-      for (size_t k = 0; k < specLength; ++k) {
-        // Get the input Y's
-        const double leftY = inY[k];
-        const double rightY = Y[k];
-
-        if (rightY == 0.0) {
-          hasZeroDivision = true;
-        }
-
-        // Calculate result and store in local variable to avoid overwriting
-        // original data if
-        // output workspace is same as one of the input ones
-        const double newY = leftY / rightY;
-
-        if (fabs(rightY) > 1.0e-12 && fabs(newY) > 1.0e-12) {
-          const double lhsFactor = (inE[k] < 1.0e-12 || fabs(leftY) < 1.0e-12)
-                                       ? 0.0
-                                       : pow((inE[k] / leftY), 2);
-          const double rhsFactor =
-              E[k] < 1.0e-12 ? 0.0 : pow((E[k] / rightY), 2);
-          EOut[k] = std::abs(newY) * sqrt(lhsFactor + rhsFactor);
-        }
-
-        // Now store the result
-        YOut[k] = newY;
-      } // end Workspace2D case
-    }   // end loop over current spectrum
+      if (std::find(Y.cbegin(), Y.cend(), 0.0) != Y.cend())
+        hasZeroDivision = true;
+      // Divide in one pass, propagating the errors as Divide does. The output
+      // may be the input, each bin is read before it is written.
+      assign(YOut, EOut,
+             lazy(inputWorkspace->y(i), inputWorkspace->e(i)) / lazy(Y, E));
+    } // end Workspace2D case
 
     PARALLEL_END_INTERUPT_REGION
   } // end loop over spectra
@@ -8,6 +8,7 @@
 #include "MantidDataObjects/EventWorkspace.h"
 #include "MantidDataObjects/EventList.h"
 #include "MantidKernel/ArrayProperty.h"
+#include "MantidKernel/make_unique.h"
 #include "MantidKernel/RebinParamsValidator.h"
 #include "MantidKernel/VectorHelper.h"
 
@@ -246,6 +247,14 @@ void Rebin::exec() {
     if (inputWS->axes() > 1)
       outputWS->replaceAxis(1, inputWS->getAxis(1)->clone(outputWS.get()));
 
+    // The overlaps of old and new bins are computed once for the X values of
+    // the first spectrum, and reused for all spectra with the same X values.
+    std::unique_ptr<VectorHelper::RebinOverlaps> overlaps;
+    if (histnumber > 0)
+      overlaps = Kernel::make_unique<VectorHelper::RebinOverlaps>(
+          inputWS->readX(0), XValues_new.rawData(), dist);
+    const MantidVec *commonX = histnumber > 0 ? &inputWS->readX(0) : nullptr;
+
     Progress prog(this, 0.0, 1.0, histnumber);
     PARALLEL_FOR_IF(Kernel::threadSafe(*inputWS, *outputWS))
     for (int hist = 0; hist < histnumber; ++hist) {
@@ -261,8 +270,11 @@ void Rebin::exec() {
 
       // output data arrays are implicitly filled by function
       try {
-        VectorHelper::rebin(XValues, YValues, YErrors, XValues_new.rawData(),
-                            YValues_new, YErrors_new, dist);
+        if (&XValues == commonX || XValues == *commonX)
+          overlaps->apply(YValues, YErrors, YValues_new, YErrors_new);
+        else
+          VectorHelper::rebin(XValues, YValues, YErrors, XValues_new.rawData(),
+                              YValues_new, YErrors_new, dist);
       } catch (std::exception &ex) {
         g_log.error() << "Error in rebin function: " << ex.what() << '\n';
         throw;
@@ -2,14 +2,15 @@
 #include "MantidDataObjects/Histogram1D.h"
 #include "MantidAPI/BinEdgeAxis.h"
 #include "MantidAPI/CommonBinsValidator.h"
+#include "MantidAPI/DetectorInfo.h"
 #include "MantidAPI/HistogramValidator.h"
 #include "MantidAPI/InstrumentValidator.h"
 #include "MantidAPI/SpectraAxisValidator.h"
 #include "MantidAPI/SpectrumDetectorMapping.h"
+#include "MantidAPI/SpectrumInfo.h"
 #include "MantidAPI/WorkspaceFactory.h"
 #include "MantidAPI/WorkspaceUnitValidator.h"
 #include "MantidGeometry/Instrument.h"
-#include "MantidGeometry/Instrument/DetectorGroup.h"
 #include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/CompositeValidator.h"
@@ -139,29 +140,24 @@ void SofQWCentre::exec() {
   // qw workspace
   const size_t numHists = inputWorkspace->getNumberHistograms();
   const size_t numBins = inputWorkspace->blocksize();
+  const auto &spectrumInfo = inputWorkspace->spectrumInfo();
+  const auto &detectorInfo = inputWorkspace->detectorInfo();
+  const V3D samplePos = detectorInfo.samplePosition();
   Progress prog(this, 0.0, 1.0, numHists);
   for (int64_t i = 0; i < int64_t(numHists); ++i) {
     try {
-      // Now get the detector object for this histogram
-      IDetector_const_sptr spectrumDet = inputWorkspace->getDetector(i);
-      if (spectrumDet->isMonitor())
+      if (!spectrumInfo.hasDetectors(i) || spectrumInfo.isMonitor(i))
         continue;
 
-      const double efixed = m_EmodeProperties.getEFixed(*spectrumDet);
+      const double efixed =
+          m_EmodeProperties.getEFixed(spectrumInfo.detector(i));
 
       // For inelastic scattering the simple relationship q=4*pi*sinTheta/lambda
       // does not hold. In order to
       // be completely general we must calculate the momentum transfer by
       // calculating the incident and final
       // wave vectors and then use |q| = sqrt[(ki - kf)*(ki - kf)]
-      DetectorGroup_const_sptr detGroup =
-          boost::dynamic_pointer_cast<const DetectorGroup>(spectrumDet);
-      std::vector<IDetector_const_sptr> detectors;
-      if (detGroup) {
-        detectors = detGroup->getDetectors();
-      } else {
-        detectors.push_back(spectrumDet);
-      }
+      const auto &detectors = inputWorkspace->getSpectrum(i).getDetectorIDs();
 
       const size_t numDets = detectors.size();
       // cache to reduce number of static casts
@@ -171,10 +167,11 @@ void SofQWCentre::exec() {
       const auto &X = inputWorkspace->x(i);
 
       // Loop over the detectors and for each bin calculate Q
-      for (size_t idet = 0; idet < numDets; ++idet) {
-        IDetector_const_sptr det = detectors[idet];
+      size_t idet = 0;
+      for (const auto detID : detectors) {
         // Calculate kf vector direction and then Q for each energy bin
-        V3D scatterDir = (det->getPos() - sample->getPos());
+        V3D scatterDir =
+            detectorInfo.position(detectorInfo.indexOf(detID)) - samplePos;
         scatterDir.normalize();
         for (size_t j = 0; j < numBins; ++j) {
           const double deltaE = 0.5 * (X[j] + X[j + 1]);
@@ -227,7 +224,7 @@ void SofQWCentre::exec() {
           // Add this spectra-detector pair to the mapping
           specNumberMapping.push_back(
               outputWorkspace->getSpectrum(qIndex).getSpectrumNo());
-          detIDMapping.push_back(det->getID());
+          detIDMapping.push_back(detID);
 
           // And add the data and it's error to that bin, taking into account
           // the number of detectors contributing to this bin
@@ -237,6 +234,7 @@ void SofQWCentre::exec() {
               sqrt((pow(outputWorkspace->e(qIndex)[j], 2) + pow(E[j], 2)) /
                    numDets_d);
         }
+        ++idet;
       }
 
     } catch (Exception::NotFoundError &) {
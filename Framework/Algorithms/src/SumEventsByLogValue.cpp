@@ -21,6 +21,26 @@ DECLARE_ALGORITHM(SumEventsByLogValue)
 using namespace Kernel;
 using namespace API;
 
+namespace {
+/** Build or free the interval index of a number series log
+ *  @param log :: A TimeSeriesProperty<double> or TimeSeriesProperty<int>
+ *  @param build :: True to build the index, false to free it
+ */
+void setIntervalIndex(const ITimeSeriesProperty *log, const bool build) {
+  if (auto dblLog = dynamic_cast<const TimeSeriesProperty<double> *>(log)) {
+    if (build)
+      dblLog->buildIntervalIndex();
+    else
+      dblLog->clearIntervalIndex();
+  } else if (auto intLog = dynamic_cast<const TimeSeriesProperty<int> *>(log)) {
+    if (build)
+      intLog->buildIntervalIndex();
+    else
+      intLog->clearIntervalIndex();
+  }
+}
+} // namespace
+
 void SumEventsByLogValue::init() {
   declareProperty(
       make_unique<WorkspaceProperty<DataObjects::EventWorkspace>>(
@@ -207,6 +227,8 @@ void SumEventsByLogValue::createTableOutput(
     // For the benefit of MantidPlot, set these columns to be containing X
     // values
     newColumn->setPlotType(1);
+    // Each of them is averaged once for every value of the main log
+    setIntervalIndex(otherLog.second, true);
   }
 
   // Now to get the average value of other time-varying logs
@@ -249,6 +271,8 @@ void SumEventsByLogValue::createTableOutput(
     }
     prog.report();
   }
+  for (auto &otherLog : otherLogs)
+    setIntervalIndex(otherLog.second, false);
 
   setProperty("OutputWorkspace", outputWorkspace);
 }
@@ -46,6 +46,8 @@ public:
     return BinaryOperation::checkSizeCompatibility(ws1, ws2);
   }
 
+  using BinaryOperation::findMaskedSpectra;
+
 private:
   // Unhide base class method to avoid Intel compiler warning
   using BinaryOperation::checkSizeCompatibility;
@@ -191,6 +193,41 @@ public:
     }
   }
 
+  void test_findMaskedSpectra() {
+    const int nHist = 5, nBins = 10;
+    std::set<int64_t> lhsMasking{1};
+    std::set<int64_t> rhsMasking{3, 4};
+    MatrixWorkspace_sptr lhs = WorkspaceCreationHelper::Create2DWorkspace123(
+        nHist, nBins, 0, lhsMasking);
+    MatrixWorkspace_sptr rhs = WorkspaceCreationHelper::Create2DWorkspace123(
+        nHist, nBins, 0, rhsMasking);
+
+    BinaryOpHelper helper;
+    const auto masked = helper.findMaskedSpectra(*lhs, *rhs);
+    TS_ASSERT_EQUALS(masked, std::vector<char>({0, 1, 0, 1, 1}));
+    // Workspaces without detectors have nothing masked
+    auto noInstrument =
+        WorkspaceCreationHelper::Create2DWorkspace(nHist, nBins);
+    TS_ASSERT_EQUALS(helper.findMaskedSpectra(*noInstrument, *noInstrument),
+                     std::vector<char>(nHist, 0));
+  }
+
+  void test_findMaskedSpectra_with_unknown_detector_ids() {
+    const int nHist = 3, nBins = 10;
+    std::set<int64_t> masking{1, 2};
+    MatrixWorkspace_sptr lhs =
+        WorkspaceCreationHelper::Create2DWorkspace123(nHist, nBins, 0, masking);
+    MatrixWorkspace_sptr rhs =
+        WorkspaceCreationHelper::Create2DWorkspace123(nHist, nBins, 0);
+    // Spectrum 1 mixes a masked detector with an ID the instrument lacks
+    lhs->getSpectrum(1).addDetectorID(1000);
+
+    BinaryOpHelper helper;
+    std::vector<char> masked;
+    TS_ASSERT_THROWS_NOTHING(masked = helper.findMaskedSpectra(*lhs, *rhs));
+    TS_ASSERT_EQUALS(masked, std::vector<char>({0, 0, 1}));
+  }
+
   BinaryOperation::BinaryOperationTable_sptr
   do_test_buildBinaryOperationTable(std::vector<std::vector<int>> lhs,
                                     std::vector<std::vector<int>> rhs,
@@ -148,6 +148,15 @@ public:
     TS_ASSERT_EQUALS(filteredws2->getSpectrum(1).getNumberEvents(), 21);
     TS_ASSERT_EQUALS(filteredws2->run().getProtonCharge(), 21);
 
+    // Unfiltered events are those between splitters. The 3 events of each
+    // spectrum after the last splitter are thrown away.
+    DataObjects::EventWorkspace_sptr unfilteredws =
+        boost::dynamic_pointer_cast<DataObjects::EventWorkspace>(
+            AnalysisDataService::Instance().retrieve(
+                "FilteredWS01_unfiltered"));
+    TS_ASSERT(unfilteredws);
+    TS_ASSERT_EQUALS(unfilteredws->getSpectrum(1).getNumberEvents(), 6);
+
     DataObjects::EventList elist3 = filteredws2->getSpectrum(3);
     elist3.sortPulseTimeTOF();
 
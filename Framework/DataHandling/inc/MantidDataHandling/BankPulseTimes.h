@@ -23,9 +23,6 @@ public:
   /// Constructor with vector of DateAndTime
   BankPulseTimes(const std::vector<Mantid::Kernel::DateAndTime> &times);
 
-  /// Destructor
-  ~BankPulseTimes();
-
   /// Equals
   bool equals(size_t otherNumPulse, std::string otherStartTime);
 
@@ -35,8 +32,8 @@ public:
   /// Size of the array of pulse times
   size_t numPulses;
 
-  /// Array of the pulse times
-  Mantid::Kernel::DateAndTime *pulseTimes;
+  /// Array of the pulse times. Compact events refer to it by index.
+  std::vector<Mantid::Kernel::DateAndTime> pulseTimes;
 
   /// Vector of period numbers corresponding to each pulse
   std::vector<int> periodNumbers;
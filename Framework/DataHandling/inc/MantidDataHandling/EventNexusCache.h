@@ -0,0 +1,186 @@
+#ifndef MANTID_DATAHANDLING_EVENTNEXUSCACHE_H_
+#define MANTID_DATAHANDLING_EVENTNEXUSCACHE_H_
+
+#include "MantidKernel/System.h"
+
+#include <boost/shared_ptr.hpp>
+
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace Mantid {
+namespace DataHandling {
+
+/** EventNexusCache : Read-only view of a cache of the raw event data of an
+  event NeXus file, as written by EventNexusCacheWriter.
+
+  The cache holds, for each bank, the event_index, event_id, time-of-flight
+  and (optional) weight arrays exactly as they are stored in the NeXus file
+  but without the HDF5 compression. The file is mapped into memory, so the
+  arrays are used in place and reading them costs no more than paging the
+  file in.
+
+  The layout of the file is a fixed header (magic, version, byte order
+  marker, offset of the bank table), the arrays of each bank aligned to 8
+  bytes, a table of banks giving the name, sizes and array offsets of each
+  bank, and the magic again to mark the end of the file. Numbers are stored
+  in the byte order of the machine that wrote the cache; a cache from
+  another machine is rejected.
+
+  Copyright &copy; 2016 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+class DLLExport EventNexusCache {
+public:
+  /// Version of the file layout. Caches of other versions are ignored.
+  static const uint32_t Version;
+
+  /// The events of one bank. The pointers are into the mapped file.
+  struct Bank {
+    /// Number of pulses, i.e. the length of eventIndex
+    size_t numPulses;
+    /// Index of the first event of each pulse
+    const uint64_t *eventIndex;
+    /// Number of events
+    size_t numEvents;
+    /// Pixel ID of each event
+    const uint32_t *eventId;
+    /// Time-of-flight of each event
+    const float *tof;
+    /// Weight of each event, or nullptr if the events are not weighted
+    const float *weight;
+  };
+
+  static std::string cacheFilename(const std::string &directory,
+                                   const std::string &nexusFilename,
+                                   const std::string &entryName);
+
+  static boost::shared_ptr<EventNexusCache>
+  open(const std::string &cacheFilename);
+
+  ~EventNexusCache();
+  EventNexusCache(const EventNexusCache &) = delete;
+  EventNexusCache &operator=(const EventNexusCache &) = delete;
+
+  const Bank *bank(const std::string &name) const;
+  /// @return the number of banks held
+  size_t numBanks() const { return m_banks.size(); }
+
+private:
+  EventNexusCache() = default;
+  bool map(const std::string &cacheFilename);
+  bool readBankTable();
+
+  /// Start of the mapped file
+  const char *m_data = nullptr;
+  /// Length of the mapped file
+  size_t m_size = 0;
+#ifdef _WIN32
+  /// Handles of the file and of its mapping
+  void *m_fileHandle = nullptr;
+  void *m_mappingHandle = nullptr;
+#endif
+  /// The banks, by name
+  std::map<std::string, Bank> m_banks;
+};
+
+/** EventNexusCacheWriter : Writes the raw event data of the banks of an event
+  NeXus file into a cache that can be read with EventNexusCache.
+
+  Each bank is started with beginBank(), which writes the event_index and
+  reserves space for the event arrays. The events are then written in any
+  number of slabs and the bank finished with endBank(). Banks that are not
+  finished are left out of the cache. The cache is written to a temporary
+  file that is only renamed to its final name by commit(), so a load that
+  fails part way never leaves an incomplete cache to be read.
+
+  Copyright &copy; 2016 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+class DLLExport EventNexusCacheWriter {
+public:
+  explicit EventNexusCacheWriter(const std::string &cacheFilename);
+  ~EventNexusCacheWriter();
+
+  void beginBank(const std::string &name,
+                 const std::vector<uint64_t> &eventIndex, size_t numEvents,
+                 bool haveWeights);
+  void writeEvents(size_t offset, const uint32_t *eventId, const float *tof,
+                   const float *weight, size_t count);
+  void endBank(bool haveWeights);
+  void commit();
+
+private:
+  /// Position and size of the arrays of a bank in the file
+  struct BankRecord {
+    std::string name;
+    uint64_t numPulses;
+    uint64_t numEvents;
+    uint64_t eventIndexOffset;
+    uint64_t eventIdOffset;
+    uint64_t tofOffset;
+    uint64_t weightOffset;
+  };
+
+  void write(uint64_t offset, const void *data, size_t bytes);
+  uint64_t reserve(size_t bytes);
+
+  /// Name of the finished cache
+  std::string m_filename;
+  /// Name of the file written until commit()
+  std::string m_tempFilename;
+  /// The file being written
+  std::ofstream m_file;
+  /// End of the space used in the file
+  uint64_t m_end;
+  /// Banks that have been finished
+  std::vector<BankRecord> m_banks;
+  /// The bank being written
+  BankRecord m_current;
+  /// Is a bank being written?
+  bool m_inBank;
+};
+
+} // namespace DataHandling
+} // namespace Mantid
+
+#endif /* MANTID_DATAHANDLING_EVENTNEXUSCACHE_H_ */
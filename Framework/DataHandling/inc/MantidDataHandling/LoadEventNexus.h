@@ -13,6 +13,7 @@
 #include "MantidGeometry/Instrument/ParameterMap.h"
 #include "MantidKernel/TimeSeriesProperty.h"
 #include "MantidDataHandling/EventWorkspaceCollection.h"
+#include "MantidDataHandling/EventNexusCache.h"
 
 #ifdef _WIN32 // fixing windows issue causing conflict between
 // winnt char and nexus char
@@ -22,6 +23,7 @@
 #include <nexus/NeXusFile.hpp>
 #include <nexus/NeXusException.hpp>
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <boost/lexical_cast.hpp>
@@ -177,6 +179,32 @@ public:
 
   /// Tolerance for CompressEvents; use -1 to mean don't compress.
   double compressTolerance;
+  /// Is compressTolerance relative to the time-of-flight?
+  bool m_compressLogarithmic;
+
+  /// Store un-weighted events as CompactTofEvent's referring to the bank's
+  /// pulse times?
+  bool m_compactEvents;
+
+  /// Largest number of events read from a bank in one go
+  size_t m_eventsPerRead;
+
+  /// Number of events read beyond which the reading task processes its own
+  /// data before reading more
+  size_t m_maxBufferedEvents;
+
+  /// Number of events that have been read but not yet processed
+  std::atomic<size_t> m_bufferedEvents;
+
+  /// Intervals of pulse time whose events are loaded, sorted and not
+  /// overlapping. Empty to load every pulse.
+  Kernel::TimeSplitterType m_loadIntervals;
+
+  /// Cache of the raw events to read banks from, if there is one
+  boost::shared_ptr<EventNexusCache> m_eventCache;
+
+  /// Writes the cache of the raw events, while it is being made
+  std::unique_ptr<EventNexusCacheWriter> m_eventCacheWriter;
 
   /// Pointer to the vector of events
   typedef std::vector<Mantid::DataObjects::TofEvent> *EventVector_pt;
@@ -238,6 +266,8 @@ private:
   void createWorkspaceIndexMaps(const bool monitors,
                                 const std::vector<std::string> &bankNames);
   void loadEvents(API::Progress *const prog, const bool monitors);
+  void openEventCache(const bool filtered);
+  void commitEventCache();
   void createSpectraMapping(
       const std::string &nxsfile, const bool monitorsOnly,
       const std::vector<std::string> &bankNames = std::vector<std::string>());
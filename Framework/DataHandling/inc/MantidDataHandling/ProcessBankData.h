@@ -39,6 +39,8 @@ public:
   * @param event_weight :: array with weights for events
   * @param min_event_id ;: minimum detector ID to load
   * @param max_event_id :: maximum detector ID to load
+  * @param precountFactor :: when pre-counting, space is reserved for this
+  *many times the events counted in each pixel. 0 to skip pre-counting.
   * @return
   */ // API::IFileLoader<Kernel::NexusDescriptor>
   ProcessBankData(LoadEventNexus *alg, std::string entry_name,
@@ -48,11 +50,15 @@ public:
                   boost::shared_ptr<std::vector<uint64_t>> event_index,
                   boost::shared_ptr<BankPulseTimes> thisBankPulseTimes,
                   bool have_weight, boost::shared_array<float> event_weight,
-                  detid_t min_event_id, detid_t max_event_id);
+                  detid_t min_event_id, detid_t max_event_id,
+                  double precountFactor);
 
   void run() override;
 
 private:
+  std::vector<std::vector<std::vector<DataObjects::CompactTofEvent> *>>
+  makeCompactEventVectors();
+
   /// Algorithm being run
   LoadEventNexus *alg;
   /// NXS path to bank
@@ -84,6 +90,8 @@ private:
   detid_t m_min_id;
   /// Maximum pixel id
   detid_t m_max_id;
+  /// Multiplies the pre-counted events of each pixel
+  double m_precountFactor;
   /// timer for performance
   Mantid::Kernel::Timer m_timer;
 }; // ENDDEF-CLASS ProcessBankData
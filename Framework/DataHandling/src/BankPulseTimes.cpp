@@ -38,30 +38,22 @@ BankPulseTimes::BankPulseTimes(::NeXus::File &file,
     ;
   }
 
-  pulseTimes = new DateAndTime[numPulses];
+  pulseTimes.reserve(numPulses);
   for (size_t i = 0; i < numPulses; i++)
-    pulseTimes[i] = start + seconds[i];
+    pulseTimes.push_back(start + seconds[i]);
 }
 
 //----------------------------------------------------------------------------------------------
 /** Constructor. Build from a vector of date and times.
 *  Handles a zero-sized vector */
-BankPulseTimes::BankPulseTimes(const std::vector<DateAndTime> &times) {
-  numPulses = times.size();
-  pulseTimes = nullptr;
+BankPulseTimes::BankPulseTimes(const std::vector<DateAndTime> &times)
+    : numPulses(times.size()), pulseTimes(times) {
   if (numPulses == 0)
     return;
-  pulseTimes = new DateAndTime[numPulses];
   periodNumbers = std::vector<int>(
       numPulses, FirstPeriod); // TODO we are fixing this at 1 period for all
-  for (size_t i = 0; i < numPulses; i++)
-    pulseTimes[i] = times[i];
 }
 
-//----------------------------------------------------------------------------------------------
-/** Destructor */
-BankPulseTimes::~BankPulseTimes() { delete[] this->pulseTimes; }
-
 //----------------------------------------------------------------------------------------------
 /** Comparison. Is this bank's pulse times array the same as another one.
 *
@@ -3,6 +3,7 @@
 #include "MantidDataObjects/EventWorkspace.h"
 #include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/BoundedValidator.h"
+#include "MantidKernel/ListValidator.h"
 #include <set>
 #include <numeric>
 
@@ -34,6 +35,14 @@ void CompressEvents::init() {
       "The tolerance on each event's X value (normally TOF, but may be a "
       "different unit if you have used ConvertUnits).\n"
       "Any events within Tolerance will be summed into a single event.");
+
+  declareProperty("BinningMode", "Linear",
+                  boost::make_shared<StringListValidator>(
+                      std::vector<std::string>{"Linear", "Logarithmic"}),
+                  "Linear: events within Tolerance of the first event of a "
+                  "group are summed. Logarithmic: Tolerance is relative to "
+                  "the X value of the first event, so the compressed events "
+                  "keep the same relative resolution across a wide range.");
 }
 
 void CompressEvents::exec() {
@@ -41,6 +50,9 @@ void CompressEvents::exec() {
   EventWorkspace_sptr inputWS = getProperty("InputWorkspace");
   EventWorkspace_sptr outputWS = getProperty("OutputWorkspace");
   double tolerance = getProperty("Tolerance");
+  // EventList takes a negative tolerance to be relative
+  if (getPropertyValue("BinningMode") == "Logarithmic")
+    tolerance = -tolerance;
 
   // Some starting things
   bool inplace = (inputWS == outputWS);
@@ -0,0 +1,378 @@
+#include "MantidDataHandling/EventNexusCache.h"
+#include "MantidKernel/ChecksumHelper.h"
+
+#include <Poco/File.h>
+#include <Poco/Path.h>
+
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Mantid {
+namespace DataHandling {
+
+namespace {
+/// Identifies a cache file
+const char MAGIC[8] = {'M', 'T', 'D', 'E', 'V', 'C', 'H', 'E'};
+/// Written as a number to detect a cache from a machine of another byte order
+const uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+/// The fixed header at the start of the file
+struct FileHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t byteOrder;
+  uint64_t bankTableOffset;
+  uint64_t numBanks;
+};
+
+/// The numbers stored for each bank in the bank table, after its name
+const size_t NUM_BANK_FIELDS = 6;
+
+/// Round up to a multiple of 8 bytes
+uint64_t align(const uint64_t offset) { return (offset + 7) & ~uint64_t(7); }
+
+/// Read a number from the bank table, moving on the position
+bool readNumber(const char *data, const size_t size, size_t &position,
+                uint64_t &value) {
+  if (position + sizeof(value) > size)
+    return false;
+  std::memcpy(&value, data + position, sizeof(value));
+  position += sizeof(value);
+  return true;
+}
+
+/// Does an array of count elements of the given size fit in the file?
+bool fits(const uint64_t offset, const uint64_t count, const size_t elementSize,
+          const size_t size) {
+  return offset % elementSize == 0 && offset <= size &&
+         count <= (size - offset) / elementSize;
+}
+}
+
+const uint32_t EventNexusCache::Version = 1;
+
+//----------------------------------------------------------------------------------------------
+/** Name of the cache of a NeXus file. The name is the checksum of the full
+ * path, size and modification time of the file and of the entry loaded, so
+ * a changed or replaced file gets a new cache. Checksumming the contents
+ * would cost as much as reading the file, which is what the cache avoids.
+ *
+ * @param directory :: directory holding the caches
+ * @param nexusFilename :: the NeXus file
+ * @param entryName :: the NXentry the events are loaded from
+ * @return the full path of the cache file
+ */
+std::string EventNexusCache::cacheFilename(const std::string &directory,
+                                           const std::string &nexusFilename,
+                                           const std::string &entryName) {
+  Poco::File nexusFile(nexusFilename);
+  std::ostringstream identity;
+  identity << Poco::Path(nexusFilename).absolute().toString() << '\n'
+           << nexusFile.getSize() << '\n'
+           << nexusFile.getLastModified().epochMicroseconds() << '\n'
+           << entryName << '\n'
+           << Version;
+  Poco::Path path(directory);
+  path.makeDirectory();
+  path.setFileName(Kernel::ChecksumHelper::sha1FromString(identity.str()) +
+                   ".eventcache");
+  return path.toString();
+}
+
+//----------------------------------------------------------------------------------------------
+/** Open a cache
+ * @param cacheFilename :: the cache file
+ * @return the cache, or a null pointer if the file does not exist or is not
+ * a valid cache
+ */
+boost::shared_ptr<EventNexusCache>
+EventNexusCache::open(const std::string &cacheFilename) {
+  if (!Poco::File(cacheFilename).exists())
+    return boost::shared_ptr<EventNexusCache>();
+  boost::shared_ptr<EventNexusCache> cache(new EventNexusCache());
+  if (!cache->map(cacheFilename) || !cache->readBankTable())
+    return boost::shared_ptr<EventNexusCache>();
+  return cache;
+}
+
+/// Destructor. Unmaps the file.
+EventNexusCache::~EventNexusCache() {
+#ifdef _WIN32
+  if (m_data)
+    UnmapViewOfFile(m_data);
+  if (m_mappingHandle)
+    CloseHandle(m_mappingHandle);
+  if (m_fileHandle)
+    CloseHandle(m_fileHandle);
+#else
+  if (m_data)
+    munmap(const_cast<char *>(m_data), m_size);
+#endif
+}
+
+//----------------------------------------------------------------------------------------------
+/** Find a bank
+ * @param name :: name of the bank
+ * @return the bank, or nullptr if it is not in the cache
+ */
+const EventNexusCache::Bank *
+EventNexusCache::bank(const std::string &name) const {
+  auto it = m_banks.find(name);
+  if (it == m_banks.end())
+    return nullptr;
+  return &it->second;
+}
+
+//----------------------------------------------------------------------------------------------
+/** Map the file into memory, read-only
+ * @param cacheFilename :: the cache file
+ * @return false if the file could not be mapped
+ */
+bool EventNexusCache::map(const std::string &cacheFilename) {
+#ifdef _WIN32
+  HANDLE file =
+      CreateFileA(cacheFilename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL,
+                  OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (file == INVALID_HANDLE_VALUE)
+    return false;
+  m_fileHandle = file;
+  LARGE_INTEGER fileSize;
+  if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+    return false;
+  m_size = static_cast<size_t>(fileSize.QuadPart);
+  m_mappingHandle = CreateFileMapping(file, NULL, PAGE_READONLY, 0, 0, NULL);
+  if (!m_mappingHandle)
+    return false;
+  m_data = static_cast<const char *>(
+      MapViewOfFile(m_mappingHandle, FILE_MAP_READ, 0, 0, 0));
+#else
+  const int fd = ::open(cacheFilename.c_str(), O_RDONLY);
+  if (fd < 0)
+    return false;
+  struct stat status;
+  if (fstat(fd, &status) != 0 || status.st_size <= 0) {
+    close(fd);
+    return false;
+  }
+  m_size = static_cast<size_t>(status.st_size);
+  void *data = mmap(nullptr, m_size, PROT_READ, MAP_SHARED, fd, 0);
+  // The mapping stays valid after the file is closed
+  close(fd);
+  if (data == MAP_FAILED)
+    return false;
+  m_data = static_cast<const char *>(data);
+#endif
+  return m_data != nullptr;
+}
+
+//----------------------------------------------------------------------------------------------
+/** Check the header and read the table of banks. Every array is checked to
+ * lie inside the file.
+ * @return false if the file is not a valid cache
+ */
+bool EventNexusCache::readBankTable() {
+  FileHeader header;
+  if (m_size < sizeof(header) + sizeof(MAGIC))
+    return false;
+  std::memcpy(&header, m_data, sizeof(header));
+  // The file ends with the magic too, so a truncated file is rejected
+  if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 ||
+      std::memcmp(m_data + m_size - sizeof(MAGIC), MAGIC, sizeof(MAGIC)) != 0 ||
+      header.version != Version || header.byteOrder != BYTE_ORDER_MARK ||
+      header.bankTableOffset > m_size)
+    return false;
+
+  size_t position = static_cast<size_t>(header.bankTableOffset);
+  for (uint64_t i = 0; i < header.numBanks; ++i) {
+    uint64_t nameLength;
+    if (!readNumber(m_data, m_size, position, nameLength) ||
+        nameLength > m_size - position)
+      return false;
+    const std::string name(m_data + position, static_cast<size_t>(nameLength));
+    position += static_cast<size_t>(nameLength);
+
+    uint64_t fields[NUM_BANK_FIELDS];
+    for (auto &field : fields)
+      if (!readNumber(m_data, m_size, position, field))
+        return false;
+    const uint64_t numPulses = fields[0];
+    const uint64_t numEvents = fields[1];
+    if (!fits(fields[2], numPulses, sizeof(uint64_t), m_size) ||
+        !fits(fields[3], numEvents, sizeof(uint32_t), m_size) ||
+        !fits(fields[4], numEvents, sizeof(float), m_size) ||
+        (fields[5] != 0 && !fits(fields[5], numEvents, sizeof(float), m_size)))
+      return false;
+
+    Bank bank;
+    bank.numPulses = static_cast<size_t>(numPulses);
+    bank.eventIndex = reinterpret_cast<const uint64_t *>(m_data + fields[2]);
+    bank.numEvents = static_cast<size_t>(numEvents);
+    bank.eventId = reinterpret_cast<const uint32_t *>(m_data + fields[3]);
+    bank.tof = reinterpret_cast<const float *>(m_data + fields[4]);
+    bank.weight = fields[5] != 0
+                      ? reinterpret_cast<const float *>(m_data + fields[5])
+                      : nullptr;
+    m_banks[name] = bank;
+  }
+  return true;
+}
+
+//==============================================================================================
+// EventNexusCacheWriter
+//==============================================================================================
+
+//----------------------------------------------------------------------------------------------
+/** Constructor. Starts writing the cache to a temporary file next to it.
+ * @param cacheFilename :: the cache file to create
+ * @throw std::runtime_error if the file cannot be created
+ */
+EventNexusCacheWriter::EventNexusCacheWriter(const std::string &cacheFilename)
+    : m_filename(cacheFilename), m_tempFilename(cacheFilename + ".part"),
+      m_file(m_tempFilename.c_str(), std::ios::binary | std::ios::trunc),
+      m_end(sizeof(FileHeader)), m_banks(), m_current(), m_inBank(false) {
+  if (!m_file)
+    throw std::runtime_error("Unable to create event cache file " +
+                             m_tempFilename);
+}
+
+/// Destructor. Removes the temporary file if the cache was not committed.
+EventNexusCacheWriter::~EventNexusCacheWriter() {
+  if (!m_file.is_open())
+    return;
+  m_file.close();
+  try {
+    Poco::File(m_tempFilename).remove();
+  } catch (...) {
+    // Leaving the temporary file behind is harmless
+  }
+}
+
+//----------------------------------------------------------------------------------------------
+/** Start a bank. Any bank that was started but not finished is dropped.
+ * @param name :: name of the bank
+ * @param eventIndex :: the event_index of the bank
+ * @param numEvents :: the number of events in the bank
+ * @param haveWeights :: reserve space for weights?
+ */
+void EventNexusCacheWriter::beginBank(const std::string &name,
+                                      const std::vector<uint64_t> &eventIndex,
+                                      const size_t numEvents,
+                                      const bool haveWeights) {
+  m_current.name = name;
+  m_current.numPulses = eventIndex.size();
+  m_current.numEvents = numEvents;
+  m_current.eventIndexOffset = reserve(eventIndex.size() * sizeof(uint64_t));
+  m_current.eventIdOffset = reserve(numEvents * sizeof(uint32_t));
+  m_current.tofOffset = reserve(numEvents * sizeof(float));
+  m_current.weightOffset = haveWeights ? reserve(numEvents * sizeof(float)) : 0;
+  write(m_current.eventIndexOffset, eventIndex.data(),
+        eventIndex.size() * sizeof(uint64_t));
+  m_inBank = true;
+}
+
+//----------------------------------------------------------------------------------------------
+/** Write a slab of events of the current bank
+ * @param offset :: index in the bank of the first event
+ * @param eventId :: pixel IDs
+ * @param tof :: times-of-flight
+ * @param weight :: weights, or nullptr
+ * @param count :: number of events
+ * @throw std::invalid_argument if no bank was started or the events do not
+ * fit in it
+ */
+void EventNexusCacheWriter::writeEvents(const size_t offset,
+                                        const uint32_t *eventId,
+                                        const float *tof, const float *weight,
+                                        const size_t count) {
+  if (!m_inBank || offset + count > m_current.numEvents)
+    throw std::invalid_argument("Events written outside of a cached bank");
+  write(m_current.eventIdOffset + offset * sizeof(uint32_t), eventId,
+        count * sizeof(uint32_t));
+  write(m_current.tofOffset + offset * sizeof(float), tof,
+        count * sizeof(float));
+  if (weight && m_current.weightOffset != 0)
+    write(m_current.weightOffset + offset * sizeof(float), weight,
+          count * sizeof(float));
+}
+
+//----------------------------------------------------------------------------------------------
+/** Finish the current bank, which is then part of the cache
+ * @param haveWeights :: were weights written?
+ */
+void EventNexusCacheWriter::endBank(const bool haveWeights) {
+  if (!m_inBank)
+    return;
+  if (!haveWeights)
+    m_current.weightOffset = 0;
+  m_banks.push_back(m_current);
+  m_inBank = false;
+}
+
+//----------------------------------------------------------------------------------------------
+/** Write the table of banks and the header, and give the cache its final name
+ * @throw std::runtime_error if writing fails
+ */
+void EventNexusCacheWriter::commit() {
+  std::vector<char> table;
+  auto append = [&table](const void *data, size_t bytes) {
+    const char *begin = static_cast<const char *>(data);
+    table.insert(table.end(), begin, begin + bytes);
+  };
+  for (const auto &bank : m_banks) {
+    const uint64_t nameLength = bank.name.size();
+    append(&nameLength, sizeof(nameLength));
+    append(bank.name.data(), bank.name.size());
+    const uint64_t fields[NUM_BANK_FIELDS] = {
+        bank.numPulses, bank.numEvents, bank.eventIndexOffset,
+        bank.eventIdOffset, bank.tofOffset, bank.weightOffset};
+    append(fields, sizeof(fields));
+  }
+  append(MAGIC, sizeof(MAGIC));
+  const uint64_t tableOffset = reserve(table.size());
+  write(tableOffset, table.data(), table.size());
+
+  FileHeader header;
+  std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.version = EventNexusCache::Version;
+  header.byteOrder = BYTE_ORDER_MARK;
+  header.bankTableOffset = tableOffset;
+  header.numBanks = m_banks.size();
+  write(0, &header, sizeof(header));
+
+  const bool failed = !m_file;
+  m_file.close();
+  if (failed || m_file.fail())
+    throw std::runtime_error("Error writing event cache file " +
+                             m_tempFilename);
+  Poco::File(m_tempFilename).renameTo(m_filename);
+}
+
+/// Write bytes at an offset in the file. Errors are reported by commit().
+void EventNexusCacheWriter::write(const uint64_t offset, const void *data,
+                                  const size_t bytes) {
+  if (!m_file)
+    return;
+  m_file.seekp(static_cast<std::streamoff>(offset));
+  m_file.write(static_cast<const char *>(data),
+               static_cast<std::streamsize>(bytes));
+}
+
+/// Reserve space at the end of the file, aligned to 8 bytes
+uint64_t EventNexusCacheWriter::reserve(const size_t bytes) {
+  const uint64_t offset = align(m_end);
+  m_end = offset + bytes;
+  return offset;
+}
+
+} // namespace DataHandling
+} // namespace Mantid
@@ -8,10 +8,12 @@
 #include "MantidAPI/Run.h"
 #include "MantidAPI/Sample.h"
 #include "MantidAPI/SpectrumDetectorMapping.h"
+#include "MantidDataObjects/SplittersWorkspace.h"
 #include "MantidGeometry/Instrument.h"
 #include "MantidGeometry/Instrument/RectangularDetector.h"
 #include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/BoundedValidator.h"
+#include "MantidKernel/ListValidator.h"
 #include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/ThreadPool.h"
 #include "MantidKernel/ThreadSchedulerMutexes.h"
@@ -26,6 +28,8 @@
 #include <boost/shared_array.hpp>
 #include <boost/function.hpp>
 
+#include <Poco/File.h>
+
 #include <functional>
 
 using std::map;
@@ -107,6 +111,7 @@ public:
     m_cost = static_cast<double>(numEvents);
     m_min_id = std::numeric_limits<uint32_t>::max();
     m_max_id = 0;
+    m_splitAt = std::numeric_limits<uint32_t>::max();
   }
 
   //---------------------------------------------------------------------------------------------------
@@ -179,28 +184,30 @@ public:
   }
 
   //---------------------------------------------------------------------------------------------------
-  /** Open the event_id field and validate the contents
+  /** Open the event_id field, which has an older name in some files
   *
   * @param file :: File handle for the NeXus file
-  * @param start_event :: set to the index of the first event
-  * @param stop_event :: set to the index of the last event + 1
-  * @param event_index ::  (a list of size of # of pulses giving the index in
-  *the event list for that pulse)
   */
-  void prepareEventId(::NeXus::File &file, size_t &start_event,
-                      size_t &stop_event, std::vector<uint64_t> &event_index) {
-    // Get the list of pixel ID's
+  void openEventId(::NeXus::File &file) {
     if (m_oldNexusFileNames)
       file.openData("event_pixel_id");
     else
       file.openData("event_id");
+  }
 
+  //---------------------------------------------------------------------------------------------------
+  /** Work out the range of events to load
+  *
+  * @param dim0 :: the number of events in the bank
+  * @param start_event :: set to the index of the first event
+  * @param stop_event :: set to the index of the last event + 1
+  * @param event_index ::  (a list of size of # of pulses giving the index in
+  *the event list for that pulse)
+  */
+  void prepareEventId(const int64_t dim0, size_t &start_event,
+                      size_t &stop_event, std::vector<uint64_t> &event_index) {
     // By default, use all available indices
     start_event = 0;
-    ::NeXus::Info id_info = file.getInfo();
-    // dims[0] can be negative in ISIS meaning 2^32 + dims[0]. Take that into
-    // account
-    int64_t dim0 = recalculateDataSize(id_info.dims[0]);
     stop_event = static_cast<size_t>(dim0);
 
     // Handle the time filtering by changing the start/end offsets.
@@ -247,6 +254,60 @@ public:
                              << " stop_event " << stop_event << "\n";
   }
 
+  //---------------------------------------------------------------------------------------------------
+  /** Find the ranges of events to read: those between start_event and
+  * stop_event whose pulse time is in one of the algorithm's load intervals.
+  * Each pulse is looked up in the intervals, which are sorted, so that the
+  * pulse times do not need to be.
+  *
+  * @param dim0 :: the number of events in the bank
+  * @param start_event :: index of the first event that may be loaded
+  * @param stop_event :: index of the last event that may be loaded + 1
+  * @param event_index :: index of the first event of each pulse
+  * @return the first and last + 1 event of each range, in order
+  */
+  std::vector<std::pair<size_t, size_t>>
+  selectEventRanges(const size_t dim0, const size_t start_event,
+                    const size_t stop_event,
+                    const std::vector<uint64_t> &event_index) {
+    std::vector<std::pair<size_t, size_t>> ranges;
+    const auto &intervals = alg->m_loadIntervals;
+    if (intervals.empty()) {
+      if (stop_event > start_event)
+        ranges.emplace_back(start_event, stop_event);
+      return ranges;
+    }
+
+    const size_t numPulses =
+        std::min(event_index.size(), thisBankPulseTimes->numPulses);
+    for (size_t i = 0; i < numPulses; ++i) {
+      const DateAndTime &pulseTime = thisBankPulseTimes->pulseTimes[i];
+      // The first interval that ends after the pulse
+      const auto interval = std::upper_bound(
+          intervals.begin(), intervals.end(), pulseTime,
+          [](const DateAndTime &time, const SplittingInterval &interval) {
+            return time < interval.stop();
+          });
+      if (interval == intervals.end() || pulseTime < interval->start())
+        continue;
+      const size_t first =
+          std::max(static_cast<size_t>(event_index[i]), start_event);
+      const size_t last = std::min(
+          i + 1 < event_index.size() ? static_cast<size_t>(event_index[i + 1])
+                                     : dim0,
+          stop_event);
+      if (first >= last)
+        continue;
+      if (!ranges.empty() && ranges.back().second == first)
+        ranges.back().second = last;
+      else
+        ranges.emplace_back(first, last);
+    }
+    alg->getLogger().debug() << entry_name << ": " << ranges.size()
+                             << " ranges of events inside the splitters\n";
+    return ranges;
+  }
+
   //---------------------------------------------------------------------------------------------------
   /** Load the event_id field, which has been open
   */
@@ -282,26 +343,35 @@ public:
       }
       file.closeData();
 
-      // determine the range of pixel ids
-      for (auto i = 0; i < m_loadSize[0]; ++i) {
-        uint32_t temp = m_event_id[i];
-        if (temp < m_min_id)
-          m_min_id = temp;
-        if (temp > m_max_id)
-          m_max_id = temp;
-      }
+      this->findIdRange(m_event_id);
+    }
+  }
 
-      if (m_min_id > static_cast<uint32_t>(alg->eventid_max)) {
-        // All the detector IDs in the bank are higher than the highest 'known'
-        // (from the IDF)
-        // ID. Setting this will abort the loading of the bank.
-        m_loadError = true;
-      }
-      // fixup the maximum pixel id in the case that it's higher than the
-      // highest 'known' id
-      if (m_max_id > static_cast<uint32_t>(alg->eventid_max))
-        m_max_id = static_cast<uint32_t>(alg->eventid_max);
+  //---------------------------------------------------------------------------------------------------
+  /** Find the range of pixel IDs in the slab given by m_loadSize
+  *
+  * @param event_id :: the pixel IDs of the slab
+  */
+  void findIdRange(const uint32_t *event_id) {
+    // determine the range of pixel ids
+    for (auto i = 0; i < m_loadSize[0]; ++i) {
+      uint32_t temp = event_id[i];
+      if (temp < m_min_id)
+        m_min_id = temp;
+      if (temp > m_max_id)
+        m_max_id = temp;
+    }
+
+    if (m_min_id > static_cast<uint32_t>(alg->eventid_max)) {
+      // All the detector IDs in the bank are higher than the highest 'known'
+      // (from the IDF)
+      // ID. Setting this will abort the loading of the bank.
+      m_loadError = true;
     }
+    // fixup the maximum pixel id in the case that it's higher than the
+    // highest 'known' id
+    if (m_max_id > static_cast<uint32_t>(alg->eventid_max))
+      m_max_id = static_cast<uint32_t>(alg->eventid_max);
   }
 
   //---------------------------------------------------------------------------------------------------
@@ -398,9 +468,8 @@ public:
 
   //---------------------------------------------------------------------------------------------------
   void run() override {
-    // The vectors we will be filling
-    auto event_index_ptr = new std::vector<uint64_t>();
-    std::vector<uint64_t> &event_index = *event_index_ptr;
+    // The vector we will be filling
+    auto event_index = boost::make_shared<std::vector<uint64_t>>();
 
     // These give the limits in each file as to which events we actually load
     // (when filtering by time).
@@ -425,8 +494,16 @@ public:
       // Open the bankN_event group
       file.openGroup(entry_name, entry_type);
 
+      // Banks in the event cache are read from it rather than the file
+      const EventNexusCache::Bank *cached =
+          alg->m_eventCache ? alg->m_eventCache->bank(entry_name) : nullptr;
+
       // Load the event_index field.
-      this->loadEventIndex(file, event_index);
+      if (cached)
+        event_index->assign(cached->eventIndex,
+                            cached->eventIndex + cached->numPulses);
+      else
+        this->loadEventIndex(file, *event_index);
 
       if (!m_loadError) {
         // Load and validate the pulse times
@@ -434,39 +511,87 @@ public:
 
         // The event_index should be the same length as the pulse times from DAS
         // logs.
-        if (event_index.size() != thisBankPulseTimes->numPulses)
+        if (event_index->size() != thisBankPulseTimes->numPulses)
           alg->getLogger().warning()
               << "Bank " << entry_name
               << " has a mismatch between the number of event_index entries "
                  "and the number of pulse times in event_time_zero.\n";
 
-        // Open and validate event_id field.
+        // Get the number of events, opening the event_id field.
+        int64_t dim0;
+        if (cached) {
+          dim0 = static_cast<int64_t>(cached->numEvents);
+        } else {
+          this->openEventId(file);
+          // dims[0] can be negative in ISIS meaning 2^32 + dims[0]. Take that
+          // into account
+          dim0 = recalculateDataSize(file.getInfo().dims[0]);
+        }
         size_t start_event = 0;
         size_t stop_event = 0;
-        this->prepareEventId(file, start_event, stop_event, event_index);
-
-        // These are the arguments to getSlab()
-        m_loadStart[0] = static_cast<int>(start_event);
-        m_loadSize[0] = static_cast<int>(stop_event - start_event);
-
-        if ((m_loadSize[0] > 0) && (m_loadStart[0] >= 0)) {
-          // Load pixel IDs
-          this->loadEventId(file);
-          if (alg->getCancel())
-            m_loadError = true; // To allow cancelling the algorithm
-
-          // And TOF.
-          if (!m_loadError) {
-            this->loadTof(file);
-            if (m_have_weight) {
-              this->loadEventWeights(file);
-            }
-          }
-        } // Size is at least 1
-        else {
+        this->prepareEventId(dim0, start_event, stop_event, *event_index);
+        const auto eventRanges = this->selectEventRanges(
+            static_cast<size_t>(dim0), start_event, stop_event, *event_index);
+
+        // Read the events a slab at a time. Each slab is handed on to be
+        // processed while the next one is read. The cache is already in
+        // memory so each range of events is used in one go.
+        size_t totalEvents = 0;
+        for (const auto &range : eventRanges)
+          totalEvents += range.second - range.first;
+        const size_t eventsPerRead =
+            cached ? std::max(totalEvents, size_t(1)) : alg->m_eventsPerRead;
+        // Only whole banks are written to the event cache
+        EventNexusCacheWriter *cacheWriter =
+            (!cached && totalEvents == static_cast<size_t>(dim0))
+                ? alg->m_eventCacheWriter.get()
+                : nullptr;
+        if (cacheWriter)
+          cacheWriter->beginBank(entry_name, *event_index, totalEvents,
+                                 m_have_weight);
+        if (eventRanges.size() > 1 || totalEvents > eventsPerRead) {
+          // Slabs cover the same pixels so their processing must not overlap
+          m_processMutexes[0] = boost::make_shared<std::mutex>();
+          m_processMutexes[1] = boost::make_shared<std::mutex>();
+        }
+        if (totalEvents == 0)
           // Found a size that was 0 or less; stop processing
           m_loadError = true;
+        bool firstSlab = true;
+        for (const auto &range : eventRanges) {
+          size_t slabStart = range.first;
+          while (slabStart < range.second && !m_loadError) {
+            const size_t slabSize =
+                std::min(eventsPerRead, range.second - slabStart);
+            // These are the arguments to getSlab()
+            m_loadStart[0] = static_cast<int>(slabStart);
+            m_loadSize[0] = static_cast<int>(slabSize);
+
+            if ((m_loadSize[0] <= 0) || (m_loadStart[0] < 0)) {
+              // Found a size that was 0 or less; stop processing
+              m_loadError = true;
+              break;
+            }
+            // The first slab pre-counts events for the whole bank
+            const double precountFactor =
+                firstSlab ? static_cast<double>(totalEvents) /
+                                static_cast<double>(slabSize)
+                          : 0.;
+            if (cached) {
+              this->useCachedSlab(*cached, event_index, firstSlab,
+                                  precountFactor);
+            } else {
+              if (!firstSlab)
+                this->openEventId(file);
+              this->loadSlab(file, event_index, firstSlab, precountFactor,
+                             cacheWriter);
+            }
+            firstSlab = false;
+            slabStart += slabSize;
+          }
         }
+        if (cacheWriter && !m_loadError)
+          cacheWriter->endBank(m_have_weight);
 
       } // no error
 
@@ -486,18 +611,133 @@ public:
     file.closeGroup();
     file.close();
 
-    // Abort if anything failed
-    if (m_loadError) {
-      delete[] m_event_id;
-      delete[] m_event_time_of_flight;
+    // Free anything read before an error
+    delete[] m_event_id;
+    delete[] m_event_time_of_flight;
+    delete[] m_event_weight;
+  }
+
+  //---------------------------------------------------------------------------------------------------
+  /** Read the slab of events given by m_loadStart and m_loadSize, with the
+  * event_id field open, and hand it on to ProcessBankData tasks.
+  *
+  * @param file :: File handle for the NeXus file
+  * @param event_index :: the event_index of the bank
+  * @param firstSlab :: true for the first slab read from the bank
+  * @param precountFactor :: passed to ProcessBankData
+  * @param cacheWriter :: if not null, the events are also written to it
+  */
+  void loadSlab(::NeXus::File &file,
+                const boost::shared_ptr<std::vector<uint64_t>> &event_index,
+                const bool firstSlab, const double precountFactor,
+                EventNexusCacheWriter *cacheWriter) {
+    m_min_id = std::numeric_limits<uint32_t>::max();
+    m_max_id = 0;
+
+    // Load pixel IDs
+    this->loadEventId(file);
+    if (alg->getCancel())
+      m_loadError = true; // To allow cancelling the algorithm
+
+    // And TOF.
+    if (!m_loadError) {
+      this->loadTof(file);
       if (m_have_weight) {
-        delete[] m_event_weight;
+        this->loadEventWeights(file);
       }
-      delete event_index_ptr;
+    }
+    if (m_loadError)
+      return;
+    if (cacheWriter)
+      cacheWriter->writeEvents(
+          m_loadStart[0], m_event_id, m_event_time_of_flight,
+          m_have_weight ? m_event_weight : nullptr, m_loadSize[0]);
+
+    // convert things to shared_arrays. The event ids are used to keep count of
+    // the events in memory.
+    const size_t numEvents = m_loadSize[0];
+    LoadEventNexus *loader = alg;
+    loader->m_bufferedEvents += numEvents;
+    boost::shared_array<uint32_t> event_id_shrd(
+        m_event_id, [loader, numEvents](uint32_t *ids) {
+          delete[] ids;
+          loader->m_bufferedEvents -= numEvents;
+        });
+    boost::shared_array<float> event_time_of_flight_shrd(
+        m_event_time_of_flight);
+    boost::shared_array<float> event_weight_shrd(m_event_weight);
+    m_event_id = nullptr;
+    m_event_time_of_flight = nullptr;
+    m_event_weight = nullptr;
+
+    this->processSlab(event_id_shrd, event_time_of_flight_shrd,
+                      event_weight_shrd, event_index, firstSlab, precountFactor,
+                      true);
+  }
 
+  //---------------------------------------------------------------------------------------------------
+  /** Hand the events given by m_loadStart and m_loadSize of a bank in the
+  * event cache on to ProcessBankData tasks. The tasks use the cached arrays
+  * in place.
+  *
+  * @param cached :: the bank in the event cache
+  * @param event_index :: the event_index of the bank
+  * @param firstSlab :: true for the first slab used from the bank
+  * @param precountFactor :: passed to ProcessBankData
+  */
+  void
+  useCachedSlab(const EventNexusCache::Bank &cached,
+                const boost::shared_ptr<std::vector<uint64_t>> &event_index,
+                const bool firstSlab, const double precountFactor) {
+    m_min_id = std::numeric_limits<uint32_t>::max();
+    m_max_id = 0;
+    const size_t startAt = m_loadStart[0];
+    this->findIdRange(cached.eventId + startAt);
+    if (alg->getCancel())
+      m_loadError = true; // To allow cancelling the algorithm
+    if (m_loadError)
       return;
-    }
 
+    // The arrays keep the cache mapped until the tasks are done with them.
+    // They are only ever read.
+    auto cache = alg->m_eventCache;
+    boost::shared_array<uint32_t> event_id_shrd(
+        const_cast<uint32_t *>(cached.eventId + startAt),
+        [cache](uint32_t *) {});
+    boost::shared_array<float> event_time_of_flight_shrd(
+        const_cast<float *>(cached.tof + startAt), [cache](float *) {});
+    boost::shared_array<float> event_weight_shrd;
+    m_have_weight = cached.weight != nullptr;
+    if (m_have_weight)
+      event_weight_shrd.reset(const_cast<float *>(cached.weight + startAt),
+                              [cache](float *) {});
+
+    this->processSlab(event_id_shrd, event_time_of_flight_shrd,
+                      event_weight_shrd, event_index, firstSlab,
+                      precountFactor, false);
+  }
+
+  //---------------------------------------------------------------------------------------------------
+  /** Launch the ProcessBankData tasks for the slab of events given by
+  * m_loadStart and m_loadSize, whose pixel ID range has been found.
+  *
+  * @param event_id_shrd :: pixel IDs of the slab
+  * @param event_time_of_flight_shrd :: times-of-flight of the slab
+  * @param event_weight_shrd :: weights of the slab, if m_have_weight
+  * @param event_index :: the event_index of the bank
+  * @param firstSlab :: true for the first slab of the bank
+  * @param precountFactor :: passed to ProcessBankData
+  * @param buffered :: true if the slab was read into memory and counts
+  *towards the events buffered by the algorithm
+  */
+  void processSlab(const boost::shared_array<uint32_t> &event_id_shrd,
+                   const boost::shared_array<float> &event_time_of_flight_shrd,
+                   const boost::shared_array<float> &event_weight_shrd,
+                   const boost::shared_ptr<std::vector<uint64_t>> &event_index,
+                   const bool firstSlab, const double precountFactor,
+                   const bool buffered) {
+    const size_t numEvents = m_loadSize[0];
+    const size_t startAt = m_loadStart[0];
     const auto bank_size = m_max_id - m_min_id;
     const uint32_t minSpectraToLoad = static_cast<uint32_t>(alg->m_specMin);
     const uint32_t maxSpectraToLoad = static_cast<uint32_t>(alg->m_specMax);
@@ -526,35 +766,50 @@ public:
       return;
     }
 
-    // schedule the job to generate the event lists
-    auto mid_id = m_max_id;
-    if (alg->splitProcessing && m_max_id > (m_min_id + (bank_size / 4)))
-      // only split if told to and the section to load is at least 1/4 the size
-      // of the whole bank
-      mid_id = (m_max_id + m_min_id) / 2;
-
-    // No error? Launch a new task to process that data.
-    size_t numEvents = m_loadSize[0];
-    size_t startAt = m_loadStart[0];
+    // Choose where to split the pixels between two jobs from the first slab,
+    // so that later slabs of the bank use the same ranges.
+    if (firstSlab) {
+      m_splitAt = std::numeric_limits<uint32_t>::max();
+      if (alg->splitProcessing && m_max_id > (m_min_id + (bank_size / 4)))
+        // only split if told to and the section to load is at least 1/4 the
+        // size of the whole bank
+        m_splitAt = (m_max_id + m_min_id) / 2;
+    }
 
-    // convert things to shared_arrays
-    boost::shared_array<uint32_t> event_id_shrd(m_event_id);
-    boost::shared_array<float> event_time_of_flight_shrd(
-        m_event_time_of_flight);
-    boost::shared_array<float> event_weight_shrd(m_event_weight);
-    boost::shared_ptr<std::vector<uint64_t>> event_index_shrd(event_index_ptr);
-
-    ProcessBankData *newTask1 = new ProcessBankData(
-        alg, entry_name, prog, event_id_shrd, event_time_of_flight_shrd,
-        numEvents, startAt, event_index_shrd, thisBankPulseTimes, m_have_weight,
-        event_weight_shrd, m_min_id, mid_id);
-    scheduler->push(newTask1);
-    if (alg->splitProcessing && (mid_id < m_max_id)) {
-      ProcessBankData *newTask2 = new ProcessBankData(
+    // No error? Launch new tasks to process that data.
+    std::vector<ProcessBankData *> newTasks;
+    if (m_min_id <= m_splitAt) {
+      newTasks.push_back(new ProcessBankData(
+          alg, entry_name, prog, event_id_shrd, event_time_of_flight_shrd,
+          numEvents, startAt, event_index, thisBankPulseTimes, m_have_weight,
+          event_weight_shrd, m_min_id, std::min(m_max_id, m_splitAt),
+          precountFactor));
+      newTasks.back()->setMutex(m_processMutexes[0]);
+    }
+    if (m_max_id > m_splitAt) {
+      newTasks.push_back(new ProcessBankData(
           alg, entry_name, prog, event_id_shrd, event_time_of_flight_shrd,
-          numEvents, startAt, event_index_shrd, thisBankPulseTimes,
-          m_have_weight, event_weight_shrd, (mid_id + 1), m_max_id);
-      scheduler->push(newTask2);
+          numEvents, startAt, event_index, thisBankPulseTimes, m_have_weight,
+          event_weight_shrd, std::max(m_min_id, m_splitAt + 1), m_max_id,
+          precountFactor));
+      newTasks.back()->setMutex(m_processMutexes[1]);
+    }
+
+    if (!buffered || alg->m_bufferedEvents <= alg->m_maxBufferedEvents) {
+      for (auto task : newTasks)
+        scheduler->push(task);
+      return;
+    }
+    // Reading is too far ahead of processing: process this slab now, which
+    // stops any more being read until it is done.
+    for (auto task : newTasks) {
+      if (task->getMutex()) {
+        std::lock_guard<std::mutex> lock(*task->getMutex());
+        task->run();
+      } else {
+        task->run();
+      }
+      delete task;
     }
   }
 
@@ -600,6 +855,11 @@ private:
   uint32_t m_min_id;
   /// Maximum pixel ID in this data
   uint32_t m_max_id;
+  /// Pixel IDs above this are processed by a second task
+  uint32_t m_splitAt;
+  /// Mutexes of the tasks processing each half of the pixels. Null unless the
+  /// bank is read in several slabs.
+  boost::shared_ptr<std::mutex> m_processMutexes[2];
   /// TOF data
   float *m_event_time_of_flight;
   /// Flag for simulated data
@@ -623,13 +883,14 @@ LoadEventNexus::LoadEventNexus()
       filter_time_start(), filter_time_stop(), chunk(0), totalChunks(0),
       firstChunkForBank(0), eventsPerChunk(0), m_tofMutex(), longest_tof(0),
       shortest_tof(0), bad_tofs(0), discarded_events(0), precount(0),
-      compressTolerance(0), eventVectors(), m_eventVectorMutex(),
-      eventid_max(0), pixelID_to_wi_vector(), pixelID_to_wi_offset(),
-      m_bankPulseTimes(), m_allBanksPulseTimes(), m_top_entry_name(),
-      m_file(nullptr), splitProcessing(false), m_haveWeights(false),
-      weightedEventVectors(), m_instrument_loaded_correctly(false),
-      loadlogs(false), m_logs_loaded_correctly(false), event_id_is_spec(false) {
-}
+      compressTolerance(0), m_compressLogarithmic(false),
+      m_compactEvents(false), m_eventsPerRead(0), m_maxBufferedEvents(0),
+      m_bufferedEvents(0), eventVectors(), m_eventVectorMutex(), eventid_max(0),
+      pixelID_to_wi_vector(), pixelID_to_wi_offset(), m_bankPulseTimes(),
+      m_allBanksPulseTimes(), m_top_entry_name(), m_file(nullptr),
+      splitProcessing(false), m_haveWeights(false), weightedEventVectors(),
+      m_instrument_loaded_correctly(false), loadlogs(false),
+      m_logs_loaded_correctly(false), event_id_is_spec(false) {}
 
 //----------------------------------------------------------------------------------------------
 /** Destructor */
@@ -704,11 +965,19 @@ void LoadEventNexus::init() {
                   "Optional: To only include events before the provided stop "
                   "time, in seconds (relative to the start of the run).");
 
+  declareProperty(make_unique<WorkspaceProperty<SplittersWorkspace>>(
+                      "SplitterWorkspace", "", Direction::Input,
+                      PropertyMode::Optional),
+                  "Optional: To only include events whose pulse time is in "
+                  "one of the intervals of the splitters. Only the events of "
+                  "those pulses are read from the file.");
+
   std::string grp1 = "Filter Events";
   setPropertyGroup("FilterByTofMin", grp1);
   setPropertyGroup("FilterByTofMax", grp1);
   setPropertyGroup("FilterByTimeStart", grp1);
   setPropertyGroup("FilterByTimeStop", grp1);
+  setPropertyGroup("SplitterWorkspace", grp1);
 
   declareProperty(
       make_unique<ArrayProperty<string>>("BankName", Direction::Input),
@@ -741,7 +1010,24 @@ void LoadEventNexus::init() {
                   "Run CompressEvents while loading (optional, leave blank or "
                   "negative to not do). "
                   "This specified the tolerance to use (in microseconds) when "
-                  "compressing.");
+                  "compressing. Events are compressed as they are read, so the "
+                  "uncompressed events of a bank are never all held at once.");
+
+  declareProperty(
+      "CompressBinningMode", "Linear",
+      boost::make_shared<StringListValidator>(
+          std::vector<std::string>{"Linear", "Logarithmic"}),
+      "Whether CompressTolerance is in microseconds (Linear) or relative to "
+      "the time-of-flight of the events (Logarithmic).");
+
+  declareProperty(
+      make_unique<PropertyWithValue<bool>>("CompactEvents", false,
+                                           Direction::Input),
+      "Store each event as a single-precision time-of-flight and an index "
+      "into the pulse times of its bank (optional, default False). "
+      "This halves the memory used by un-weighted events. Operations other "
+      "than sorting, histogramming and integrating in time-of-flight convert "
+      "the events back to the full representation.");
 
   auto mustBePositive = boost::make_shared<BoundedValidator<int>>();
   mustBePositive->setLower(1);
@@ -757,11 +1043,35 @@ void LoadEventNexus::init() {
   setPropertySettings("TotalChunks", make_unique<VisibleWhenProperty>(
                                          "ChunkNumber", IS_NOT_DEFAULT));
 
+  declareProperty("EventsPerRead", 10000000, mustBePositive,
+                  "The largest number of events read from a bank at a time "
+                  "(optional). Larger banks are read in parts, and each part "
+                  "is processed while the next one is read.");
+  declareProperty("MaxBufferedEvents", 100000000, mustBePositive,
+                  "The most events to hold in memory between reading and "
+                  "processing (optional). When reading gets this far ahead, "
+                  "the events that were just read are processed before "
+                  "reading more.");
+
   std::string grp3 = "Reduce Memory Use";
   setPropertyGroup("Precount", grp3);
   setPropertyGroup("CompressTolerance", grp3);
+  setPropertyGroup("CompressBinningMode", grp3);
+  setPropertyGroup("CompactEvents", grp3);
   setPropertyGroup("ChunkNumber", grp3);
   setPropertyGroup("TotalChunks", grp3);
+  setPropertyGroup("EventsPerRead", grp3);
+  setPropertyGroup("MaxBufferedEvents", grp3);
+
+  declareProperty(
+      make_unique<FileProperty>("EventCacheDirectory", "",
+                                FileProperty::OptionalDirectory),
+      "Directory holding a cache of the raw events of the files loaded "
+      "(optional). The first load of a file without time filtering or "
+      "chunking writes its events to the cache; later loads of the file read "
+      "them from the cache instead of decompressing them again. The cache "
+      "uses about as much disk space as the uncompressed events.");
+  setPropertyGroup("EventCacheDirectory", grp3);
 
   declareProperty(make_unique<PropertyWithValue<bool>>("LoadMonitors", false,
                                                        Direction::Input),
@@ -935,6 +1245,13 @@ void LoadEventNexus::exec() {
 
   precount = getProperty("Precount");
   compressTolerance = getProperty("CompressTolerance");
+  m_compressLogarithmic =
+      getPropertyValue("CompressBinningMode") == "Logarithmic";
+  m_compactEvents = getProperty("CompactEvents");
+  const int eventsPerRead = getProperty("EventsPerRead");
+  m_eventsPerRead = static_cast<size_t>(eventsPerRead);
+  const int maxBufferedEvents = getProperty("MaxBufferedEvents");
+  m_maxBufferedEvents = static_cast<size_t>(maxBufferedEvents);
 
   loadlogs = getProperty("LoadLogs");
 
@@ -1416,6 +1733,19 @@ void LoadEventNexus::loadEvents(API::Progress *const prog,
     m_ws->mutableRun().filterByTime(filter_time_start, filter_time_stop);
   }
 
+  // Only read the pulses inside the splitters, if any
+  m_loadIntervals.clear();
+  SplittersWorkspace_sptr splitters = getProperty("SplitterWorkspace");
+  if (splitters && !monitors) {
+    for (size_t i = 0; i < splitters->getNumberSplitters(); ++i)
+      m_loadIntervals.push_back(splitters->getSplitter(i));
+    // Sort the intervals and merge any that overlap
+    m_loadIntervals = m_loadIntervals | TimeSplitterType();
+    if (m_loadIntervals.empty())
+      g_log.warning() << "The splitters have no intervals, so all events are "
+                         "loaded.\n";
+  }
+
   if (metaDataOnly) {
     // Now, create a default X-vector for histogramming, with just 2 bins.
     auto axis = HistogramData::BinEdges{
@@ -1498,6 +1828,13 @@ void LoadEventNexus::loadEvents(API::Progress *const prog,
       static_cast<double>(std::numeric_limits<uint32_t>::max()) * 0.1;
   longest_tof = 0.;
 
+  // Nothing has been read yet
+  m_bufferedEvents = 0;
+
+  if (!monitors && !metaDataOnly)
+    openEventCache(is_time_filtered || chunk != EMPTY_INT() ||
+                   !m_loadIntervals.empty());
+
   // Make the thread pool
   ThreadScheduler *scheduler = new ThreadSchedulerMutexes();
   ThreadPool pool(scheduler);
@@ -1571,9 +1908,15 @@ void LoadEventNexus::loadEvents(API::Progress *const prog,
       bool(bankNames.size() * 2 < ThreadPool::getNumPhysicalCores());
 
   // set up progress bar for the rest of the (multi-threaded) process
-  size_t numProg = bankNames.size() * (1 + 3); // 1 = disktask, 3 = proc task
-  if (splitProcessing)
-    numProg += bankNames.size() * 3; // 3 = second proc task
+  size_t numProg = 0;
+  for (size_t i = bank0; i < bankn; i++) {
+    // Banks are read in slabs of up to m_eventsPerRead events
+    const size_t numSlabs = std::max(
+        size_t(1), (bankNumEvents[i] + m_eventsPerRead - 1) / m_eventsPerRead);
+    numProg += 1 + 3 * numSlabs; // 1 = disktask, 3 = proc task
+    if (splitProcessing)
+      numProg += 3 * numSlabs; // 3 = second proc task
+  }
   auto prog2 = new Progress(this, 0.3, 1.0, numProg);
 
   const std::vector<int> periodLogVec = periodLog->valuesAsVector();
@@ -1589,6 +1932,25 @@ void LoadEventNexus::loadEvents(API::Progress *const prog,
   pool.joinAll();
   diskIOMutex.reset();
   delete prog2;
+  commitEventCache();
+
+  // Each slab of a bank was compressed on its own. Lists that got events
+  // from several slabs are compressed once more to merge their groups.
+  if (compressTolerance >= 0) {
+    const double tolerance =
+        m_compressLogarithmic ? -compressTolerance : compressTolerance;
+    const auto numHistograms =
+        static_cast<int64_t>(m_ws->getNumberHistograms());
+    for (size_t period = 0; period < m_ws->nPeriods(); ++period) {
+      PARALLEL_FOR_NO_WSP_CHECK()
+      for (int64_t i = 0; i < numHistograms; ++i) {
+        auto &el = m_ws->getSpectrum(i, period);
+        if (el.getEventType() == API::WEIGHTED_NOTIME &&
+            el.getSortType() != DataObjects::TOF_SORT)
+          el.compressEvents(tolerance, &el);
+      }
+    }
+  }
 
   // Info reporting
   const std::size_t eventsLoaded = m_ws->getNumberEvents();
@@ -1638,6 +2000,60 @@ void LoadEventNexus::loadEvents(API::Progress *const prog,
   loadTimeOfFlight(m_ws, m_top_entry_name, classType);
 }
 
+//-----------------------------------------------------------------------------
+/** Open the cache of raw events named by EventCacheDirectory, if any. If there
+* is no valid cache and every event is to be loaded, start writing one.
+*
+* @param filtered :: true if only some of the events are loaded
+*/
+void LoadEventNexus::openEventCache(const bool filtered) {
+  m_eventCache.reset();
+  m_eventCacheWriter.reset();
+  const std::string directory = getPropertyValue("EventCacheDirectory");
+  if (directory.empty())
+    return;
+
+  try {
+    const std::string cacheFilename =
+        EventNexusCache::cacheFilename(directory, m_filename, m_top_entry_name);
+    m_eventCache = EventNexusCache::open(cacheFilename);
+    if (m_eventCache) {
+      g_log.information() << "Reading the events of "
+                          << m_eventCache->numBanks() << " banks from "
+                          << cacheFilename << "\n";
+    } else if (filtered) {
+      g_log.information() << "Not writing an event cache as only some of the "
+                             "events are loaded.\n";
+    } else {
+      Poco::File(directory).createDirectories();
+      m_eventCacheWriter = make_unique<EventNexusCacheWriter>(cacheFilename);
+    }
+  } catch (std::exception &e) {
+    // The cache only saves time, so carry on without it
+    g_log.warning() << "Unable to use the event cache in " << directory << ": "
+                    << e.what() << "\n";
+    m_eventCache.reset();
+    m_eventCacheWriter.reset();
+  }
+}
+
+//-----------------------------------------------------------------------------
+/** Finish writing the cache of raw events, if one was started, and release
+* the cache that was read from.
+*/
+void LoadEventNexus::commitEventCache() {
+  m_eventCache.reset();
+  if (!m_eventCacheWriter)
+    return;
+  try {
+    m_eventCacheWriter->commit();
+    g_log.information() << "Wrote the event cache of " << m_filename << "\n";
+  } catch (std::exception &e) {
+    g_log.warning() << "Unable to write the event cache: " << e.what() << "\n";
+  }
+  m_eventCacheWriter.reset();
+}
+
 //-----------------------------------------------------------------------------
 /** Load the instrument from the nexus file
 *
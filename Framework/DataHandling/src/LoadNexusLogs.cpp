@@ -69,6 +69,22 @@ bool loadAndApplyMeasurementInfo(::NeXus::File *const file,
   }
   return successfullyApplied;
 }
+
+/**
+ * Compress a log if it is a time series of one of the types loaded from files
+ * @param log : the log to compress
+ */
+void compressLog(Kernel::Property *log) {
+  if (auto doubleLog = dynamic_cast<TimeSeriesProperty<double> *>(log))
+    doubleLog->compress();
+  else if (auto intLog = dynamic_cast<TimeSeriesProperty<int> *>(log))
+    intLog->compress();
+  else if (auto boolLog = dynamic_cast<TimeSeriesProperty<bool> *>(log))
+    boolLog->compress();
+  else if (auto stringLog =
+               dynamic_cast<TimeSeriesProperty<std::string> *>(log))
+    stringLog->compress();
+}
 }
 
 /// Empty default constructor
@@ -93,6 +109,11 @@ void LoadNexusLogs::init() {
   declareProperty(make_unique<PropertyWithValue<std::string>>("NXentryName", "",
                                                               Direction::Input),
                   "Entry in the nexus file from which to read the logs");
+  declareProperty(
+      make_unique<PropertyWithValue<bool>>("CompressLogs", false,
+                                           Direction::Input),
+      "If true, the time series logs are stored compressed. They take less "
+      "memory and are unpacked when they are first used.");
 }
 
 /** Executes the algorithm. Reading in the file and creating and populating
@@ -278,6 +299,12 @@ void LoadNexusLogs::exec() {
     }
   }
 
+  const bool compressLogs = getProperty("CompressLogs");
+  if (compressLogs) {
+    for (auto log : workspace->run().getProperties())
+      compressLog(log);
+  }
+
   // Close the file
   file.close();
 }
@@ -1,5 +1,7 @@
 #include "MantidDataHandling/ProcessBankData.h"
 
+#include <algorithm>
+
 using namespace Mantid::DataObjects;
 
 namespace Mantid {
@@ -12,7 +14,7 @@ ProcessBankData::ProcessBankData(
     size_t startAt, boost::shared_ptr<std::vector<uint64_t>> event_index,
     boost::shared_ptr<BankPulseTimes> thisBankPulseTimes, bool have_weight,
     boost::shared_array<float> event_weight, detid_t min_event_id,
-    detid_t max_event_id)
+    detid_t max_event_id, double precountFactor)
     : Task(), alg(alg), entry_name(entry_name),
       pixelID_to_wi_vector(alg->pixelID_to_wi_vector),
       pixelID_to_wi_offset(alg->pixelID_to_wi_offset), prog(prog),
@@ -20,7 +22,7 @@ ProcessBankData::ProcessBankData(
       numEvents(numEvents), startAt(startAt), event_index(event_index),
       thisBankPulseTimes(thisBankPulseTimes), have_weight(have_weight),
       event_weight(event_weight), m_min_id(min_event_id),
-      m_max_id(max_event_id) {
+      m_max_id(max_event_id), m_precountFactor(precountFactor) {
   // Cost is approximately proportional to the number of events to process.
   m_cost = static_cast<double>(numEvents);
 }
@@ -38,10 +40,37 @@ void ProcessBankData::run() { // override {
   size_t badTofs = 0;
   size_t my_discarded_events(0);
 
+  auto &outputWS = *(alg->m_ws);
+
+  // And there are this many pulses
+  int numPulses = static_cast<int>(thisBankPulseTimes->numPulses);
+
+  // Will we need to compress?
+  const bool compress = (alg->compressTolerance >= 0);
+
+  // Compact events refer to the pulse times by index, so every event must
+  // have a pulse of its own.
+  const bool compact =
+      alg->m_compactEvents && !compress && !have_weight && numPulses > 1 &&
+      numPulses <= static_cast<int>(event_index->size());
+  // Index = [period][pixel ID - m_min_id]; value = compact event vector.
+  std::vector<std::vector<std::vector<CompactTofEvent> *>> compactVectors;
+  if (compact)
+    compactVectors = makeCompactEventVectors();
+
+  // When compressing, the events of this task are kept here, index =
+  // [period][pixel ID - m_min_id], and merged into the compressed event lists
+  // at the end so only the compressed events are ever held for the bank.
+  std::vector<std::vector<std::vector<WeightedEventNoTime>>> pendingEvents;
+  if (compress)
+    pendingEvents.resize(
+        outputWS.nPeriods(),
+        std::vector<std::vector<WeightedEventNoTime>>(m_max_id - m_min_id + 1));
+
   prog->report(entry_name + ": precount");
   // ---- Pre-counting events per pixel ID ----
-  auto &outputWS = *(alg->m_ws);
-  if (alg->precount) {
+  // Compressed lists end up much smaller than the raw event count.
+  if (alg->precount && m_precountFactor > 0. && !compress) {
 
     std::vector<size_t> counts(m_max_id - m_min_id + 1, 0);
     for (size_t i = 0; i < numEvents; i++) {
@@ -59,7 +88,10 @@ void ProcessBankData::run() { // override {
         size_t wi = pixelID_to_wi_vector[pixID + pixelID_to_wi_offset];
         // Allocate it
         if (wi < numEventLists) {
-          outputWS.reserveEventListAt(wi, counts[pixID - m_min_id]);
+          outputWS.reserveEventListAt(
+              wi, static_cast<size_t>(
+                      static_cast<double>(counts[pixID - m_min_id]) *
+                      m_precountFactor));
         }
         if (alg->getCancel())
           break; // User cancellation
@@ -83,8 +115,6 @@ void ProcessBankData::run() { // override {
   // Index into the pulse array
   int pulse_i = 0;
 
-  // And there are this many pulses
-  int numPulses = static_cast<int>(thisBankPulseTimes->numPulses);
   if (numPulses > static_cast<int>(event_index->size())) {
     alg->getLogger().warning()
         << "Entry " << entry_name
@@ -93,18 +123,17 @@ void ProcessBankData::run() { // override {
            "entry.\n";
     // This'll make the code skip looking for any pulse times.
     pulse_i = numPulses + 1;
+  } else if (startAt > 0) {
+    // Start the search for pulses from the one holding the first event,
+    // rather than walking up from the first pulse of the bank.
+    auto firstPulse = std::upper_bound(
+        event_index->cbegin(), event_index->cbegin() + numPulses, startAt);
+    if (firstPulse != event_index->cbegin())
+      pulse_i = static_cast<int>(firstPulse - event_index->cbegin()) - 1;
   }
 
   prog->report(entry_name + ": filling events");
 
-  // Will we need to compress?
-  bool compress = (alg->compressTolerance >= 0);
-
-  // Which detector IDs were touched? - only matters if compress is on
-  std::vector<bool> usedDetIds;
-  if (compress)
-    usedDetIds.assign(m_max_id - m_min_id + 1, false);
-
   // Go through all events in the list
   for (std::size_t i = 0; i < numEvents; i++) {
     //------ Find the pulse time for this event index ---------
@@ -150,8 +179,22 @@ void ProcessBankData::run() { // override {
       // Create the tofevent
       double tof = static_cast<double>(event_time_of_flight[i]);
       if ((tof >= alg->filter_tof_min) && (tof <= alg->filter_tof_max)) {
-        // Handle simulated data if present
-        if (have_weight) {
+        if (compress) {
+          // NULL eventVector indicates a bad spectrum lookup
+          const bool goodSpectrum =
+              have_weight ? alg->weightedEventVectors[periodIndex][detId] !=
+                                nullptr
+                          : alg->eventVectors[periodIndex][detId] != nullptr;
+          if (goodSpectrum) {
+            const double weight =
+                have_weight ? static_cast<double>(event_weight[i]) : 1.;
+            pendingEvents[periodIndex][detId - m_min_id].emplace_back(
+                tof, weight, weight * weight);
+          } else {
+            ++my_discarded_events;
+          }
+        } else if (have_weight) {
+          // Handle simulated data if present
           double weight = static_cast<double>(event_weight[i]);
           double errorSq = weight * weight;
           LoadEventNexus::WeightedEventVector_pt eventVector =
@@ -162,6 +205,10 @@ void ProcessBankData::run() { // override {
           } else {
             ++my_discarded_events;
           }
+        } else if (compact &&
+                   compactVectors[periodIndex][detId - m_min_id]) {
+          compactVectors[periodIndex][detId - m_min_id]->emplace_back(
+              event_time_of_flight[i], static_cast<uint32_t>(pulse_i));
         } else {
           // We have cached the vector of events for this detector ID
           std::vector<Mantid::DataObjects::TofEvent> *eventVector =
@@ -186,31 +233,40 @@ void ProcessBankData::run() { // override {
           }
         } else
           badTofs++;
-
-        // Track all the touched wi (only necessary when compressing events,
-        // for thread safety)
-        if (compress)
-          usedDetIds[detId - m_min_id] = true;
       } // valid time-of-flight
 
     } // valid detector IDs
   }   //(for each event)
 
-  //------------ Compress Events (or set sort order) ------------------
-  // Do it on all the detector IDs we touched
+  //------------ Compress Events ------------------
+  // Compress the events of this slab on their own and append them to the
+  // lists of the pixels. Lists that get events from several slabs are left
+  // unsorted, and LoadEventNexus compresses them once all banks are loaded.
   if (compress) {
-    for (detid_t pixID = m_min_id; pixID <= m_max_id; pixID++) {
-      if (usedDetIds[pixID - m_min_id]) {
+    const double tolerance = alg->m_compressLogarithmic
+                                 ? -alg->compressTolerance
+                                 : alg->compressTolerance;
+    for (size_t period = 0; period < pendingEvents.size(); ++period) {
+      for (detid_t pixID = m_min_id; pixID <= m_max_id; pixID++) {
+        auto &pending = pendingEvents[period][pixID - m_min_id];
+        if (pending.empty())
+          continue;
         // Find the the workspace index corresponding to that pixel ID
         size_t wi = pixelID_to_wi_vector[pixID + pixelID_to_wi_offset];
-        auto &el = outputWS.getSpectrum(wi);
-        if (compress)
-          el.compressEvents(alg->compressTolerance, &el);
-        else {
-          if (pulsetimesincreasing)
-            el.setSortOrder(DataObjects::PULSETIME_SORT);
-          else
-            el.setSortOrder(DataObjects::UNSORTED);
+        auto &el = outputWS.getSpectrum(wi, period);
+        EventList slab;
+        slab.switchTo(API::WEIGHTED_NOTIME);
+        slab.getWeightedEventsNoTime().swap(pending);
+        slab.compressEvents(tolerance, &slab);
+        el.switchTo(API::WEIGHTED_NOTIME);
+        auto &events = el.getWeightedEventsNoTime();
+        if (events.empty()) {
+          events.swap(slab.getWeightedEventsNoTime());
+          el.setSortOrder(DataObjects::TOF_SORT);
+        } else {
+          const auto &compressed = slab.getWeightedEventsNoTime();
+          events.insert(events.end(), compressed.begin(), compressed.end());
+          el.setSortOrder(DataObjects::UNSORTED);
         }
       }
     }
@@ -242,5 +298,45 @@ void ProcessBankData::run() { // override {
 #endif
 } // END-OF-RUN()
 
+//----------------------------------------------------------------------------------------------
+/** Switch the event lists of the pixels handled by this task to compact
+ * events that share the pulse times of the bank.
+ * Pixels that can't be switched (because the list already has events) keep
+ * using the regular TofEvent vectors of LoadEventNexus.
+ * @return the compact event vectors. Index = [period][pixel ID - m_min_id].
+ */
+std::vector<std::vector<std::vector<CompactTofEvent> *>>
+ProcessBankData::makeCompactEventVectors() {
+  auto &outputWS = *(alg->m_ws);
+  const size_t numEventLists = outputWS.getNumberHistograms();
+  const size_t numPeriods = outputWS.nPeriods();
+  std::vector<std::vector<std::vector<CompactTofEvent> *>> compactVectors(
+      numPeriods, std::vector<std::vector<CompactTofEvent> *>(
+                      m_max_id - m_min_id + 1, nullptr));
+
+  // Share the pulse times with the BankPulseTimes that owns them
+  PulseTimeTable_const_sptr pulseTimes(thisBankPulseTimes,
+                                       &thisBankPulseTimes->pulseTimes);
+  for (detid_t pixID = m_min_id; pixID <= m_max_id; pixID++) {
+    const detid_t index = pixID + pixelID_to_wi_offset;
+    if (index < 0 || static_cast<size_t>(index) >= pixelID_to_wi_vector.size())
+      continue;
+    const size_t wi = pixelID_to_wi_vector[index];
+    if (wi >= numEventLists)
+      continue;
+    for (size_t period = 0; period < numPeriods; ++period) {
+      // Only pixels that would otherwise be loaded
+      if (!alg->eventVectors[period][pixID])
+        continue;
+      auto &el = outputWS.getSpectrum(wi, period);
+      if (el.switchToCompactEvents(pulseTimes))
+        compactVectors[period][pixID - m_min_id] = &el.getCompactEvents();
+      else
+        el.getEvents(); // Expands any compact events from another bank
+    }
+  }
+  return compactVectors;
+}
+
 } // namespace Mantid{
 } // namespace DataHandling{
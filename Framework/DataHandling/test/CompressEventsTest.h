@@ -116,6 +116,35 @@ public:
   void test_InPlace_Parallel() {
     doTest("CompressEvents_input", "CompressEvents_input", 0.5, 1);
   }
+
+  void test_Logarithmic() {
+    // Two events at each of 0.5, 1.5, ... 99.5
+    EventWorkspace_sptr input =
+        WorkspaceCreationHelper::CreateEventWorkspace(2, 100, 100, 0.0, 1.0, 2);
+    AnalysisDataService::Instance().addOrReplace("CompressEvents_input", input);
+
+    CompressEvents alg;
+    alg.initialize();
+    alg.setPropertyValue("InputWorkspace", "CompressEvents_input");
+    alg.setPropertyValue("OutputWorkspace", "CompressEvents_output");
+    alg.setProperty("Tolerance", 0.02);
+    alg.setPropertyValue("BinningMode", "Logarithmic");
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    TS_ASSERT(alg.isExecuted());
+
+    EventWorkspace_sptr output =
+        AnalysisDataService::Instance().retrieveWS<EventWorkspace>(
+            "CompressEvents_output");
+    // Only events 2% apart are merged: those from 50.5 on pair up
+    TS_ASSERT_EQUALS(output->getSpectrum(0).getNumberEvents(), 75);
+    const auto &events = output->getSpectrum(0).getWeightedEventsNoTime();
+    TS_ASSERT_DELTA(events[49].tof(), 49.5, 1e-6);
+    TS_ASSERT_DELTA(events[49].weight(), 2.0, 1e-6);
+    TS_ASSERT_DELTA(events[50].tof(), 51.0, 1e-6);
+    TS_ASSERT_DELTA(events[50].weight(), 4.0, 1e-6);
+    AnalysisDataService::Instance().remove("CompressEvents_input");
+    AnalysisDataService::Instance().remove("CompressEvents_output");
+  }
 };
 
 #endif
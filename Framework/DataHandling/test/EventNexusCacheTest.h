@@ -0,0 +1,144 @@
+#ifndef MANTID_DATAHANDLING_EVENTNEXUSCACHETEST_H_
+#define MANTID_DATAHANDLING_EVENTNEXUSCACHETEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidDataHandling/EventNexusCache.h"
+
+#include <Poco/File.h>
+#include <Poco/Path.h>
+
+#include <fstream>
+
+using Mantid::DataHandling::EventNexusCache;
+using Mantid::DataHandling::EventNexusCacheWriter;
+
+class EventNexusCacheTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static EventNexusCacheTest *createSuite() {
+    return new EventNexusCacheTest();
+  }
+  static void destroySuite(EventNexusCacheTest *suite) { delete suite; }
+
+  EventNexusCacheTest()
+      : m_filename(
+            Poco::Path(Poco::Path::temp(), "EventNexusCacheTest.eventcache")
+                .toString()) {}
+
+  void tearDown() override {
+    Poco::File file(m_filename);
+    if (file.exists())
+      file.remove();
+  }
+
+  void test_banks_written_in_slabs_are_read_back() {
+    {
+      EventNexusCacheWriter writer(m_filename);
+      writer.beginBank("bank1_events", {0, 2, 3}, 4, false);
+      const uint32_t ids[] = {10, 11, 12, 13};
+      const float tofs[] = {1.f, 2.f, 3.f, 4.f};
+      writer.writeEvents(2, ids + 2, tofs + 2, nullptr, 2);
+      writer.writeEvents(0, ids, tofs, nullptr, 2);
+      writer.endBank(false);
+      writer.beginBank("bank2_events", {0}, 3, true);
+      const uint32_t ids2[] = {20, 21, 22};
+      const float tofs2[] = {5.f, 6.f, 7.f};
+      const float weights[] = {0.5f, 1.5f, 2.5f};
+      writer.writeEvents(0, ids2, tofs2, weights, 3);
+      writer.endBank(true);
+      writer.commit();
+    }
+
+    auto cache = EventNexusCache::open(m_filename);
+    TS_ASSERT(cache);
+    TS_ASSERT_EQUALS(cache->numBanks(), 2);
+
+    const auto bank1 = cache->bank("bank1_events");
+    TS_ASSERT(bank1);
+    TS_ASSERT_EQUALS(bank1->numPulses, 3);
+    TS_ASSERT_EQUALS(bank1->eventIndex[1], 2);
+    TS_ASSERT_EQUALS(bank1->numEvents, 4);
+    TS_ASSERT_EQUALS(bank1->eventId[0], 10);
+    TS_ASSERT_EQUALS(bank1->eventId[3], 13);
+    TS_ASSERT_EQUALS(bank1->tof[2], 3.f);
+    TS_ASSERT(!bank1->weight);
+
+    const auto bank2 = cache->bank("bank2_events");
+    TS_ASSERT(bank2);
+    TS_ASSERT_EQUALS(bank2->numEvents, 3);
+    TS_ASSERT_EQUALS(bank2->eventId[2], 22);
+    TS_ASSERT(bank2->weight);
+    TS_ASSERT_EQUALS(bank2->weight[1], 1.5f);
+
+    TS_ASSERT(!cache->bank("bank3_events"));
+  }
+
+  void test_unfinished_bank_is_left_out() {
+    {
+      EventNexusCacheWriter writer(m_filename);
+      writer.beginBank("bank1_events", {0}, 2, false);
+      const uint32_t ids[] = {1, 2};
+      const float tofs[] = {1.f, 2.f};
+      writer.writeEvents(0, ids, tofs, nullptr, 1);
+      writer.commit();
+    }
+    auto cache = EventNexusCache::open(m_filename);
+    TS_ASSERT(cache);
+    TS_ASSERT_EQUALS(cache->numBanks(), 0);
+  }
+
+  void test_writing_outside_bank_throws() {
+    EventNexusCacheWriter writer(m_filename);
+    const uint32_t ids[] = {1, 2};
+    const float tofs[] = {1.f, 2.f};
+    TS_ASSERT_THROWS(writer.writeEvents(0, ids, tofs, nullptr, 1),
+                     std::invalid_argument);
+    writer.beginBank("bank1_events", {0}, 1, false);
+    TS_ASSERT_THROWS(writer.writeEvents(0, ids, tofs, nullptr, 2),
+                     std::invalid_argument);
+  }
+
+  void test_cache_is_not_made_without_commit() {
+    {
+      EventNexusCacheWriter writer(m_filename);
+      writer.beginBank("bank1_events", {0}, 0, false);
+      writer.endBank(false);
+    }
+    TS_ASSERT(!Poco::File(m_filename).exists());
+    TS_ASSERT(!Poco::File(m_filename + ".part").exists());
+    TS_ASSERT(!EventNexusCache::open(m_filename));
+  }
+
+  void test_invalid_file_is_not_opened() {
+    {
+      std::ofstream file(m_filename.c_str(), std::ios::binary);
+      file << "This is not an event cache, but it is long enough to be one";
+    }
+    TS_ASSERT(!EventNexusCache::open(m_filename));
+  }
+
+  void test_cacheFilename_depends_on_entry() {
+    const std::string directory = Poco::Path::temp();
+    {
+      std::ofstream file(m_filename.c_str());
+      file << "contents";
+    }
+    const auto entry1 =
+        EventNexusCache::cacheFilename(directory, m_filename, "entry");
+    const auto entry2 =
+        EventNexusCache::cacheFilename(directory, m_filename, "entry-Off_Off");
+    TS_ASSERT_DIFFERS(entry1, entry2);
+    TS_ASSERT_EQUALS(Poco::Path(entry1).getExtension(), "eventcache");
+    TS_ASSERT_EQUALS(Poco::Path(entry1).parent().toString(),
+                     Poco::Path(directory).toString());
+    TS_ASSERT_EQUALS(
+        entry1, EventNexusCache::cacheFilename(directory, m_filename, "entry"));
+  }
+
+private:
+  std::string m_filename;
+};
+
+#endif /* MANTID_DATAHANDLING_EVENTNEXUSCACHETEST_H_ */
@@ -8,11 +8,15 @@
 #include "MantidAPI/Run.h"
 #include "MantidAPI/Workspace.h"
 #include "MantidDataObjects/EventWorkspace.h"
+#include "MantidDataObjects/SplittersWorkspace.h"
 #include "MantidKernel/Property.h"
 #include "MantidKernel/TimeSeriesProperty.h"
 #include "MantidDataHandling/LoadEventNexus.h"
 #include <cxxtest/TestSuite.h>
 
+#include <Poco/File.h>
+#include <Poco/Path.h>
+
 using namespace Mantid::Geometry;
 using namespace Mantid::API;
 using namespace Mantid::DataObjects;
@@ -186,6 +190,205 @@ public:
     }
   }
 
+  void test_reading_in_slabs_gives_the_same_events() {
+    Mantid::API::FrameworkManager::Instance();
+    auto loadCNCS = [](const std::string &eventsPerRead,
+                       const std::string &maxBufferedEvents) {
+      LoadEventNexus ld;
+      ld.initialize();
+      ld.setPropertyValue("Filename", "CNCS_7860_event.nxs");
+      ld.setPropertyValue("OutputWorkspace", "cncs_slabs");
+      ld.setPropertyValue("EventsPerRead", eventsPerRead);
+      ld.setPropertyValue("MaxBufferedEvents", maxBufferedEvents);
+      ld.setProperty<bool>("LoadLogs", false); // Time-saver
+      ld.execute();
+      TS_ASSERT(ld.isExecuted());
+      return AnalysisDataService::Instance().retrieveWS<EventWorkspace>(
+          "cncs_slabs");
+    };
+    EventWorkspace_sptr whole = loadCNCS("10000000", "100000000");
+    // Small slabs, with so few events buffered that the reading task also
+    // processes some of them.
+    EventWorkspace_sptr slabs = loadCNCS("1000", "5000");
+    TS_ASSERT_EQUALS(slabs->getNumberEvents(), whole->getNumberEvents());
+    TS_ASSERT_EQUALS(slabs->getNumberHistograms(),
+                     whole->getNumberHistograms());
+    for (size_t wi = 0; wi < whole->getNumberHistograms(); wi += 97) {
+      auto &expected = whole->getSpectrum(wi);
+      auto &actual = slabs->getSpectrum(wi);
+      expected.sortPulseTimeTOF();
+      actual.sortPulseTimeTOF();
+      TS_ASSERT_EQUALS(actual.getEvents(), expected.getEvents());
+    }
+    AnalysisDataService::Instance().remove("cncs_slabs");
+  }
+
+  void test_compressing_while_reading_in_slabs_keeps_all_counts() {
+    Mantid::API::FrameworkManager::Instance();
+    LoadEventNexus ld;
+    ld.initialize();
+    ld.setPropertyValue("Filename", "CNCS_7860_event.nxs");
+    ld.setPropertyValue("OutputWorkspace", "cncs_compressed_slabs");
+    ld.setPropertyValue("CompressTolerance", "0.05");
+    ld.setPropertyValue("EventsPerRead", "1000");
+    ld.setProperty<bool>("LoadLogs", false); // Time-saver
+    ld.execute();
+    TS_ASSERT(ld.isExecuted());
+    auto ws = AnalysisDataService::Instance().retrieveWS<EventWorkspace>(
+        "cncs_compressed_slabs");
+
+    double totalWeight = 0.;
+    for (size_t wi = 0; wi < ws->getNumberHistograms(); wi++) {
+      const auto &el = ws->getSpectrum(wi);
+      if (el.getNumberEvents() == 0)
+        continue;
+      TS_ASSERT_EQUALS(el.getEventType(), WEIGHTED_NOTIME);
+      // The groups of all slabs are merged in one compressed list
+      TS_ASSERT_EQUALS(el.getSortType(), TOF_SORT);
+      for (const auto &event : el.getWeightedEventsNoTime())
+        totalWeight += event.weight();
+    }
+    // Every event of every slab is counted once
+    TS_ASSERT_DELTA(totalWeight, 112266., 1e-6);
+    TS_ASSERT_LESS_THAN(ws->getNumberEvents(), 112266);
+    AnalysisDataService::Instance().remove("cncs_compressed_slabs");
+  }
+
+  void test_compact_events_give_the_same_events() {
+    Mantid::API::FrameworkManager::Instance();
+    auto loadCNCS = [](const std::string &wsName, bool compact) {
+      LoadEventNexus ld;
+      ld.initialize();
+      ld.setPropertyValue("Filename", "CNCS_7860_event.nxs");
+      ld.setPropertyValue("OutputWorkspace", wsName);
+      ld.setProperty<bool>("CompactEvents", compact);
+      ld.setProperty<bool>("LoadLogs", false); // Time-saver
+      ld.execute();
+      TS_ASSERT(ld.isExecuted());
+      return AnalysisDataService::Instance().retrieveWS<EventWorkspace>(
+          wsName);
+    };
+    EventWorkspace_sptr normal = loadCNCS("cncs_normal", false);
+    EventWorkspace_sptr compact = loadCNCS("cncs_compact", true);
+    TS_ASSERT_EQUALS(compact->getNumberEvents(), normal->getNumberEvents());
+    TS_ASSERT_EQUALS(compact->getNumberHistograms(),
+                     normal->getNumberHistograms());
+    TS_ASSERT_LESS_THAN(compact->getMemorySize(), normal->getMemorySize());
+    size_t numCompared = 0;
+    for (size_t wi = 0; wi < normal->getNumberHistograms(); wi += 97) {
+      const EventList &expected = normal->getSpectrum(wi);
+      const EventList &actual = compact->getSpectrum(wi);
+      if (expected.getNumberEvents() == 0)
+        continue;
+      TS_ASSERT(actual.hasCompactEvents());
+      expected.sortPulseTimeTOF();
+      actual.sortPulseTimeTOF();
+      TS_ASSERT_EQUALS(actual.getEvents(), expected.getEvents());
+      ++numCompared;
+    }
+    TS_ASSERT_LESS_THAN(0, numCompared);
+    AnalysisDataService::Instance().remove("cncs_normal");
+    AnalysisDataService::Instance().remove("cncs_compact");
+  }
+
+  void test_event_cache_gives_the_same_events() {
+    Mantid::API::FrameworkManager::Instance();
+    const std::string cacheDir =
+        Poco::Path(Poco::Path::temp(), "LoadEventNexusTestCache").toString();
+    auto loadCNCS = [&cacheDir](const std::string &wsName, bool useCache,
+                                double filterStart) {
+      LoadEventNexus ld;
+      ld.initialize();
+      ld.setPropertyValue("Filename", "CNCS_7860_event.nxs");
+      ld.setPropertyValue("OutputWorkspace", wsName);
+      if (useCache)
+        ld.setPropertyValue("EventCacheDirectory", cacheDir);
+      if (filterStart > 0.)
+        ld.setProperty("FilterByTimeStart", filterStart);
+      ld.setProperty<bool>("LoadLogs", false); // Time-saver
+      ld.execute();
+      TS_ASSERT(ld.isExecuted());
+      return AnalysisDataService::Instance().retrieveWS<EventWorkspace>(
+          wsName);
+    };
+    // The first load writes the cache, the others read from it
+    EventWorkspace_sptr plain = loadCNCS("cncs_plain", false, 0.);
+    loadCNCS("cncs_cached", true, 0.);
+    Poco::File cacheDirectory(cacheDir);
+    TS_ASSERT(cacheDirectory.exists());
+    std::vector<std::string> cacheFiles;
+    cacheDirectory.list(cacheFiles);
+    TS_ASSERT_EQUALS(cacheFiles.size(), 1);
+    EventWorkspace_sptr cached = loadCNCS("cncs_cached", true, 0.);
+    EventWorkspace_sptr plainFiltered = loadCNCS("cncs_plain_f", false, 60.);
+    EventWorkspace_sptr cachedFiltered = loadCNCS("cncs_cached_f", true, 60.);
+
+    TS_ASSERT_EQUALS(cached->getNumberEvents(), plain->getNumberEvents());
+    TS_ASSERT_EQUALS(cachedFiltered->getNumberEvents(),
+                     plainFiltered->getNumberEvents());
+    for (size_t wi = 0; wi < plain->getNumberHistograms(); wi += 97) {
+      auto &expected = plain->getSpectrum(wi);
+      auto &actual = cached->getSpectrum(wi);
+      expected.sortPulseTimeTOF();
+      actual.sortPulseTimeTOF();
+      TS_ASSERT_EQUALS(actual.getEvents(), expected.getEvents());
+    }
+    for (const auto &name :
+         {"cncs_plain", "cncs_cached", "cncs_plain_f", "cncs_cached_f"})
+      AnalysisDataService::Instance().remove(name);
+    cacheDirectory.remove(true);
+  }
+
+  void test_splitters_only_load_events_inside_intervals() {
+    Mantid::API::FrameworkManager::Instance();
+    LoadEventNexus ld;
+    ld.initialize();
+    ld.setPropertyValue("Filename", "CNCS_7860_event.nxs");
+    ld.setPropertyValue("OutputWorkspace", "cncs_whole");
+    ld.setProperty<bool>("LoadLogs", false); // Time-saver
+    ld.execute();
+    TS_ASSERT(ld.isExecuted());
+    auto whole =
+        AnalysisDataService::Instance().retrieveWS<EventWorkspace>("cncs_whole");
+
+    const DateAndTime start = whole->getFirstPulseTime();
+    auto splitters = boost::make_shared<SplittersWorkspace>();
+    splitters->addSplitter(SplittingInterval(start + 40.0, start + 45.0, 1));
+    splitters->addSplitter(SplittingInterval(start + 10.0, start + 20.0, 0));
+    splitters->addSplitter(SplittingInterval(start + 15.0, start + 25.0, 0));
+
+    LoadEventNexus ld2;
+    ld2.initialize();
+    ld2.setPropertyValue("Filename", "CNCS_7860_event.nxs");
+    ld2.setPropertyValue("OutputWorkspace", "cncs_split");
+    ld2.setProperty("SplitterWorkspace", splitters);
+    ld2.setProperty<bool>("LoadLogs", false); // Time-saver
+    ld2.execute();
+    TS_ASSERT(ld2.isExecuted());
+    auto split =
+        AnalysisDataService::Instance().retrieveWS<EventWorkspace>("cncs_split");
+
+    auto inSplitters = [&start](const TofEvent &event) {
+      const DateAndTime &pulse = event.pulseTime();
+      return (pulse >= start + 10.0 && pulse < start + 25.0) ||
+             (pulse >= start + 40.0 && pulse < start + 45.0);
+    };
+    size_t expectedTotal = 0;
+    for (size_t wi = 0; wi < whole->getNumberHistograms(); ++wi) {
+      const auto &events = whole->getSpectrum(wi).getEvents();
+      const size_t expected =
+          std::count_if(events.begin(), events.end(), inSplitters);
+      expectedTotal += expected;
+      TS_ASSERT_EQUALS(split->getSpectrum(wi).getNumberEvents(), expected);
+    }
+    TS_ASSERT_EQUALS(split->getNumberEvents(), expectedTotal);
+    TS_ASSERT_LESS_THAN(expectedTotal, whole->getNumberEvents());
+    TS_ASSERT_LESS_THAN(0, expectedTotal);
+
+    AnalysisDataService::Instance().remove("cncs_whole");
+    AnalysisDataService::Instance().remove("cncs_split");
+  }
+
   void test_TOF_filtered_loading() {
     const std::string wsName = "test_filtering";
     const double filterStart = 45000;
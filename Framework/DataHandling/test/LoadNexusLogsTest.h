@@ -116,6 +116,38 @@ public:
     TS_ASSERT_EQUALS(dlog->size(), 172);
   }
 
+  void test_CompressLogs_keeps_the_values() {
+    LoadNexusLogs loader;
+    loader.initialize();
+    MatrixWorkspace_sptr testWS = createTestWorkspace();
+    loader.setProperty("Workspace", testWS);
+    loader.setPropertyValue("Filename", "LOQ49886.nxs");
+    loader.setProperty("CompressLogs", true);
+    TS_ASSERT_THROWS_NOTHING(loader.execute());
+    TS_ASSERT(loader.isExecuted());
+
+    const API::Run &run = testWS->run();
+    auto ilog =
+        dynamic_cast<TimeSeriesProperty<int> *>(run.getLogData("total_counts"));
+    TS_ASSERT(ilog);
+    TS_ASSERT(ilog->isCompressed());
+    TS_ASSERT_EQUALS(ilog->realSize(), 172);
+
+    MatrixWorkspace_sptr uncompressedWS = createTestWorkspace();
+    LoadNexusLogs reference;
+    reference.initialize();
+    reference.setProperty("Workspace", uncompressedWS);
+    reference.setPropertyValue("Filename", "LOQ49886.nxs");
+    reference.execute();
+    auto reflog = dynamic_cast<TimeSeriesProperty<int> *>(
+        uncompressedWS->run().getLogData("total_counts"));
+    TS_ASSERT(reflog);
+    TS_ASSERT(!reflog->isCompressed());
+    TS_ASSERT_EQUALS(ilog->valuesAsVector(), reflog->valuesAsVector());
+    TS_ASSERT_EQUALS(ilog->timesAsVector(), reflog->timesAsVector());
+    TS_ASSERT(!ilog->isCompressed());
+  }
+
   void test_extract_nperiod_log_from_event_nexus() {
 
     auto testWS = createTestWorkspace();
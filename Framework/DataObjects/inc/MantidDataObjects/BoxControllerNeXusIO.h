@@ -72,6 +72,12 @@ public:
   void setDataType(const size_t blockSize,
                    const std::string &typeName) override;
   void getDataType(size_t &CoordSize, std::string &typeName) const override;
+  /// Compress the events data array created by the next openFile for writing.
+  /// Existing arrays are read and written with the compression they have;
+  /// boxes written again to a compressed array take new space in the file.
+  void setCompressEvents(bool compress) { m_compressEvents = compress; }
+  /// @return true if new events data arrays are created compressed
+  bool getCompressEvents() const { return m_compressEvents; }
   //------------------------------------------------------------------------------------------------------------------------
   // Auxiliary functions (non-virtual, used for testing)
   int64_t getNDataColums() const { return m_BlockSize[1]; }
@@ -105,6 +111,8 @@ private:
   std::vector<int64_t> m_BlockSize;
   /// lock Nexus file operations as Nexus is not thread safe
   mutable std::mutex m_fileMutex;
+  /// compress the chunks of a new events data array
+  bool m_compressEvents;
 
   // Mainly static information which may be split into different IO classes
   // selected through chein of responsibility.
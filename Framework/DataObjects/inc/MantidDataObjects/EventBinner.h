@@ -0,0 +1,163 @@
+#ifndef MANTID_DATAOBJECTS_EVENTBINNER_H_
+#define MANTID_DATAOBJECTS_EVENTBINNER_H_
+
+#include "MantidDataObjects/DllConfig.h"
+#include "MantidKernel/cow_ptr.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace Mantid {
+namespace DataObjects {
+
+/** EventBinner : Finds the histogram bin of many events without needing the
+  events to be sorted.
+
+  The bin edges are inspected once on construction. Edges made with a
+  constant step (e.g. by HistogramData::LinearGenerator) or a constant ratio
+  (HistogramData::LogarithmicGenerator, or Rebin with a negative step) are
+  recognised and the bin of an event is then computed directly from its
+  time-of-flight, instead of searching the edges. Any other edges fall back
+  to a binary search. Computed indices are checked against the real edges,
+  so the result is exactly the same as a search would give even when the
+  edges carry rounding errors.
+
+  Events are processed in fixed-size blocks: the time-of-flights of a block
+  are copied into a contiguous buffer and their bins estimated in a simple
+  loop that the compiler can vectorize, before the counts are added to the
+  histogram.
+
+  Copyright &copy; 2016 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+class MANTID_DATAOBJECTS_DLL EventBinner {
+public:
+  /// How the bin edges are spaced
+  enum class Spacing { Irregular, Linear, Logarithmic };
+
+  explicit EventBinner(const MantidVec &X);
+
+  /// @return how the bin edges are spaced
+  Spacing spacing() const { return m_spacing; }
+  /// @return true if bin indices are computed rather than searched for
+  bool isArithmetic() const { return m_spacing != Spacing::Irregular; }
+  /// @return the number of bins
+  size_t numBins() const { return m_numBins; }
+
+  size_t binIndex(const double tof) const;
+
+  template <class T>
+  void addCounts(const std::vector<T> &events, MantidVec &Y) const;
+  template <class T>
+  void addWeights(const std::vector<T> &events, MantidVec &Y,
+                  MantidVec &E2) const;
+
+  void addCounts(const double *tofs, const size_t count, MantidVec &Y) const;
+  void addWeights(const double *tofs, const float *weights,
+                  const float *errorSquareds, const size_t count, MantidVec &Y,
+                  MantidVec &E2) const;
+
+private:
+  /// Number of events whose bins are estimated together
+  static const size_t BlockSize = 256;
+
+  bool isLinear() const;
+  bool isLogarithmic() const;
+  void estimateBins(const double *tofs, const size_t count, int *bins) const;
+  /// Move an estimated bin onto the bin that really holds tof
+  size_t correctBin(const double tof, size_t bin) const {
+    while (bin > 0 && tof < m_X[bin])
+      --bin;
+    while (tof >= m_X[bin + 1])
+      ++bin;
+    return bin;
+  }
+
+  template <class TofOf, class AddToBin>
+  void forEachBin(const size_t count, TofOf tofOf, AddToBin addToBin) const;
+
+  /// The bin edges
+  const MantidVec &m_X;
+  /// Number of bins
+  size_t m_numBins;
+  /// How the edges are spaced
+  Spacing m_spacing;
+  /// First and last bin edge
+  double m_xMin, m_xMax;
+  /// Bins per unit of x (linear) or of log(x) (logarithmic)
+  double m_scale;
+};
+
+/** Find the bin of every event in range and call addToBin(index, bin) for it.
+ * @param count :: number of events
+ * @param tofOf :: returns the time-of-flight of the event at an index
+ * @param addToBin :: called with the index and bin of each event in range
+ */
+template <class TofOf, class AddToBin>
+void EventBinner::forEachBin(const size_t count, TofOf tofOf,
+                             AddToBin addToBin) const {
+  double tofs[BlockSize];
+  int bins[BlockSize];
+  for (size_t start = 0; start < count; start += BlockSize) {
+    const size_t blockSize = std::min(BlockSize, count - start);
+    for (size_t i = 0; i < blockSize; ++i)
+      tofs[i] = tofOf(start + i);
+    estimateBins(tofs, blockSize, bins);
+    for (size_t i = 0; i < blockSize; ++i) {
+      const double tof = tofs[i];
+      if (!(tof >= m_xMin && tof < m_xMax))
+        continue;
+      addToBin(start + i, correctBin(tof, static_cast<size_t>(bins[i])));
+    }
+  }
+}
+
+/** Add one count per event to the bin holding it. Events outside the bins are
+ * ignored.
+ * @param events :: events in any order
+ * @param Y :: counts, sized to numBins()
+ */
+template <class T>
+void EventBinner::addCounts(const std::vector<T> &events, MantidVec &Y) const {
+  forEachBin(events.size(), [&events](size_t i) { return events[i].tof(); },
+             [&Y](size_t, size_t bin) { Y[bin] += 1.0; });
+}
+
+/** Add the weight and squared error of each event to the bin holding it.
+ * Events outside the bins are ignored.
+ * @param events :: weighted events in any order
+ * @param Y :: sum of weights, sized to numBins()
+ * @param E2 :: sum of squared errors, sized to numBins()
+ */
+template <class T>
+void EventBinner::addWeights(const std::vector<T> &events, MantidVec &Y,
+                             MantidVec &E2) const {
+  forEachBin(events.size(), [&events](size_t i) { return events[i].tof(); },
+             [&events, &Y, &E2](size_t i, size_t bin) {
+               Y[bin] += events[i].weight();
+               E2[bin] += events[i].errorSquared();
+             });
+}
+
+} // namespace DataObjects
+} // namespace Mantid
+
+#endif /* MANTID_DATAOBJECTS_EVENTBINNER_H_ */
@@ -0,0 +1,140 @@
+#ifndef MANTID_DATAOBJECTS_EVENTCOLUMNS_H_
+#define MANTID_DATAOBJECTS_EVENTCOLUMNS_H_
+
+#include "MantidAPI/IEventList.h"
+#include "MantidAPI/MatrixWorkspace_fwd.h"
+#include "MantidDataObjects/DllConfig.h"
+#include "MantidDataObjects/Events.h"
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace Mantid {
+namespace DataObjects {
+class EventList;
+
+/** EventColumns : Structure-of-arrays (columnar) storage for the events of a
+  single spectrum.
+
+  EventList stores its events as an array of TofEvent, WeightedEvent or
+  WeightedEventNoTime structs, so every pass over the list pulls the pulse
+  time and the weights through the cache even if only the time-of-flight is
+  needed. EventColumns holds the same information as separate tof, pulse
+  time, weight and squared-error arrays so that time-of-flight only
+  operations (sorting, unit conversion, histogramming) stream through a
+  single contiguous array of doubles and can be vectorized by the compiler.
+
+  The columns that are present depend on the event type:
+    - TOF: tof and pulse time. Weights are implicitly 1.
+    - WEIGHTED: tof, pulse time, weight and squared error.
+    - WEIGHTED_NOTIME: tof, weight and squared error.
+
+  An EventList holds its events in an EventColumns after switchToColumns(),
+  which EventWorkspace::setColumnarEvents() does for every spectrum. An
+  EventColumns can also be created from an EventList and written back to
+  one, so algorithms that make many tof-only passes can work on the columns
+  and pay for the conversion once.
+
+  Copyright &copy; 2016 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+class MANTID_DATAOBJECTS_DLL EventColumns {
+public:
+  explicit EventColumns(API::EventType type = API::TOF);
+  explicit EventColumns(const EventList &eventList);
+
+  API::EventType getEventType() const;
+  bool hasPulseTimes() const;
+  bool hasWeights() const;
+
+  std::size_t size() const;
+  bool empty() const;
+  void clear();
+  void reserve(std::size_t num);
+  std::size_t getMemorySize() const;
+
+  void append(const TofEvent &event);
+  void append(const WeightedEvent &event);
+  void append(const WeightedEventNoTime &event);
+  template <class T> void append(const std::vector<T> &events);
+
+  void copyTo(EventList &eventList) const;
+  void copyTo(std::vector<TofEvent> &events) const;
+  void copyTo(std::vector<WeightedEvent> &events) const;
+  void copyTo(std::vector<WeightedEventNoTime> &events) const;
+
+  /// Time-of-flight (or x value) column
+  const std::vector<double> &tofs() const { return m_tofs; }
+  /// Pulse time column in nanoseconds since the GPS epoch
+  const std::vector<int64_t> &pulseTimes() const { return m_pulseTimes; }
+  /// Weight column. Empty for TOF events.
+  const std::vector<float> &weights() const { return m_weights; }
+  /// Squared error column. Empty for TOF events.
+  const std::vector<float> &errorSquareds() const { return m_errorSquareds; }
+
+  WeightedEvent getEvent(std::size_t index) const;
+
+  bool isSortedByTof() const;
+  void setSortedByTof(bool sorted);
+  void sortTof();
+  void sortPulseTime();
+  void sortPulseTimeTof();
+  void sortTimeAtSample(const double tofFactor, const double tofShift);
+  void reverse();
+
+  void convertTof(const double factor, const double offset = 0.);
+  void convertTof(std::function<double(double)> func);
+
+  void generateHistogram(const MantidVec &X, MantidVec &Y, MantidVec &E,
+                         bool skipError = false) const;
+
+private:
+  void checkType(API::EventType type) const;
+  void permute(const std::vector<std::size_t> &order);
+
+  /// Type of the events held in the columns
+  API::EventType m_eventType;
+  /// True if the tof column is known to be sorted in ascending order
+  bool m_sortedByTof;
+  /// Time-of-flight column
+  std::vector<double> m_tofs;
+  /// Pulse time column, as nanoseconds
+  std::vector<int64_t> m_pulseTimes;
+  /// Weight column
+  std::vector<float> m_weights;
+  /// Squared error column
+  std::vector<float> m_errorSquareds;
+};
+
+/** Append a vector of events to the columns.
+ * @param events :: the events to append. Their type must match the columns.
+ */
+template <class T> void EventColumns::append(const std::vector<T> &events) {
+  reserve(size() + events.size());
+  for (const auto &event : events)
+    append(event);
+}
+
+} // namespace DataObjects
+} // namespace Mantid
+
+#endif /* MANTID_DATAOBJECTS_EVENTCOLUMNS_H_ */
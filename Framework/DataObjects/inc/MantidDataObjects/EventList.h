@@ -12,13 +12,18 @@
 #include "MantidKernel/TimeSplitter.h"
 #include "MantidKernel/Unit.h"
 #include "MantidKernel/cow_ptr.h"
+#include <boost/shared_ptr.hpp>
+#include <atomic>
 #include <cstddef>
 #include <iosfwd>
+#include <memory>
 #include <set>
 #include <vector>
 
 namespace Mantid {
 namespace DataObjects {
+class EventBinner;
+class EventColumns;
 class EventWorkspaceMRU;
 
 /// How the event list is sorted.
@@ -30,6 +35,10 @@ enum EventSortType {
   TIMEATSAMPLE_SORT
 };
 
+/// Table of pulse times indexed by CompactTofEvent::pulseIndex()
+using PulseTimeTable_const_sptr =
+    boost::shared_ptr<const std::vector<Kernel::DateAndTime>>;
+
 //==========================================================================================
 /** @class Mantid::DataObjects::EventList
 
@@ -42,6 +51,21 @@ enum EventSortType {
     or WeightedEvent (where each neutron can have a non-1 weight).
     This is done transparently.
 
+    An un-weighted list can also hold its events as CompactTofEvent's, which
+    refer to a table of pulse times shared by every list of a bank (see
+    switchToCompactEvents()). Sorting, histogramming and integrating in
+    time-of-flight work on the compact events directly. Modifying the list
+    in any other way first expands them back to TofEvent's. A const access
+    to the TofEvent's of a compact list builds a copy of them once, which is
+    kept alongside the compact events until the list is next modified.
+
+    Any list can also hold its events in an EventColumns, with separate
+    arrays for the time-of-flight, pulse time and weights (see
+    switchToColumns()). Sorting, converting and histogramming in
+    time-of-flight then only stream through the columns they need. As for
+    compact events, other operations work on a copy of the events or
+    convert them back.
+
     @author Janik Zikovsky, SNS ORNL
     @date 4/02/2010
 
@@ -114,6 +138,8 @@ public:
    * @param event :: TofEvent to add at the end of the list.
    * */
   inline void addEventQuickly(const TofEvent &event) {
+    if (m_compactPulseTimes || m_columns)
+      unpackEvents();
     this->events.push_back(event);
     this->order = UNSORTED;
   }
@@ -124,6 +150,8 @@ public:
    * @param event :: WeightedEvent to add at the end of the list.
    * */
   inline void addEventQuickly(const WeightedEvent &event) {
+    if (m_columns)
+      unpackEvents();
     this->weightedEvents.push_back(event);
     this->order = UNSORTED;
   }
@@ -134,6 +162,8 @@ public:
    * @param event :: WeightedEventNoTime to add at the end of the list.
    * */
   inline void addEventQuickly(const WeightedEventNoTime &event) {
+    if (m_columns)
+      unpackEvents();
     this->weightedEventsNoTime.push_back(event);
     this->order = UNSORTED;
   }
@@ -153,6 +183,16 @@ public:
   std::vector<WeightedEventNoTime> &getWeightedEventsNoTime();
   const std::vector<WeightedEventNoTime> &getWeightedEventsNoTime() const;
 
+  bool switchToCompactEvents(const PulseTimeTable_const_sptr &pulseTimes);
+  bool hasCompactEvents() const;
+  std::vector<CompactTofEvent> &getCompactEvents();
+  const std::vector<CompactTofEvent> &getCompactEvents() const;
+  PulseTimeTable_const_sptr getCompactPulseTimes() const;
+
+  void switchToColumns();
+  void switchFromColumns();
+  bool hasColumns() const;
+
   void clear(const bool removeDetIDs = true) override;
   void clearUnused();
 
@@ -312,6 +352,13 @@ public:
   void splitByPulseTime(Kernel::TimeSplitterType &splitter,
                         std::map<int, EventList *> outputs) const;
 
+  /// Split events in one pass by the interval holding the time of each event
+  void splitByTimeBoundaries(const std::vector<int64_t> &splitTimes,
+                             const std::vector<size_t> &splitTargets,
+                             const std::vector<EventList *> &outputs,
+                             bool pulseTimeOnly, bool docorrection,
+                             double toffactor, double tofshift) const;
+
   void multiply(const double value, const double error = 0.0) override;
   EventList &operator*=(const double value);
 
@@ -372,6 +419,24 @@ private:
   /// List of WeightedEvent's
   mutable std::vector<WeightedEventNoTime> weightedEventsNoTime;
 
+  /// List of CompactTofEvent's, used in place of events when
+  /// m_compactPulseTimes is set
+  mutable std::vector<CompactTofEvent> compactEvents;
+
+  /// Pulse times referred to by compactEvents. Null unless the list is compact.
+  PulseTimeTable_const_sptr m_compactPulseTimes;
+
+  /// True if events holds a copy of compactEvents, made for const access
+  mutable std::atomic<bool> m_compactExpanded{false};
+
+  /// The events as columns, in place of the event vectors. Null unless the
+  /// list is columnar.
+  std::unique_ptr<EventColumns> m_columns;
+
+  /// True if the event vector of eventType holds a copy of m_columns, made
+  /// for const access
+  mutable std::atomic<bool> m_columnsExpanded{false};
+
   /// What type of event is in our list.
   Mantid::API::EventType eventType;
 
@@ -413,8 +478,20 @@ private:
 
   void generateErrorsHistogram(const MantidVec &Y, MantidVec &E) const;
 
+  void generateHistogramUnsorted(const EventBinner &binner, MantidVec &Y,
+                                 MantidVec &E, bool skipError) const;
+
   void switchToWeightedEvents();
   void switchToWeightedEventsNoTime();
+  void expandCompactEvents() const;
+  void updateExpandedCompactEvents() const;
+  void dropCompactEvents();
+  void expandColumns() const;
+  void updateExpandedColumns() const;
+  void clearExpandedColumns();
+  void expandEvents() const;
+  void unpackEvents();
+  void sortTofWithThreads(const int numThreads) const;
 
   // helper functions are all internal to simplify the code
   template <class T1, class T2>
@@ -429,6 +506,9 @@ private:
                                     std::vector<WeightedEventNoTime> &out,
                                     double tolerance);
   template <class T>
+  static void histogramCountsHelper(const std::vector<T> &events,
+                                    const MantidVec &X, MantidVec &Y);
+  template <class T>
   static void histogramForWeightsHelper(const std::vector<T> &events,
                                         const MantidVec &X, MantidVec &Y,
                                         MantidVec &E);
@@ -494,6 +574,13 @@ private:
                               std::map<int, EventList *> outputs,
                               typename std::vector<T> &events) const;
   template <class T>
+  void splitByTimeBoundariesHelper(const std::vector<int64_t> &splitTimes,
+                                   const std::vector<size_t> &splitTargets,
+                                   const std::vector<EventList *> &outputs,
+                                   const std::vector<T> &events,
+                                   bool pulseTimeOnly, bool docorrection,
+                                   double toffactor, double tofshift) const;
+  template <class T>
   std::string splitByFullTimeVectorSplitterHelper(
       const std::vector<int64_t> &vectimes, const std::vector<int> &vecgroups,
       std::map<int, EventList *> outputs, typename std::vector<T> &vecEvents,
@@ -529,6 +616,10 @@ DLLExport void getEventsFrom(EventList &el,
                              std::vector<WeightedEventNoTime> *&events);
 DLLExport void getEventsFrom(const EventList &el,
                              std::vector<WeightedEventNoTime> const *&events);
+DLLExport void getEventsFrom(EventList &el,
+                             std::vector<CompactTofEvent> *&events);
+DLLExport void getEventsFrom(const EventList &el,
+                             std::vector<CompactTofEvent> const *&events);
 
 } // DataObjects
 } // Mantid
@@ -116,6 +116,9 @@ public:
   // Change the event type
   void switchEventType(const Mantid::API::EventType type);
 
+  // Store the events of every list as columns, or not
+  void setColumnarEvents(const bool columnar);
+
   // Returns true always - an EventWorkspace always represents histogramm-able
   // data
   bool isHistogramData() const override;
@@ -214,6 +214,57 @@ public:
 };
 #pragma pack(pop)
 
+//==========================================================================================
+/** A neutron detection event stored in 8 bytes, for loading very large runs:
+ *
+ *  - the time of flight of the neutron, as a float
+ *  - the index of the pulse at which it was produced in a table of pulse
+ *    times that is shared by all the events of a bank
+ *
+ * The event cannot give its pulse time on its own; the EventList holding it
+ * keeps the pulse time table and hands out TofEvent's where a pulse time is
+ * needed.
+ */
+#pragma pack(push, 4) // Ensure the structure is no larger than it needs to
+class DLLExport CompactTofEvent {
+
+  /// EventList has the right to mess with this
+  friend class EventList;
+
+protected:
+  /// The time-of-flight of the neutron, in microseconds
+  float m_tof;
+
+  /// Index of the pulse time in the pulse time table of the event's bank
+  uint32_t m_pulseIndex;
+
+public:
+  /// Constructor, specifying only the time of flight
+  CompactTofEvent(double tof);
+
+  /// Constructor, specifying the time of flight and the pulse index
+  CompactTofEvent(float tof, uint32_t pulseIndex);
+
+  /// Empty constructor
+  CompactTofEvent();
+
+  bool operator==(const CompactTofEvent &rhs) const;
+  bool operator<(const CompactTofEvent &rhs) const;
+  bool operator<(const double rhs_tof) const;
+
+  double operator()() const;
+  double tof() const;
+  uint32_t pulseIndex() const;
+  double weight() const;
+  double error() const;
+  double errorSquared() const;
+
+  /// Output a string representation of the event to a stream
+  friend std::ostream &operator<<(std::ostream &os,
+                                  const CompactTofEvent &event);
+};
+#pragma pack(pop)
+
 //==========================================================================================
 // TofEvent inlined member function definitions
 //==========================================================================================
@@ -292,6 +343,28 @@ inline double WeightedEventNoTime::errorSquared() const {
   return m_errorSquared;
 }
 
+//==========================================================================================
+// CompactTofEvent inlined member function definitions
+//==========================================================================================
+
+/// Return the time-of-flight of the neutron, as a double.
+inline double CompactTofEvent::operator()() const { return m_tof; }
+
+/// Return the time-of-flight of the neutron, as a double.
+inline double CompactTofEvent::tof() const { return m_tof; }
+
+/// Return the index of the pulse time in the pulse time table of the bank
+inline uint32_t CompactTofEvent::pulseIndex() const { return m_pulseIndex; }
+
+/// Return the weight of the event - exactly 1.0 always
+inline double CompactTofEvent::weight() const { return 1.0; }
+
+/// Return the error of the event - exactly 1.0 always
+inline double CompactTofEvent::error() const { return 1.0; }
+
+/// Return the errorSquared of the event - exactly 1.0 always
+inline double CompactTofEvent::errorSquared() const { return 1.0; }
+
 } // DataObjects
 } // Mantid
 #endif /// MANTID_DATAOBJECTS_EVENTS_H_
@@ -0,0 +1,91 @@
+#ifndef MANTID_DATAOBJECTS_MDBOXMORTONTREE_H_
+#define MANTID_DATAOBJECTS_MDBOXMORTONTREE_H_
+
+#include "MantidAPI/IMDNode.h"
+#include "MantidDataObjects/DllConfig.h"
+#include "MantidGeometry/MDGeometry/MDImplicitFunction.h"
+
+#include <vector>
+
+namespace Mantid {
+namespace DataObjects {
+
+/** MDBoxMortonTree : a linearized, read-only copy of the box structure of an
+  MD event workspace.
+
+  The boxes are stored depth-first, with the children of every grid box
+  ordered along a Morton (Z-order) space filling curve. The children of a box
+  are implicit: the first child of the box at index i is at i + 1, the next
+  sibling of a box follows the end of its subtree, and the leaves of any
+  subtree are a contiguous range of the leaves of the tree. The extents of all
+  boxes are kept in one array, so a traversal does not call into the boxes.
+
+  The tree is built on demand from the root box of a workspace and is not
+  updated when boxes are split or events are added; build a new one after
+  changing the workspace.
+
+  Copyright &copy; 2016 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+class MANTID_DATAOBJECTS_DLL MDBoxMortonTree {
+public:
+  explicit MDBoxMortonTree(API::IMDNode *root);
+
+  /// @return the number of dimensions of the boxes
+  size_t getNumDims() const { return m_nd; }
+  /// @return the number of boxes, grid boxes included
+  size_t getNumBoxes() const { return m_boxes.size(); }
+  /// @return all boxes, depth-first in Morton order
+  const std::vector<API::IMDNode *> &getBoxes() const { return m_boxes; }
+  /// @return the leaf boxes in Morton order
+  const std::vector<API::IMDNode *> &getLeaves() const { return m_leaves; }
+
+  void getBoxes(std::vector<API::IMDNode *> &outBoxes,
+                const Geometry::MDImplicitFunction &function) const;
+  API::IMDNode *getBoxAtCoord(const coord_t *coords) const;
+
+private:
+  void addBox(API::IMDNode *box);
+  bool isLeaf(size_t index) const {
+    return m_subtreeEnd[index] == index + 1;
+  }
+  bool contains(size_t index, const coord_t *coords) const;
+  void fillVertexes(size_t index, coord_t *vertexes) const;
+
+  /// Number of dimensions
+  size_t m_nd;
+  /// The boxes, depth-first with the children in Morton order
+  std::vector<API::IMDNode *> m_boxes;
+  /// Min and max of each dimension of each box, 2 * m_nd values per box
+  std::vector<coord_t> m_extents;
+  /// Index one past the last box in the subtree of each box
+  std::vector<size_t> m_subtreeEnd;
+  /// Index into m_leaves of the first leaf at or after each box, plus one
+  /// entry for the end of the tree
+  std::vector<size_t> m_firstLeaf;
+  /// The leaf boxes in Morton order
+  std::vector<API::IMDNode *> m_leaves;
+};
+
+} // namespace DataObjects
+} // namespace Mantid
+
+#endif /* MANTID_DATAOBJECTS_MDBOXMORTONTREE_H_ */
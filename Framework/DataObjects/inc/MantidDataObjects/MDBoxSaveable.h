@@ -4,6 +4,8 @@
 #include "MantidKernel/ISaveable.h"
 #include "MantidAPI/IMDNode.h"
 
+#include <mutex>
+
 namespace Mantid {
 namespace DataObjects {
 
@@ -50,7 +52,10 @@ public:
   /// Method to flush the data to disk and ensure it is written.
   void flushData() const override;
   /// remove objects data from memory but keep all averages
-  void clearDataFromMemory() override { m_MDNode->clearDataFromMemory(); }
+  void clearDataFromMemory() override {
+    std::lock_guard<std::mutex> lock(m_loadMutex);
+    m_MDNode->clearDataFromMemory();
+  }
 
   /// @return the amount of memory that the object takes up in the MRU.
   uint64_t getTotalDataSize() const override {
@@ -66,6 +71,9 @@ public:
 
 private:
   API::IMDNode *const m_MDNode;
+  /// Serializes loading, which a prefetch of the DiskBuffer can do from
+  /// another thread
+  std::mutex m_loadMutex;
 };
 }
 }
@@ -129,6 +129,7 @@ public:
   //----------------------------------------------------------------------------------------------------------------------
   size_t addEvent(const MDE &event) override;
   size_t addEventUnsafe(const MDE &event) override;
+  size_t addEvents(const std::vector<MDE> &events) override;
 
   /*--------------->  EVENTS from event data
    * <-------------------------------------------------------------*/
@@ -212,6 +213,9 @@ private:
   /// Compute the index of the child box for the given event
   size_t calculateChildIndex(const MDE &event) const;
 
+  /// Add events to the children, sorted by child box, without bounds checks
+  void addEventsToChildren(const std::vector<MDE> &events);
+
   /// Each dimension is split into this many equally-sized boxes
   size_t split[nd];
   /** Cumulative dimension splitting: split[n] = 1*split[0]*split[..]*split[n-1]
@@ -1,8 +1,10 @@
 #include "MantidKernel/Task.h"
 #include "MantidKernel/Utils.h"
 #include "MantidKernel/FunctionTask.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/Timer.h"
 #include "MantidKernel/ThreadPool.h"
+#include "MantidKernel/ThreadPoolRunnable.h"
 #include "MantidKernel/ThreadScheduler.h"
 #include "MantidKernel/ThreadSchedulerMutexes.h"
 #include "MantidKernel/WarningSuppressions.h"
@@ -11,6 +13,8 @@
 #include "MantidDataObjects/MDGridBox.h"
 #include <boost/math/special_functions/round.hpp>
 #include <boost/optional.hpp>
+#include <algorithm>
+#include <iterator>
 #include <ostream>
 #include "MantidKernel/Strings.h"
 
@@ -1679,6 +1683,109 @@ TMDE(inline size_t MDGridBox)::addEventUnsafe(const MDE &event) {
     return 0;
 }
 
+//-----------------------------------------------------------------------------------------------
+/** Add all of the events contained in a vector, with bounds checking.
+ *
+ * The events are sorted by the sub-box they belong to, and each sub-box is
+ * given all of its events at once, instead of descending the tree for every
+ * event. Large vectors are distributed to the sub-boxes in parallel.
+ *
+ * Thread-safe, in the same way as addEvent().
+ *
+ * Note! nPoints, signal and error must be re-calculated using refreshCache()
+ * after all events have been added.
+ *
+ * @param events :: vector of events to be copied.
+ * @return the number of events that were rejected (because of being out of
+ *bounds)
+ */
+TMDE(size_t MDGridBox)::addEvents(const std::vector<MDE> &events) {
+  size_t numBad = 0;
+  for (const auto &event : events) {
+    for (size_t d = 0; d < nd; d++) {
+      if (this->extents[d].outside(event.getCenter(d))) {
+        ++numBad;
+        break;
+      }
+    }
+  }
+
+  if (numBad == 0) {
+    addEventsToChildren(events);
+  } else {
+    std::vector<MDE> inBounds;
+    inBounds.reserve(events.size() - numBad);
+    std::copy_if(events.cbegin(), events.cend(), std::back_inserter(inBounds),
+                 [this](const MDE &event) {
+                   for (size_t d = 0; d < nd; d++)
+                     if (this->extents[d].outside(event.getCenter(d)))
+                       return false;
+                   return true;
+                 });
+    addEventsToChildren(inBounds);
+  }
+  return numBad;
+}
+
+//-----------------------------------------------------------------------------------------------
+/** Sorts the events by the child box they belong to and adds each child's
+ * events in one call. Events of child grid boxes are sorted again by the
+ * children of these, so every MDBox receives its events as one contiguous
+ * block. No bounds checking is done, see addEvent().
+ *
+ * Batches with no more events than there are children are added one event at
+ * a time, as sorting them would cost more than it saves.
+ *
+ * @param events :: vector of events to be copied.
+ */
+TMDE(void MDGridBox)::addEventsToChildren(const std::vector<MDE> &events) {
+  if (events.size() <= numBoxes) {
+    for (const auto &event : events)
+      addEvent(event);
+    return;
+  }
+
+  std::vector<size_t> childIndices(events.size());
+  std::vector<size_t> childSizes(numBoxes, 0);
+  for (size_t i = 0; i < events.size(); ++i) {
+    size_t cindex = calculateChildIndex(events[i]);
+    // Events on the upper boundary of the last child box, as in addEvent().
+    if (cindex == numBoxes)
+      cindex = numBoxes - 1;
+    childIndices[i] = cindex;
+    if (cindex < numBoxes)
+      ++childSizes[cindex];
+  }
+
+  std::vector<std::vector<MDE>> childEvents(numBoxes);
+  for (size_t i = 0; i < numBoxes; ++i)
+    childEvents[i].reserve(childSizes[i]);
+  for (size_t i = 0; i < events.size(); ++i)
+    if (childIndices[i] < numBoxes)
+      childEvents[childIndices[i]].push_back(events[i]);
+
+  // The children are independent, so they can be filled in parallel. This is
+  // not done if the caller already runs in parallel: in an OpenMP loop, in a
+  // task of a thread pool, or in this loop for the children of child grid
+  // boxes.
+  const bool parallel =
+      events.size() > this->m_BoxController->getAddingEvents_eventsPerTask() &&
+      !PARALLEL_IN_REGION && !Kernel::ThreadPoolRunnable::inPoolThread();
+  PARALLEL_FOR_IF(parallel)
+  for (int i = 0; i < static_cast<int>(numBoxes); ++i) {
+    if (childEvents[i].empty())
+      continue;
+    auto child = m_Children[i];
+    if (child->isBox())
+      child->addEvents(childEvents[i]);
+    else
+      static_cast<MDGridBox<MDE, nd> *>(child)
+          ->addEventsToChildren(childEvents[i]);
+    // Release the staged events as soon as they have been copied.
+    std::vector<MDE>().swap(childEvents[i]);
+  }
+}
+
 /**Sets particular child MDgridBox at the index, specified by the input
 *parameters
 *@param index     -- the position of the new child in the list of GridBox
@@ -0,0 +1,249 @@
+#ifndef MANTID_DATAOBJECTS_RADIXSORT_H_
+#define MANTID_DATAOBJECTS_RADIXSORT_H_
+
+#include "MantidKernel/MultiThreaded.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace Mantid {
+namespace DataObjects {
+
+/** RadixSort : Stable least-significant-digit radix sort for event vectors.
+
+  Each element is given an unsigned 64 bit key whose integer order is the
+  order wanted for the elements: the time-of-flight, the pulse time, or the
+  time at the sample. The keys are sorted 11 bits at a time, so a vector is
+  sorted in at most 6 linear passes instead of O(n log n) comparisons. Passes
+  where every key has the same digit (e.g. the exponent bits of
+  times-of-flight that all lie in the same range) are skipped.
+
+  Sorting by two keys (e.g. pulse time, then time-of-flight) is done by
+  sorting on the secondary key and then on the primary key; this relies on
+  the sort being stable.
+
+  Long vectors can be sorted by several threads: each thread counts and then
+  scatters its own contiguous block of the vector, which keeps the sort
+  stable. Inside an OpenMP parallel region the sort uses a single thread.
+
+  The sort needs scratch space for two copies of the keys and one copy of the
+  elements, i.e. about three times the size of a vector of events. Vectors
+  longer than MaximumSize are sorted in place with std::sort instead, which
+  is not stable.
+
+  Copyright &copy; 2016 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+namespace RadixSort {
+
+/// Vectors shorter than this are sorted with std::stable_sort instead, as
+/// clearing the counts of every pass would cost more than sorting them
+constexpr size_t MinimumSize = 4096;
+/// Vectors longer than this are sorted with std::sort, which needs no scratch
+constexpr size_t MaximumSize = size_t(1) << 27;
+/// Number of key bits sorted in each pass
+constexpr unsigned DigitBits = 11;
+/// Number of buckets in each pass
+constexpr size_t NumBuckets = size_t(1) << DigitBits;
+/// Number of passes needed to sort a 64 bit key
+constexpr unsigned NumPasses = (64 + DigitBits - 1) / DigitBits;
+
+/** Key with the same order as a double. Positive numbers have the sign bit
+ * set; negative numbers have all bits flipped so that they sort in reverse.
+ * @param value :: the value to convert
+ * @return the key
+ */
+inline uint64_t key(const double value) {
+  uint64_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  const uint64_t signBit = uint64_t(1) << 63;
+  return (bits & signBit) ? ~bits : (bits | signBit);
+}
+
+/** Key with the same order as a float.
+ * @param value :: the value to convert
+ * @return the key
+ */
+inline uint64_t key(const float value) {
+  uint32_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  const uint32_t signBit = uint32_t(1) << 31;
+  return (bits & signBit) ? ~bits : (bits | signBit);
+}
+
+/** Key with the same order as a signed 64 bit integer.
+ * @param value :: the value to convert
+ * @return the key
+ */
+inline uint64_t key(const int64_t value) {
+  return static_cast<uint64_t>(value) ^ (uint64_t(1) << 63);
+}
+
+/// The digit of key used in the given pass
+inline size_t digit(const uint64_t key, const unsigned pass) {
+  return static_cast<size_t>((key >> (pass * DigitBits)) & (NumBuckets - 1));
+}
+
+/** Sort values by the matching keys. Both vectors are reordered.
+ * @param values :: the elements to sort
+ * @param keys :: one key per element
+ * @param numThreads :: number of threads to use
+ */
+template <class T>
+void sortByKeys(std::vector<T> &values, std::vector<uint64_t> &keys,
+                const int numThreads = 1) {
+  const size_t n = values.size();
+  if (n < 2)
+    return;
+  // Don't start nested threads when called from a parallel loop
+  const int numChunks = PARALLEL_IN_REGION ? 1 : std::max(1, numThreads);
+  const size_t chunkSize = (n + numChunks - 1) / numChunks;
+  // The digits of a block of the vector for every pass
+  auto countDigits = [&](std::vector<size_t> &chunkCounts, const int chunk,
+                         const unsigned firstPass, const unsigned endPass) {
+    const size_t begin = static_cast<size_t>(chunk) * chunkSize;
+    const size_t end = std::min(n, begin + chunkSize);
+    for (size_t i = begin; i < end; ++i)
+      for (unsigned pass = firstPass; pass < endPass; ++pass)
+        ++chunkCounts[pass * NumBuckets + digit(keys[i], pass)];
+  };
+
+  // Count the digits of all passes at once. A single block holds the same
+  // keys in every pass, so its counts are not needed again.
+  std::vector<std::vector<size_t>> counts(
+      numChunks, std::vector<size_t>(NumPasses * NumBuckets, 0));
+  PARALLEL_FOR_IF(numChunks > 1)
+  for (int chunk = 0; chunk < numChunks; ++chunk)
+    countDigits(counts[chunk], chunk, 0, NumPasses);
+
+  // Digits that are the same for every key don't need a pass.
+  std::vector<unsigned> passes;
+  for (unsigned pass = 0; pass < NumPasses; ++pass) {
+    size_t sameDigit = 0;
+    const size_t first = digit(keys[0], pass);
+    for (int chunk = 0; chunk < numChunks; ++chunk)
+      sameDigit += counts[chunk][pass * NumBuckets + first];
+    if (sameDigit != n)
+      passes.push_back(pass);
+  }
+  if (passes.empty())
+    return;
+
+  std::vector<T> valuesOut(n);
+  std::vector<uint64_t> keysOut(n);
+  for (const auto pass : passes) {
+    const size_t passOffset = pass * NumBuckets;
+    if (numChunks > 1 && pass != passes.front()) {
+      // The previous passes moved keys between the blocks
+      PARALLEL_FOR_IF(numChunks > 1)
+      for (int chunk = 0; chunk < numChunks; ++chunk) {
+        auto &chunkCounts = counts[chunk];
+        std::fill(chunkCounts.begin() + passOffset,
+                  chunkCounts.begin() + passOffset + NumBuckets, 0);
+        countDigits(chunkCounts, chunk, pass, pass + 1);
+      }
+    }
+    // Turn the counts into the first output position of each chunk's bucket
+    size_t offset = 0;
+    for (size_t bucket = passOffset; bucket < passOffset + NumBuckets;
+         ++bucket) {
+      for (int chunk = 0; chunk < numChunks; ++chunk) {
+        const size_t count = counts[chunk][bucket];
+        counts[chunk][bucket] = offset;
+        offset += count;
+      }
+    }
+    PARALLEL_FOR_IF(numChunks > 1)
+    for (int chunk = 0; chunk < numChunks; ++chunk) {
+      size_t *position = counts[chunk].data() + passOffset;
+      const size_t begin = static_cast<size_t>(chunk) * chunkSize;
+      const size_t end = std::min(n, begin + chunkSize);
+      for (size_t i = begin; i < end; ++i) {
+        const size_t out = position[digit(keys[i], pass)]++;
+        keysOut[out] = keys[i];
+        valuesOut[out] = values[i];
+      }
+    }
+    keys.swap(keysOut);
+    values.swap(valuesOut);
+  }
+}
+
+/** Sort a vector by a key. The sort is stable unless the vector is longer
+ * than MaximumSize.
+ * @param values :: the elements to sort
+ * @param keyOf :: function returning the key of an element (see key())
+ * @param numThreads :: number of threads to use
+ */
+template <class T, class KeyFunction>
+void sort(std::vector<T> &values, KeyFunction keyOf, const int numThreads = 1) {
+  if (values.size() < MinimumSize) {
+    std::stable_sort(values.begin(), values.end(),
+                     [&keyOf](const T &a, const T &b) {
+                       return keyOf(a) < keyOf(b);
+                     });
+    return;
+  }
+  if (values.size() > MaximumSize) {
+    std::sort(values.begin(), values.end(), [&keyOf](const T &a, const T &b) {
+      return keyOf(a) < keyOf(b);
+    });
+    return;
+  }
+  std::vector<uint64_t> keys;
+  keys.reserve(values.size());
+  for (const auto &value : values)
+    keys.push_back(keyOf(value));
+  sortByKeys(values, keys, numThreads);
+}
+
+/** Sort a vector by a primary key and then by a secondary key.
+ * @param values :: the elements to sort
+ * @param primaryKeyOf :: function returning the primary key of an element
+ * @param secondaryKeyOf :: function returning the key used to order elements
+ *        with the same primary key
+ * @param numThreads :: number of threads to use
+ */
+template <class T, class PrimaryKeyFunction, class SecondaryKeyFunction>
+void sort(std::vector<T> &values, PrimaryKeyFunction primaryKeyOf,
+          SecondaryKeyFunction secondaryKeyOf, const int numThreads = 1) {
+  if (values.size() > MaximumSize) {
+    std::sort(values.begin(), values.end(),
+              [&primaryKeyOf, &secondaryKeyOf](const T &a, const T &b) {
+                const auto primaryA = primaryKeyOf(a);
+                const auto primaryB = primaryKeyOf(b);
+                return primaryA < primaryB ||
+                       (primaryA == primaryB &&
+                        secondaryKeyOf(a) < secondaryKeyOf(b));
+              });
+    return;
+  }
+  sort(values, secondaryKeyOf, numThreads);
+  sort(values, primaryKeyOf, numThreads);
+}
+
+} // namespace RadixSort
+} // namespace DataObjects
+} // namespace Mantid
+
+#endif /* MANTID_DATAOBJECTS_RADIXSORT_H_ */
@@ -64,6 +64,9 @@ public:
   std::size_t size() const override;
   std::size_t blocksize() const override;
 
+  /// Get the memory used, counting data shared between spectra once
+  size_t getMemorySize() const override;
+
   Histogram1D &getSpectrum(const size_t index) override;
   const Histogram1D &getSpectrum(const size_t index) const override;
 
@@ -0,0 +1,153 @@
+#include "MantidDataObjects/EventBinner.h"
+
+#include <cmath>
+
+namespace Mantid {
+namespace DataObjects {
+
+namespace {
+/// Largest deviation of an edge from the ideal spacing, as a fraction of a bin
+const double SPACING_TOLERANCE = 0.01;
+}
+
+/** Constructor. Inspects the bin edges to choose how bins are found.
+ * @param X :: the bin edges, in ascending order. The vector must outlive the
+ * EventBinner.
+ */
+EventBinner::EventBinner(const MantidVec &X)
+    : m_X(X), m_numBins(X.size() > 1 ? X.size() - 1 : 0),
+      m_spacing(Spacing::Irregular), m_xMin(0.), m_xMax(0.), m_scale(0.) {
+  if (m_numBins == 0)
+    return;
+  m_xMin = X.front();
+  m_xMax = X.back();
+  if (m_numBins == 1) {
+    m_spacing = Spacing::Linear;
+  } else if (isLinear()) {
+    m_spacing = Spacing::Linear;
+    m_scale = static_cast<double>(m_numBins - 1) / (X[m_numBins - 1] - m_xMin);
+  } else if (isLogarithmic()) {
+    m_spacing = Spacing::Logarithmic;
+    m_scale = static_cast<double>(m_numBins - 1) /
+              std::log(X[m_numBins - 1] / m_xMin);
+  }
+}
+
+/** Find the bin holding a time-of-flight
+ * @param tof :: the time-of-flight
+ * @return the index of the bin, or numBins() if tof is outside the bins
+ */
+size_t EventBinner::binIndex(const double tof) const {
+  if (!(tof >= m_xMin && tof < m_xMax))
+    return m_numBins;
+  int bin;
+  estimateBins(&tof, 1, &bin);
+  return correctBin(tof, static_cast<size_t>(bin));
+}
+
+/** Add one count per time-of-flight to the bin holding it
+ * @param tofs :: times-of-flight in any order
+ * @param count :: number of times-of-flight
+ * @param Y :: counts, sized to numBins()
+ */
+void EventBinner::addCounts(const double *tofs, const size_t count,
+                            MantidVec &Y) const {
+  forEachBin(count, [tofs](size_t i) { return tofs[i]; },
+             [&Y](size_t, size_t bin) { Y[bin] += 1.0; });
+}
+
+/** Add weights and squared errors to the bins holding the matching
+ * times-of-flight
+ * @param tofs :: times-of-flight in any order
+ * @param weights :: weight of each event
+ * @param errorSquareds :: squared error of each event
+ * @param count :: number of events
+ * @param Y :: sum of weights, sized to numBins()
+ * @param E2 :: sum of squared errors, sized to numBins()
+ */
+void EventBinner::addWeights(const double *tofs, const float *weights,
+                             const float *errorSquareds, const size_t count,
+                             MantidVec &Y, MantidVec &E2) const {
+  forEachBin(count, [tofs](size_t i) { return tofs[i]; },
+             [weights, errorSquareds, &Y, &E2](size_t i, size_t bin) {
+               Y[bin] += static_cast<double>(weights[i]);
+               E2[bin] += static_cast<double>(errorSquareds[i]);
+             });
+}
+
+/** Check for a constant step. The last bin is allowed to have any width, as
+ * Rebin shortens or extends it to end at the requested maximum.
+ * @return true if all but the last bin have the same width
+ */
+bool EventBinner::isLinear() const {
+  const size_t last = m_numBins - 1;
+  const double step = (m_X[last] - m_xMin) / static_cast<double>(last);
+  if (!(step > 0.) || !std::isfinite(step) || !(m_xMax > m_X[last]))
+    return false;
+  const double tolerance = SPACING_TOLERANCE * step;
+  for (size_t i = 1; i < last; ++i) {
+    const double expected = m_xMin + static_cast<double>(i) * step;
+    if (std::abs(m_X[i] - expected) > tolerance)
+      return false;
+  }
+  return true;
+}
+
+/** Check for a constant ratio between positive edges. As for isLinear() the
+ * last bin can have any width.
+ * @return true if all but the last bin have the same ratio of edges
+ */
+bool EventBinner::isLogarithmic() const {
+  const size_t last = m_numBins - 1;
+  if (!(m_xMin > 0.) || !std::isfinite(m_xMax) || !(m_xMax > m_X[last]))
+    return false;
+  // Compare each pair of edges with the ratio of the first bin. This avoids
+  // taking the log of every edge.
+  const double ratio = m_X[1] / m_X[0];
+  if (!(ratio > 1.))
+    return false;
+  for (size_t i = 1; i < last; ++i) {
+    const double width = m_X[i + 1] - m_X[i];
+    if (std::abs(m_X[i + 1] - m_X[i] * ratio) > SPACING_TOLERANCE * width)
+      return false;
+  }
+  return true;
+}
+
+/** Estimate the bins of a block of times-of-flight. Values outside the bins
+ * are given a bin in range that must be ignored. For computed spacings the
+ * estimate can be one bin out because of rounding; see correctBin().
+ * @param tofs :: times-of-flight
+ * @param count :: number of times-of-flight
+ * @param bins :: estimated bins returned
+ */
+void EventBinner::estimateBins(const double *tofs, const size_t count,
+                               int *bins) const {
+  const double lastBin = static_cast<double>(m_numBins - 1);
+  const double xMin = m_xMin;
+  const double scale = m_scale;
+  switch (m_spacing) {
+  case Spacing::Linear:
+    for (size_t i = 0; i < count; ++i) {
+      const double position = (tofs[i] - xMin) * scale;
+      bins[i] = static_cast<int>(std::max(0., std::min(position, lastBin)));
+    }
+    break;
+  case Spacing::Logarithmic:
+    for (size_t i = 0; i < count; ++i) {
+      const double position = std::log(tofs[i] / xMin) * scale;
+      bins[i] = static_cast<int>(std::max(0., std::min(position, lastBin)));
+    }
+    break;
+  case Spacing::Irregular:
+    for (size_t i = 0; i < count; ++i) {
+      const auto edge = std::upper_bound(m_X.begin(), m_X.end(), tofs[i]);
+      const auto bin = static_cast<int>(edge - m_X.begin()) - 1;
+      bins[i] = std::max(0, std::min(bin, static_cast<int>(m_numBins) - 1));
+    }
+    break;
+  }
+}
+
+} // namespace DataObjects
+} // namespace Mantid
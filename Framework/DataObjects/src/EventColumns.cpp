@@ -0,0 +1,415 @@
+#include "MantidDataObjects/EventColumns.h"
+#include "MantidDataObjects/EventBinner.h"
+#include "MantidDataObjects/EventList.h"
+#include "MantidDataObjects/RadixSort.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+
+namespace Mantid {
+namespace DataObjects {
+using API::EventType;
+using Kernel::DateAndTime;
+
+namespace {
+/** Find the order of n events sorted by the given radix sort keys.
+ * @param n :: the number of events
+ * @param keysOf :: functions returning the key(s) of the event at an index
+ * @return the indices of the events in sorted order
+ */
+template <class... KeyFunctions>
+std::vector<std::size_t> sortedOrder(std::size_t n, KeyFunctions... keysOf) {
+  std::vector<std::size_t> order(n);
+  std::iota(order.begin(), order.end(), 0);
+  RadixSort::sort(order, keysOf...);
+  return order;
+}
+}
+
+/** Constructor, creating empty columns
+ * @param type :: the type of event that will be stored
+ */
+EventColumns::EventColumns(API::EventType type)
+    : m_eventType(type), m_sortedByTof(true) {}
+
+/** Constructor, copying the events of an EventList into columns
+ * @param eventList :: the EventList to copy
+ */
+EventColumns::EventColumns(const EventList &eventList)
+    : m_eventType(eventList.getEventType()),
+      m_sortedByTof(eventList.isSortedByTof()) {
+  switch (m_eventType) {
+  case API::TOF:
+    append(eventList.getEvents());
+    break;
+  case API::WEIGHTED:
+    append(eventList.getWeightedEvents());
+    break;
+  case API::WEIGHTED_NOTIME:
+    append(eventList.getWeightedEventsNoTime());
+    break;
+  }
+  // append() resets the flag; the list knows better.
+  m_sortedByTof = eventList.isSortedByTof() || m_tofs.size() < 2;
+}
+
+/// @return the type of event held in the columns
+EventType EventColumns::getEventType() const { return m_eventType; }
+
+/// @return true if the pulse time column is in use
+bool EventColumns::hasPulseTimes() const {
+  return m_eventType != API::WEIGHTED_NOTIME;
+}
+
+/// @return true if the weight and error columns are in use
+bool EventColumns::hasWeights() const { return m_eventType != API::TOF; }
+
+/// @return the number of events
+std::size_t EventColumns::size() const { return m_tofs.size(); }
+
+/// @return true if there are no events
+bool EventColumns::empty() const { return m_tofs.empty(); }
+
+/// Remove all events and release the memory held by the columns
+void EventColumns::clear() {
+  std::vector<double>().swap(m_tofs);
+  std::vector<int64_t>().swap(m_pulseTimes);
+  std::vector<float>().swap(m_weights);
+  std::vector<float>().swap(m_errorSquareds);
+  m_sortedByTof = true;
+}
+
+/** Reserve space in the columns that are in use
+ * @param num :: number of events to reserve space for
+ */
+void EventColumns::reserve(std::size_t num) {
+  m_tofs.reserve(num);
+  if (hasPulseTimes())
+    m_pulseTimes.reserve(num);
+  if (hasWeights()) {
+    m_weights.reserve(num);
+    m_errorSquareds.reserve(num);
+  }
+}
+
+/** Memory used by the columns. As for EventList this reports the capacity
+ * of the vectors rather than their size.
+ * @return the memory used, in bytes
+ */
+std::size_t EventColumns::getMemorySize() const {
+  return m_tofs.capacity() * sizeof(double) +
+         m_pulseTimes.capacity() * sizeof(int64_t) +
+         (m_weights.capacity() + m_errorSquareds.capacity()) * sizeof(float) +
+         sizeof(EventColumns);
+}
+
+/** Append a single TofEvent
+ * @param event :: event to append
+ */
+void EventColumns::append(const TofEvent &event) {
+  checkType(API::TOF);
+  if (m_sortedByTof && !m_tofs.empty() && event.tof() < m_tofs.back())
+    m_sortedByTof = false;
+  m_tofs.push_back(event.tof());
+  m_pulseTimes.push_back(event.pulseTime().totalNanoseconds());
+}
+
+/** Append a single WeightedEvent
+ * @param event :: event to append
+ */
+void EventColumns::append(const WeightedEvent &event) {
+  checkType(API::WEIGHTED);
+  if (m_sortedByTof && !m_tofs.empty() && event.tof() < m_tofs.back())
+    m_sortedByTof = false;
+  m_tofs.push_back(event.tof());
+  m_pulseTimes.push_back(event.pulseTime().totalNanoseconds());
+  m_weights.push_back(event.m_weight);
+  m_errorSquareds.push_back(event.m_errorSquared);
+}
+
+/** Append a single WeightedEventNoTime
+ * @param event :: event to append
+ */
+void EventColumns::append(const WeightedEventNoTime &event) {
+  checkType(API::WEIGHTED_NOTIME);
+  if (m_sortedByTof && !m_tofs.empty() && event.tof() < m_tofs.back())
+    m_sortedByTof = false;
+  m_tofs.push_back(event.tof());
+  m_weights.push_back(event.m_weight);
+  m_errorSquareds.push_back(event.m_errorSquared);
+}
+
+/** Replace the events of an EventList with the contents of the columns.
+ * Detector IDs, X values and the spectrum number of the list are kept.
+ * @param eventList :: the EventList to fill
+ * @throw std::runtime_error if the list holds a more general event type than
+ * the columns, as EventList can't switch back to it. The list is then left
+ * unchanged.
+ */
+void EventColumns::copyTo(EventList &eventList) const {
+  const EventType listType = eventList.getEventType();
+  if (listType != m_eventType &&
+      (listType == API::WEIGHTED_NOTIME || m_eventType == API::TOF))
+    throw std::runtime_error("EventColumns::copyTo(): the EventList holds a "
+                             "more general event type than the columns.");
+  eventList.clear(false);
+  eventList.switchTo(m_eventType);
+  switch (m_eventType) {
+  case API::TOF:
+    copyTo(eventList.getEvents());
+    break;
+  case API::WEIGHTED:
+    copyTo(eventList.getWeightedEvents());
+    break;
+  case API::WEIGHTED_NOTIME:
+    copyTo(eventList.getWeightedEventsNoTime());
+    break;
+  }
+  eventList.setSortOrder(m_sortedByTof ? TOF_SORT : UNSORTED);
+}
+
+/** Replace the contents of a vector of TofEvent's with the columns
+ * @param events :: the vector to fill
+ * @throw std::invalid_argument if the columns do not hold TofEvent's
+ */
+void EventColumns::copyTo(std::vector<TofEvent> &events) const {
+  checkType(API::TOF);
+  events.clear();
+  events.reserve(size());
+  for (std::size_t i = 0; i < size(); ++i)
+    events.emplace_back(m_tofs[i], DateAndTime(m_pulseTimes[i]));
+}
+
+/** Replace the contents of a vector of WeightedEvent's with the columns
+ * @param events :: the vector to fill
+ * @throw std::invalid_argument if the columns do not hold WeightedEvent's
+ */
+void EventColumns::copyTo(std::vector<WeightedEvent> &events) const {
+  checkType(API::WEIGHTED);
+  events.clear();
+  events.reserve(size());
+  for (std::size_t i = 0; i < size(); ++i)
+    events.emplace_back(m_tofs[i], DateAndTime(m_pulseTimes[i]), m_weights[i],
+                        m_errorSquareds[i]);
+}
+
+/** Replace the contents of a vector of WeightedEventNoTime's with the columns
+ * @param events :: the vector to fill
+ * @throw std::invalid_argument if the columns do not hold WeightedEventNoTime's
+ */
+void EventColumns::copyTo(std::vector<WeightedEventNoTime> &events) const {
+  checkType(API::WEIGHTED_NOTIME);
+  events.clear();
+  events.reserve(size());
+  for (std::size_t i = 0; i < size(); ++i)
+    events.emplace_back(m_tofs[i], m_weights[i], m_errorSquareds[i]);
+}
+
+/** Return the given event, converted to the most general event type.
+ * @param index :: index of the event
+ * @return a WeightedEvent
+ */
+WeightedEvent EventColumns::getEvent(std::size_t index) const {
+  const DateAndTime pulse(hasPulseTimes() ? m_pulseTimes[index] : 0);
+  if (!hasWeights())
+    return WeightedEvent(m_tofs[index], pulse, 1.0f, 1.0f);
+  return WeightedEvent(m_tofs[index], pulse, m_weights[index],
+                       m_errorSquareds[index]);
+}
+
+/// @return true if the events are sorted by time-of-flight
+bool EventColumns::isSortedByTof() const { return m_sortedByTof; }
+
+/** Set whether the events are sorted by time-of-flight, without sorting
+ * them. Used by EventList, which keeps track of the order of its events.
+ * @param sorted :: true if the tof column is in ascending order
+ */
+void EventColumns::setSortedByTof(bool sorted) {
+  m_sortedByTof = sorted || m_tofs.size() < 2;
+}
+
+/** Sort the events by time-of-flight. The sort order is computed from the
+ * tof column alone, with a radix sort, and then applied to the other columns.
+ */
+void EventColumns::sortTof() {
+  if (m_sortedByTof)
+    return;
+  const auto &tofs = m_tofs;
+  permute(sortedOrder(
+      size(), [&tofs](std::size_t i) { return RadixSort::key(tofs[i]); }));
+  m_sortedByTof = true;
+}
+
+/** Sort the events by pulse time. The order of events with the same pulse
+ * time is kept. Does nothing if there are no pulse times.
+ */
+void EventColumns::sortPulseTime() {
+  if (!hasPulseTimes())
+    return;
+  const auto &pulseTimes = m_pulseTimes;
+  permute(sortedOrder(size(), [&pulseTimes](std::size_t i) {
+    return RadixSort::key(pulseTimes[i]);
+  }));
+  m_sortedByTof = m_tofs.size() < 2;
+}
+
+/** Sort the events by pulse time, and events with the same pulse time by
+ * time-of-flight. Does nothing if there are no pulse times.
+ */
+void EventColumns::sortPulseTimeTof() {
+  if (!hasPulseTimes())
+    return;
+  const auto &pulseTimes = m_pulseTimes;
+  const auto &tofs = m_tofs;
+  permute(sortedOrder(
+      size(),
+      [&pulseTimes](std::size_t i) { return RadixSort::key(pulseTimes[i]); },
+      [&tofs](std::size_t i) { return RadixSort::key(tofs[i]); }));
+  m_sortedByTof = m_tofs.size() < 2;
+}
+
+/** Sort the events by their time at the sample, pulse time + tof * tofFactor
+ * + tofShift. Does nothing if there are no pulse times.
+ * @param tofFactor :: for the elastic case, L1 / (L1 + L2)
+ * @param tofShift :: tof offset in seconds
+ */
+void EventColumns::sortTimeAtSample(const double tofFactor,
+                                    const double tofShift) {
+  if (!hasPulseTimes())
+    return;
+  const auto &pulseTimes = m_pulseTimes;
+  const auto &tofs = m_tofs;
+  permute(sortedOrder(size(), [&](std::size_t i) {
+    return RadixSort::key(
+        pulseTimes[i] +
+        static_cast<int64_t>(tofFactor * (tofs[i] * 1.0E3) + tofShift * 1.0E9));
+  }));
+  m_sortedByTof = m_tofs.size() < 2;
+}
+
+/// Reverse the order of the events
+void EventColumns::reverse() {
+  std::reverse(m_tofs.begin(), m_tofs.end());
+  std::reverse(m_pulseTimes.begin(), m_pulseTimes.end());
+  std::reverse(m_weights.begin(), m_weights.end());
+  std::reverse(m_errorSquareds.begin(), m_errorSquareds.end());
+  m_sortedByTof = m_tofs.size() < 2;
+}
+
+/** Convert the time-of-flight by tof' = tof * factor + offset.
+ * Only the tof column is touched.
+ * @param factor :: multiply by this
+ * @param offset :: then add this
+ */
+void EventColumns::convertTof(const double factor, const double offset) {
+  double *tof = m_tofs.data();
+  const std::size_t n = m_tofs.size();
+  for (std::size_t i = 0; i < n; ++i)
+    tof[i] = tof[i] * factor + offset;
+  if (factor < 0. && m_sortedByTof) {
+    // A negative factor reverses a sorted list; flip it to keep it sorted.
+    reverse();
+    m_sortedByTof = true;
+  }
+}
+
+/** Convert the time-of-flight using an arbitrary function. The events are
+ * marked as unsorted afterwards.
+ * @param func :: function applied to every time-of-flight
+ */
+void EventColumns::convertTof(std::function<double(double)> func) {
+  std::transform(m_tofs.begin(), m_tofs.end(), m_tofs.begin(), func);
+  m_sortedByTof = m_tofs.size() < 2;
+}
+
+/** Histogram the events against the given bin boundaries. This does not
+ * require the events to be sorted; unsorted columns are binned with an
+ * EventBinner, which computes the bins of linear and logarithmic edges and
+ * otherwise searches for them.
+ *
+ * @param X :: bin boundaries
+ * @param Y :: counts (sum of weights) returned
+ * @param E :: errors returned
+ * @param skipError :: skip calculating the errors. Only used for TOF events.
+ */
+void EventColumns::generateHistogram(const MantidVec &X, MantidVec &Y,
+                                     MantidVec &E, bool skipError) const {
+  if (X.size() <= 1) {
+    Y.clear();
+    E.clear();
+    return;
+  }
+  const std::size_t nBins = X.size() - 1;
+  Y.assign(nBins, 0.0);
+  E.assign(nBins, 0.0);
+
+  const bool weighted = hasWeights();
+  if (m_sortedByTof) {
+    // Events and bins are both sorted so walk along both together.
+    auto first = std::lower_bound(m_tofs.begin(), m_tofs.end(), X.front());
+    std::size_t bin = 0;
+    for (auto i = static_cast<std::size_t>(first - m_tofs.begin());
+         i < m_tofs.size(); ++i) {
+      const double tof = m_tofs[i];
+      while (bin < nBins && tof >= X[bin + 1])
+        ++bin;
+      if (bin == nBins)
+        break;
+      if (weighted) {
+        Y[bin] += static_cast<double>(m_weights[i]);
+        E[bin] += static_cast<double>(m_errorSquareds[i]);
+      } else {
+        Y[bin] += 1.0;
+      }
+    }
+  } else {
+    EventBinner binner(X);
+    if (weighted)
+      binner.addWeights(m_tofs.data(), m_weights.data(),
+                        m_errorSquareds.data(), m_tofs.size(), Y, E);
+    else
+      binner.addCounts(m_tofs.data(), m_tofs.size(), Y);
+  }
+
+  if (weighted) {
+    std::transform(E.begin(), E.end(), E.begin(),
+                   static_cast<double (*)(double)>(std::sqrt));
+  } else if (!skipError) {
+    std::transform(Y.begin(), Y.end(), E.begin(),
+                   static_cast<double (*)(double)>(std::sqrt));
+  }
+}
+
+/** Throw if an event of the given type can't be stored in the columns.
+ * @param type :: the type of event being added
+ */
+void EventColumns::checkType(API::EventType type) const {
+  if (type != m_eventType)
+    throw std::invalid_argument(
+        "EventColumns: event type does not match the type of the columns.");
+}
+
+/** Reorder all columns in use so that element i becomes element order[i].
+ * @param order :: the new order of the events
+ */
+void EventColumns::permute(const std::vector<std::size_t> &order) {
+  auto gather = [&order](auto &column) {
+    using Column = typename std::decay<decltype(column)>::type;
+    Column sorted(column.size());
+    for (std::size_t i = 0; i < order.size(); ++i)
+      sorted[i] = column[order[i]];
+    column.swap(sorted);
+  };
+  gather(m_tofs);
+  if (hasPulseTimes())
+    gather(m_pulseTimes);
+  if (hasWeights()) {
+    gather(m_weights);
+    gather(m_errorSquareds);
+  }
+}
+
+} // namespace DataObjects
+} // namespace Mantid
@@ -1,9 +1,15 @@
 #include "MantidDataObjects/EventList.h"
 #include "MantidAPI/MatrixWorkspace.h"
+#include "MantidDataObjects/EventBinner.h"
+#include "MantidDataObjects/EventColumns.h"
 #include "MantidDataObjects/EventWorkspaceMRU.h"
+#include "MantidDataObjects/RadixSort.h"
 #include "MantidKernel/DateAndTime.h"
 #include "MantidKernel/Exception.h"
 #include "MantidKernel/Logger.h"
+#include "MantidKernel/ThreadPoolRunnable.h"
+#include "MantidKernel/make_unique.h"
+#include <algorithm>
 #include <cfloat>
 
 #include <cmath>
@@ -41,37 +47,38 @@ int64_t calculateCorrectedFullTime(const int64_t &totalNanoseconds,
          static_cast<int64_t>(tofFactor * (tof * 1.0E3) + (tofShift * 1.0E9));
 }
 
-/**
- * Type for comparing events in terms of time at sample
- */
-template <typename EventType>
-class CompareTimeAtSample
-    : public std::binary_function<EventType, EventType, bool> {
-private:
-  const double m_tofFactor;
-  const double m_tofShift;
-
-public:
-  CompareTimeAtSample(const double &tofFactor, const double &tofShift)
-      : m_tofFactor(tofFactor), m_tofShift(tofShift) {}
-
-  /**
-   * Compare two events based on the time they arrived at the sample.
-   * Coefficient is used to provide scaling.
-   * For elastic scattering coefficient is L1 / (L1 + L2)
-   * @param e1 :: first event to compare
-   * @param e2 :: second event to compare
-   * @param coefficient :: scaling coefficient
-   * @return True if first event evaluates to be < second event, otherwise false
-   */
-  bool operator()(const EventType &e1, const EventType &e2) const {
-    const auto tAtSample1 = calculateCorrectedFullTime(
-        e1.pulseTime().totalNanoseconds(), e1.tof(), m_tofFactor, m_tofShift);
-    const auto tAtSample2 = calculateCorrectedFullTime(
-        e2.pulseTime().totalNanoseconds(), e2.tof(), m_tofFactor, m_tofShift);
-    return (tAtSample1 < tAtSample2);
-  }
+/// Radix sort key of the time-of-flight of an event
+const auto tofKey = [](const auto &event) {
+  return RadixSort::key(event.tof());
+};
+
+/// Radix sort key of the pulse time of an event
+const auto pulseTimeKey = [](const auto &event) {
+  return RadixSort::key(event.pulseTime().totalNanoseconds());
 };
+
+/** Radix sort key of the pulse time of a CompactTofEvent
+ * @param pulseTimes :: the pulse time table of the events
+ * @return the key function
+ */
+auto compactPulseTimeKey(const std::vector<DateAndTime> &pulseTimes) {
+  return [&pulseTimes](const CompactTofEvent &event) {
+    return RadixSort::key(pulseTimes[event.pulseIndex()].totalNanoseconds());
+  };
+}
+
+/** Number of threads to use to sort an event list. Lists sorted from a
+ * thread pool (e.g. EventWorkspace::sortAll) or a parallel loop are already
+ * sorted concurrently, so they use one thread each.
+ * @param numEvents :: the number of events in the list
+ * @return the number of threads
+ */
+int sortThreads(const size_t numEvents) {
+  if (numEvents <= NUM_EVENTS_PARALLEL_THRESHOLD || PARALLEL_IN_REGION ||
+      Kernel::ThreadPoolRunnable::inPoolThread())
+    return 1;
+  return PARALLEL_GET_MAX_THREADS;
+}
 }
 //==========================================================================
 /// --------------------- TofEvent Comparators
@@ -85,31 +92,6 @@ template <typename T> bool compareEventTof(const T &e1, const T &e2) {
   return (e1.tof() < e2.tof());
 }
 
-/** Compare two events' FRAME id, return true if e1 should be before e2.
- * @param e1 :: first event
- * @param e2 :: second event
- *  */
-bool compareEventPulseTime(const TofEvent &e1, const TofEvent &e2) {
-  return (e1.pulseTime() < e2.pulseTime());
-}
-
-/** Compare two events' FRAME id, return true if e1 should be before e2.
- *  Assuming that if e1's pulse time is earlier than e2's, then e1 must be
- * earlier regardless TOF value
- * @param e1 :: first event
- * @param e2 :: second event
- *  */
-bool compareEventPulseTimeTOF(const TofEvent &e1, const TofEvent &e2) {
-
-  if (e1.pulseTime() < e2.pulseTime()) {
-    return true;
-  } else if ((e1.pulseTime() == e2.pulseTime()) && (e1.tof() < e2.tof())) {
-    return true;
-  }
-
-  return false;
-}
-
 /// Constructor (empty)
 // EventWorkspace is always histogram data and so is thus EventList
 EventList::EventList()
@@ -281,6 +263,12 @@ EventList &EventList::operator=(const EventList &rhs) {
   events = rhs.events;
   weightedEvents = rhs.weightedEvents;
   weightedEventsNoTime = rhs.weightedEventsNoTime;
+  compactEvents = rhs.compactEvents;
+  m_compactPulseTimes = rhs.m_compactPulseTimes;
+  m_compactExpanded = rhs.m_compactExpanded.load();
+  m_columns = rhs.m_columns ? Kernel::make_unique<EventColumns>(*rhs.m_columns)
+                            : nullptr;
+  m_columnsExpanded = rhs.m_columnsExpanded.load();
   eventType = rhs.eventType;
   order = rhs.order;
   return *this;
@@ -292,6 +280,7 @@ EventList &EventList::operator=(const EventList &rhs) {
  * @return reference to this
  * */
 EventList &EventList::operator+=(const TofEvent &event) {
+  this->unpackEvents();
 
   switch (this->eventType) {
   case TOF:
@@ -320,6 +309,7 @@ EventList &EventList::operator+=(const TofEvent &event) {
  * @return reference to this
  * */
 EventList &EventList::operator+=(const std::vector<TofEvent> &more_events) {
+  this->unpackEvents();
   switch (this->eventType) {
   case TOF:
     // Simply push the events
@@ -360,6 +350,7 @@ EventList &EventList::operator+=(const std::vector<TofEvent> &more_events) {
  * @return reference to this
  * */
 EventList &EventList::operator+=(const WeightedEvent &event) {
+  this->unpackEvents();
   this->switchTo(WEIGHTED);
   this->weightedEvents.push_back(event);
   this->order = UNSORTED;
@@ -376,6 +367,7 @@ EventList &EventList::operator+=(const WeightedEvent &event) {
  * */
 EventList &EventList::
 operator+=(const std::vector<WeightedEvent> &more_events) {
+  this->unpackEvents();
   switch (this->eventType) {
   case TOF:
     // Need to switch to weighted
@@ -413,6 +405,7 @@ operator+=(const std::vector<WeightedEvent> &more_events) {
  * */
 EventList &EventList::
 operator+=(const std::vector<WeightedEventNoTime> &more_events) {
+  this->unpackEvents();
   switch (this->eventType) {
   case TOF:
   case WEIGHTED:
@@ -441,6 +434,7 @@ operator+=(const std::vector<WeightedEventNoTime> &more_events) {
  * @return reference to this
  * */
 EventList &EventList::operator+=(const EventList &more_events) {
+  more_events.expandEvents();
   // We'll let the += operator for the given vector of event lists handle it
   switch (more_events.getEventType()) {
   case TOF:
@@ -513,6 +507,8 @@ EventList &EventList::operator-=(const EventList &more_events) {
     this->clearData();
     return *this;
   }
+  this->unpackEvents();
+  more_events.expandEvents();
 
   // We'll let the -= operator for the given vector of event lists handle it
   switch (this->getEventType()) {
@@ -567,6 +563,8 @@ bool EventList::operator==(const EventList &rhs) const {
     return false;
   if (this->eventType != rhs.eventType)
     return false;
+  this->expandEvents();
+  rhs.expandEvents();
   // Check all event lists; The empty ones will compare equal
   if (events != rhs.events)
     return false;
@@ -592,6 +590,8 @@ bool EventList::equals(const EventList &rhs, const double tolTof,
     return false;
   if (this->eventType != rhs.eventType)
     return false;
+  this->expandEvents();
+  rhs.expandEvents();
 
   // loop over the events
   size_t numEvents = this->getNumberEvents();
@@ -674,6 +674,7 @@ void EventList::switchToWeightedEvents() {
     break;
 
   case TOF:
+    unpackEvents();
     weightedEventsNoTime.clear();
     // Convert and copy all TofEvents to the weightedEvents list.
     this->weightedEvents.assign(events.cbegin(), events.cend());
@@ -695,6 +696,7 @@ void EventList::switchToWeightedEventsNoTime() {
     return;
 
   case TOF: {
+    unpackEvents();
     // Convert and copy all TofEvents to the weightedEvents list.
     this->weightedEventsNoTime.assign(events.cbegin(), events.cend());
     // Get rid of the old events
@@ -704,6 +706,7 @@ void EventList::switchToWeightedEventsNoTime() {
   } break;
 
   case WEIGHTED: {
+    unpackEvents();
     // Convert and copy all TofEvents to the weightedEvents list.
     this->weightedEventsNoTime.assign(weightedEvents.cbegin(),
                                       weightedEvents.cend());
@@ -727,6 +730,7 @@ void EventList::switchToWeightedEventsNoTime() {
  * @return a WeightedEvent
  */
 WeightedEvent EventList::getEvent(size_t event_number) {
+  unpackEvents();
   switch (eventType) {
   case TOF:
     return WeightedEvent(events[event_number]);
@@ -757,6 +761,7 @@ const std::vector<TofEvent> &EventList::getEvents() const {
     throw std::runtime_error("EventList::getEvents() called for an EventList "
                              "that has weights. Use getWeightedEvents() or "
                              "getWeightedEventsNoTime().");
+  expandEvents();
   return this->events;
 }
 
@@ -772,6 +777,7 @@ std::vector<TofEvent> &EventList::getEvents() {
     throw std::runtime_error("EventList::getEvents() called for an EventList "
                              "that has weights. Use getWeightedEvents() or "
                              "getWeightedEventsNoTime().");
+  unpackEvents();
   return this->events;
 }
 
@@ -787,6 +793,7 @@ std::vector<WeightedEvent> &EventList::getWeightedEvents() {
     throw std::runtime_error("EventList::getWeightedEvents() called for an "
                              "EventList not of type WeightedEvent. Use "
                              "getEvents() or getWeightedEventsNoTime().");
+  unpackEvents();
   return this->weightedEvents;
 }
 
@@ -802,6 +809,7 @@ const std::vector<WeightedEvent> &EventList::getWeightedEvents() const {
     throw std::runtime_error("EventList::getWeightedEvents() called for an "
                              "EventList not of type WeightedEvent. Use "
                              "getEvents() or getWeightedEventsNoTime().");
+  expandEvents();
   return this->weightedEvents;
 }
 
@@ -815,6 +823,7 @@ std::vector<WeightedEventNoTime> &EventList::getWeightedEventsNoTime() {
     throw std::runtime_error("EventList::getWeightedEvents() called for an "
                              "EventList not of type WeightedEventNoTime. Use "
                              "getEvents() or getWeightedEvents().");
+  unpackEvents();
   return this->weightedEventsNoTime;
 }
 
@@ -829,9 +838,236 @@ EventList::getWeightedEventsNoTime() const {
     throw std::runtime_error("EventList::getWeightedEventsNoTime() called for "
                              "an EventList not of type WeightedEventNoTime. "
                              "Use getEvents() or getWeightedEvents().");
+  expandEvents();
   return this->weightedEventsNoTime;
 }
 
+/** Store the events of this list as CompactTofEvent's, referring to the given
+ * table of pulse times. This is only possible for an un-weighted list that has
+ * no events yet; events are then added with getCompactEvents().
+ *
+ * @param pulseTimes :: table of pulse times indexed by the events. It is
+ *        usually shared by every list of a bank.
+ * @return true if the list now holds compact events using pulseTimes.
+ * @throw std::invalid_argument if pulseTimes is null.
+ */
+bool EventList::switchToCompactEvents(
+    const PulseTimeTable_const_sptr &pulseTimes) {
+  if (!pulseTimes)
+    throw std::invalid_argument(
+        "EventList::switchToCompactEvents() called without pulse times.");
+  if (m_compactPulseTimes) {
+    // An empty compact list can simply change table.
+    if (m_compactPulseTimes != pulseTimes && !compactEvents.empty())
+      return false;
+    events.clear();
+    m_compactExpanded = false;
+    m_compactPulseTimes = pulseTimes;
+    return true;
+  }
+  if (m_columns) {
+    if (!m_columns->empty())
+      return false;
+    switchFromColumns();
+  }
+  if (eventType != TOF || !events.empty())
+    return false;
+  std::vector<TofEvent>().swap(this->events); // STL Trick to release memory
+  m_compactPulseTimes = pulseTimes;
+  return true;
+}
+
+/// @return true if the events are held as CompactTofEvent's
+bool EventList::hasCompactEvents() const {
+  return static_cast<bool>(m_compactPulseTimes);
+}
+
+/** Return the list of CompactTofEvent contained.
+ * @return a reference to the list of compact events
+ * @throw std::runtime_error if the list does not hold compact events.
+ */
+std::vector<CompactTofEvent> &EventList::getCompactEvents() {
+  if (!m_compactPulseTimes)
+    throw std::runtime_error("EventList::getCompactEvents() called for an "
+                             "EventList that does not hold compact events. "
+                             "Call switchToCompactEvents() first.");
+  // The caller may change the events, so a copy made earlier is stale.
+  if (m_compactExpanded) {
+    std::vector<TofEvent>().swap(this->events);
+    m_compactExpanded = false;
+  }
+  return this->compactEvents;
+}
+
+/** Return the list of CompactTofEvent contained.
+ * @return a const reference to the list of compact events
+ * @throw std::runtime_error if the list does not hold compact events.
+ */
+const std::vector<CompactTofEvent> &EventList::getCompactEvents() const {
+  if (!m_compactPulseTimes)
+    throw std::runtime_error("EventList::getCompactEvents() called for an "
+                             "EventList that does not hold compact events. "
+                             "Call switchToCompactEvents() first.");
+  return this->compactEvents;
+}
+
+/// @return the pulse times referred to by the compact events, or null.
+PulseTimeTable_const_sptr EventList::getCompactPulseTimes() const {
+  return m_compactPulseTimes;
+}
+
+/** Fill events with a copy of the CompactTofEvent's, looking up the pulse
+ * times, so that const methods can read them as TofEvent's. The compact
+ * events are left untouched, so this is safe to call from several threads
+ * reading the same list. Does nothing if the list is not compact or the copy
+ * exists already. Must not be called while m_sortMutex is held.
+ */
+void EventList::expandCompactEvents() const {
+  if (!m_compactPulseTimes || m_compactExpanded.load(std::memory_order_acquire))
+    return;
+  std::lock_guard<std::mutex> _lock(m_sortMutex);
+  // Another thread may have done it while waiting for the lock.
+  if (m_compactExpanded.load(std::memory_order_relaxed))
+    return;
+  const auto &pulseTimes = *m_compactPulseTimes;
+  events.clear();
+  events.reserve(compactEvents.size());
+  for (const auto &event : compactEvents)
+    events.emplace_back(event.m_tof, pulseTimes[event.m_pulseIndex]);
+  m_compactExpanded.store(true, std::memory_order_release);
+}
+
+/** Bring the copy made by expandCompactEvents() back in line with the
+ * compact events after they were reordered. Must be called with m_sortMutex
+ * held.
+ */
+void EventList::updateExpandedCompactEvents() const {
+  if (!m_compactExpanded.load(std::memory_order_relaxed))
+    return;
+  const auto &pulseTimes = *m_compactPulseTimes;
+  for (size_t i = 0; i < compactEvents.size(); ++i)
+    events[i] = TofEvent(compactEvents[i].m_tof,
+                         pulseTimes[compactEvents[i].m_pulseIndex]);
+}
+
+/** Convert CompactTofEvent's back to TofEvent's and stop using compact
+ * storage, before the events of the list are modified. Does nothing if the
+ * list is not compact.
+ */
+void EventList::dropCompactEvents() {
+  if (!m_compactPulseTimes)
+    return;
+  expandCompactEvents();
+  std::vector<CompactTofEvent>().swap(compactEvents);
+  m_compactPulseTimes.reset();
+  m_compactExpanded = false;
+}
+
+/** Store the events of this list in an EventColumns, with separate arrays for
+ * the time-of-flight, pulse time and weights. Sorting, converting and
+ * histogramming in time-of-flight then only stream through the columns they
+ * need. Compact events are expanded first. Does nothing if the list is
+ * columnar already.
+ */
+void EventList::switchToColumns() {
+  if (m_columns)
+    return;
+  dropCompactEvents();
+  m_columns = Kernel::make_unique<EventColumns>(*this);
+  std::vector<TofEvent>().swap(this->events); // STL Trick to release memory
+  std::vector<WeightedEvent>().swap(this->weightedEvents);
+  std::vector<WeightedEventNoTime>().swap(this->weightedEventsNoTime);
+  m_columnsExpanded = false;
+}
+
+/** Move the events of a columnar list back into the event vectors. Does
+ * nothing if the list is not columnar.
+ */
+void EventList::switchFromColumns() {
+  if (!m_columns)
+    return;
+  expandColumns();
+  m_columns.reset();
+  m_columnsExpanded = false;
+}
+
+/// @return true if the events are held in an EventColumns
+bool EventList::hasColumns() const { return static_cast<bool>(m_columns); }
+
+/** Fill the event vector of the list's event type with a copy of the columns,
+ * so that const methods can read them. As for compact events the columns are
+ * left untouched, and this is safe to call from several threads reading the
+ * same list. Does nothing if the list is not columnar or the copy exists
+ * already. Must not be called while m_sortMutex is held.
+ */
+void EventList::expandColumns() const {
+  if (!m_columns || m_columnsExpanded.load(std::memory_order_acquire))
+    return;
+  std::lock_guard<std::mutex> _lock(m_sortMutex);
+  // Another thread may have done it while waiting for the lock.
+  if (m_columnsExpanded.load(std::memory_order_relaxed))
+    return;
+  switch (eventType) {
+  case TOF:
+    m_columns->copyTo(events);
+    break;
+  case WEIGHTED:
+    m_columns->copyTo(weightedEvents);
+    break;
+  case WEIGHTED_NOTIME:
+    m_columns->copyTo(weightedEventsNoTime);
+    break;
+  }
+  m_columnsExpanded.store(true, std::memory_order_release);
+}
+
+/** Bring the copy made by expandColumns() back in line with the columns after
+ * they were reordered. Must be called with m_sortMutex held.
+ */
+void EventList::updateExpandedColumns() const {
+  if (!m_columnsExpanded.load(std::memory_order_relaxed))
+    return;
+  // The vectors keep their capacity, so references to them stay valid.
+  switch (eventType) {
+  case TOF:
+    m_columns->copyTo(events);
+    break;
+  case WEIGHTED:
+    m_columns->copyTo(weightedEvents);
+    break;
+  case WEIGHTED_NOTIME:
+    m_columns->copyTo(weightedEventsNoTime);
+    break;
+  }
+}
+
+/// Discard the copy made by expandColumns(), before the columns are changed.
+void EventList::clearExpandedColumns() {
+  if (!m_columnsExpanded)
+    return;
+  std::vector<TofEvent>().swap(this->events); // STL Trick to release memory
+  std::vector<WeightedEvent>().swap(this->weightedEvents);
+  std::vector<WeightedEventNoTime>().swap(this->weightedEventsNoTime);
+  m_columnsExpanded = false;
+}
+
+/** Make the event vectors readable for a list held as compact events or as
+ * columns, by filling them with a copy of the events. Must not be called
+ * while m_sortMutex is held.
+ */
+void EventList::expandEvents() const {
+  expandCompactEvents();
+  expandColumns();
+}
+
+/** Move the events of a list held as compact events or as columns back into
+ * the event vectors, before the events are modified.
+ */
+void EventList::unpackEvents() {
+  dropCompactEvents();
+  switchFromColumns();
+}
+
 /** Clear the list of events and any
  * associated detector ID's.
  * */
@@ -846,6 +1082,12 @@ void EventList::clear(const bool removeDetIDs) {
   this->weightedEventsNoTime.clear();
   std::vector<WeightedEventNoTime>().swap(
       this->weightedEventsNoTime); // STL Trick to release memory
+  std::vector<CompactTofEvent>().swap(
+      this->compactEvents); // STL Trick to release memory
+  m_compactPulseTimes.reset();
+  m_compactExpanded = false;
+  m_columns.reset();
+  m_columnsExpanded = false;
   if (removeDetIDs)
     this->clearDetectorIDs();
 }
@@ -855,9 +1097,19 @@ void EventList::clear(const bool removeDetIDs) {
  * Memory is freed.
  * */
 void EventList::clearUnused() {
-  if (eventType != TOF) {
+  if (m_columns) {
+    if (m_columns->getEventType() == eventType) {
+      clearExpandedColumns();
+    } else {
+      // The type changed, so the events are no longer in the columns.
+      m_columns.reset();
+      m_columnsExpanded = false;
+    }
+  }
+  if (eventType != TOF || m_compactPulseTimes) {
     this->events.clear();
     std::vector<TofEvent>().swap(this->events); // STL Trick to release memory
+    m_compactExpanded = false;
   }
   if (eventType != WEIGHTED) {
     this->weightedEvents.clear();
@@ -869,6 +1121,12 @@ void EventList::clearUnused() {
     std::vector<WeightedEventNoTime>().swap(
         this->weightedEventsNoTime); // STL Trick to release memory
   }
+  if (eventType != TOF || !m_compactPulseTimes) {
+    std::vector<CompactTofEvent>().swap(
+        this->compactEvents); // STL Trick to release memory
+    m_compactPulseTimes.reset();
+    m_compactExpanded = false;
+  }
 }
 
 /// Mask the spectrum to this value. Removes all events.
@@ -889,7 +1147,14 @@ void EventList::setMRU(EventWorkspaceMRU *newMRU) { mru = newMRU; }
  *
  * @param num :: number of events that will be in this EventList
  */
-void EventList::reserve(size_t num) { this->events.reserve(num); }
+void EventList::reserve(size_t num) {
+  if (m_columns)
+    m_columns->reserve(num);
+  else if (m_compactPulseTimes)
+    this->compactEvents.reserve(num);
+  else
+    this->events.reserve(num);
+}
 
 // ==============================================================================================
 // --- Sorting functions -----------------------------------------------------
@@ -923,6 +1188,8 @@ void EventList::sort(const EventSortType order) const {
  */
 void EventList::setSortOrder(const EventSortType order) const {
   this->order = order;
+  if (m_columns)
+    m_columns->setSortedByTof(order == TOF_SORT);
 }
 
 //  // MergeSort from:
@@ -961,232 +1228,66 @@ void EventList::setSortOrder(const EventSortType order) const {
 //    merge(begin, begin_right, end);
 //  }
 
-//----------------------------------------------------------------------------------------------------
-/** Merge two sorted lists into one sorted vector.
- *
- * @tparam T :: the type in the vector.
- * @param begin1 :: iterator at the start of the first list.
- * @param end1 :: iterator at the end of the first list.
- * @param begin2 :: iterator at the start of the second list.
- * @param end2 :: iterator at the end of the second list.
- * @param result_vector :: a vector (by reference) that will be filled with the
- *result.
- * */
-template <typename T>
-void merge(typename std::vector<T>::iterator begin1,
-           typename std::vector<T>::iterator end1,
-           typename std::vector<T>::iterator begin2,
-           typename std::vector<T>::iterator end2,
-           typename std::vector<T> &result_vector) {
-  auto it1 = begin1;
-  auto it2 = begin2;
-  while (!((it1 == end1) && (it2 == end2))) {
-    if (it1 == end1) {
-      // Only it2 makes sense
-      result_vector.push_back(*it2);
-      it2++;
-    } else if (it2 == end2) {
-      // Only it1 makes sense
-      result_vector.push_back(*it1);
-      it1++;
-    } else {
-      // Both iterators are valid. Which is smaller?
-      if (*it1 < *it2) {
-        result_vector.push_back(*it1);
-        it1++;
-      } else {
-        result_vector.push_back(*it2);
-        it2++;
-      }
-    }
-  }
-}
-
-//----------------------------------------------------------------------------------------------------
-/** Perform a parallelized sort on a provided vector, using 2 threads.
- * NOTE: Will temporarily use twice the memory used by the incoming vector.
- *
- * @param vec :: a vector, by refe/rence, that will be sorted-in place.
- */
-template <typename T> void parallel_sort2(typename std::vector<T> &vec) {
-  size_t size = vec.size();
-
-  auto begin = vec.begin();
-  auto middle = begin + size / 2;
-  auto end = vec.end();
-
-  PRAGMA_OMP(parallel sections) {
-    PRAGMA_OMP(section) {
-      std::sort(begin, middle);
-      // std::cout << " ----------- Part 1 --------------\n"; for (typename
-      // std::vector<T>::iterator it = begin; it != middle; it++) std::cout <<
-      // *it << "\n";
-    }
-    PRAGMA_OMP(section) {
-      std::sort(middle, end);
-      // std::cout << " ----------- Part 2 --------------\n";for (typename
-      // std::vector<T>::iterator it = middle; it != end; it++) std::cout << *it
-      // << "\n";
-    }
-  }
-
-  // Now merge back
-  typename std::vector<T> temp;
-  merge(begin, middle, middle, end, temp);
-
-  // std::cout << " ----------- Part 1+2 --------------\n"; for (typename
-  // std::vector<T>::iterator it = temp.begin(); it != temp.end(); it++)
-  // std::cout << *it << "\n";
-  // Swap storage with the temp vector
-  vec.swap(temp);
-  // Which we can now clear
-  temp.clear();
-}
-
-//----------------------------------------------------------------------------------------------------
-/** Perform a parallelized sort on a provided vector, using 4 threads.
- * NOTE: Will temporarily use twice the memory used by the incoming vector.
- *
- * @param vec :: a vector, by reference, that will be sorted-in place.
- */
-template <typename T> void parallel_sort4(std::vector<T> &vec) {
-  // int num_cores = PARALLEL_NUMBER_OF_THREADS;
-  size_t size = vec.size();
-
-  auto begin = vec.begin();
-  auto middle1 = begin + size / 4;
-  auto middle2 = begin + size / 2;
-  auto middle3 = begin + 3 * size / 4;
-  auto end = vec.end();
-
-  PRAGMA_OMP(parallel sections) {
-    PRAGMA_OMP(section) { std::sort(begin, middle1); }
-    PRAGMA_OMP(section) { std::sort(middle1, middle2); }
-    PRAGMA_OMP(section) { std::sort(middle2, middle3); }
-    PRAGMA_OMP(section) { std::sort(middle3, end); }
-  }
-
-  // Now merge back
-  typename std::vector<T> temp1, temp2;
-  // PRAGMA_OMP(parallel sections)
-  {
-    // PRAGMA_OMP(section)
-    { merge(begin, middle1, middle1, middle2, temp1); }
-    // PRAGMA_OMP(section)
-    { merge(middle2, middle3, middle3, end, temp2); }
-  }
-
-  // We can clear the incoming vector to free up memory now,
-  //  because it is copied already in temp1, temp2
-  vec.clear();
-
-  // Final merge
-  std::vector<T> temp;
-  merge(temp1.begin(), temp1.end(), temp2.begin(), temp2.end(), temp);
-
-  // Clear out this temporary storage
-  temp1.clear();
-  temp2.clear();
-  std::vector<T>().swap(temp1);
-  std::vector<T>().swap(temp2);
-
-  // Swap storage with the temp vector
-  vec.swap(temp);
-  // Which we can now clear
-  temp.clear();
-}
-
 // --------------------------------------------------------------------------
-/** Sort events by TOF in one thread */
+/** Sort events by TOF. Long lists are sorted with all available threads. */
 void EventList::sortTof() const {
   if (this->order == TOF_SORT)
     return; // nothing to do
-
-  // Avoid sorting from multiple threads
-  std::lock_guard<std::mutex> _lock(m_sortMutex);
-  // If the list was sorted while waiting for the lock, return.
-  if (this->order == TOF_SORT)
-    return;
-
-  switch (eventType) {
-  case TOF:
-    std::sort(events.begin(), events.end(), compareEventTof<TofEvent>);
-    break;
-  case WEIGHTED:
-    std::sort(weightedEvents.begin(), weightedEvents.end(),
-              compareEventTof<WeightedEvent>);
-    break;
-  case WEIGHTED_NOTIME:
-    std::sort(weightedEventsNoTime.begin(), weightedEventsNoTime.end(),
-              compareEventTof<WeightedEventNoTime>);
-    break;
-  }
-  // Save the order to avoid unnecessary re-sorting.
-  this->order = TOF_SORT;
+  sortTofWithThreads(sortThreads(getNumberEvents()));
 }
 
 // --------------------------------------------------------------------------
 /** Sort events by TOF, using two threads.
- *
- * Performance for 5e7 events:
- *  - 40.5 secs with sortTof() (one thread)
- *  - 21.1 secs with sortTof2() (two threads)
- *  - 18.2 secs with sortTof4() (four threads)
  * Performance gain tends to go up with longer event lists.
  * */
 void EventList::sortTof2() const {
   if (this->order == TOF_SORT)
     return; // nothing to do
-
-  // Avoid sorting from multiple threads
-  std::lock_guard<std::mutex> _lock(m_sortMutex);
-  // If the list was sorted while waiting for the lock, return.
-  if (this->order == TOF_SORT)
-    return;
-
-  switch (eventType) {
-  case TOF:
-    parallel_sort2(events);
-    break;
-  case WEIGHTED:
-    parallel_sort2(weightedEvents);
-    break;
-  case WEIGHTED_NOTIME:
-    parallel_sort2(weightedEventsNoTime);
-    break;
-  }
-  // Save the order to avoid unnecessary re-sorting.
-  this->order = TOF_SORT;
+  sortTofWithThreads(2);
 }
 
 // --------------------------------------------------------------------------
-/** Sort events by TOF, using two threads.
- *
- * Performance for 5e7 events:
- *  - 40.5 secs with sortTof() (one thread)
- *  - 21.1 secs with sortTof2() (two threads)
- *  - 18.2 secs with sortTof4() (four threads)
+/** Sort events by TOF, using four threads.
  * Performance gain tends to go up with longer event lists.
  * */
 void EventList::sortTof4() const {
   if (this->order == TOF_SORT)
     return; // nothing to do
+  sortTofWithThreads(4);
+}
 
+// --------------------------------------------------------------------------
+/** Sort events by TOF with a radix sort on the TOF.
+ * @param numThreads :: number of threads to sort with
+ */
+void EventList::sortTofWithThreads(const int numThreads) const {
   // Avoid sorting from multiple threads
   std::lock_guard<std::mutex> _lock(m_sortMutex);
   // If the list was sorted while waiting for the lock, return.
   if (this->order == TOF_SORT)
     return;
 
+  if (m_columns) {
+    m_columns->sortTof();
+    updateExpandedColumns();
+    this->order = TOF_SORT;
+    return;
+  }
+
   switch (eventType) {
   case TOF:
-    parallel_sort4(events);
+    if (m_compactPulseTimes) {
+      RadixSort::sort(compactEvents, tofKey, numThreads);
+      updateExpandedCompactEvents();
+    } else {
+      RadixSort::sort(events, tofKey, numThreads);
+    }
     break;
   case WEIGHTED:
-    parallel_sort4(weightedEvents);
+    RadixSort::sort(weightedEvents, tofKey, numThreads);
     break;
   case WEIGHTED_NOTIME:
-    parallel_sort4(weightedEventsNoTime);
+    RadixSort::sort(weightedEventsNoTime, tofKey, numThreads);
     break;
   }
   // Save the order to avoid unnecessary re-sorting.
@@ -1215,21 +1316,42 @@ void EventList::sortTimeAtSample(const double &tofFactor,
   if (this->order == TIMEATSAMPLE_SORT && !forceResort)
     return;
 
+  if (m_columns) {
+    m_columns->sortTimeAtSample(tofFactor, tofShift);
+    updateExpandedColumns();
+    this->order = TIMEATSAMPLE_SORT;
+    return;
+  }
+
   // Perform sort.
+  const int numThreads = sortThreads(getNumberEvents());
+  auto timeAtSampleKey = [tofFactor, tofShift](const auto &event) {
+    return RadixSort::key(calculateCorrectedFullTime(
+        event.pulseTime().totalNanoseconds(), event.tof(), tofFactor,
+        tofShift));
+  };
   switch (eventType) {
-  case TOF: {
-    CompareTimeAtSample<TofEvent> comparitor(tofFactor, tofShift);
-    std::sort(events.begin(), events.end(), comparitor);
-  } break;
-  case WEIGHTED: {
-    CompareTimeAtSample<WeightedEvent> comparitor(tofFactor, tofShift);
-    std::sort(weightedEvents.begin(), weightedEvents.end(), comparitor);
-  } break;
-  case WEIGHTED_NOTIME: {
-    CompareTimeAtSample<WeightedEventNoTime> comparitor(tofFactor, tofShift);
-    std::sort(weightedEventsNoTime.begin(), weightedEventsNoTime.end(),
-              comparitor);
-  } break;
+  case TOF:
+    if (m_compactPulseTimes) {
+      const auto &pulseTimes = *m_compactPulseTimes;
+      auto compactKey = [&pulseTimes, tofFactor,
+                         tofShift](const CompactTofEvent &event) {
+        return RadixSort::key(calculateCorrectedFullTime(
+            pulseTimes[event.pulseIndex()].totalNanoseconds(), event.tof(),
+            tofFactor, tofShift));
+      };
+      RadixSort::sort(compactEvents, compactKey, numThreads);
+      updateExpandedCompactEvents();
+    } else {
+      RadixSort::sort(events, timeAtSampleKey, numThreads);
+    }
+    break;
+  case WEIGHTED:
+    RadixSort::sort(weightedEvents, timeAtSampleKey, numThreads);
+    break;
+  case WEIGHTED_NOTIME:
+    RadixSort::sort(weightedEventsNoTime, timeAtSampleKey, numThreads);
+    break;
   }
   // Save the order to avoid unnecessary re-sorting.
   this->order = TIMEATSAMPLE_SORT;
@@ -1247,14 +1369,28 @@ void EventList::sortPulseTime() const {
   if (this->order == PULSETIME_SORT)
     return;
 
+  if (m_columns) {
+    // Does nothing if there is no time to sort
+    m_columns->sortPulseTime();
+    updateExpandedColumns();
+    this->order = PULSETIME_SORT;
+    return;
+  }
+
   // Perform sort.
+  const int numThreads = sortThreads(getNumberEvents());
   switch (eventType) {
   case TOF:
-    std::sort(events.begin(), events.end(), compareEventPulseTime);
+    if (m_compactPulseTimes) {
+      RadixSort::sort(compactEvents, compactPulseTimeKey(*m_compactPulseTimes),
+                      numThreads);
+      updateExpandedCompactEvents();
+    } else {
+      RadixSort::sort(events, pulseTimeKey, numThreads);
+    }
     break;
   case WEIGHTED:
-    std::sort(weightedEvents.begin(), weightedEvents.end(),
-              compareEventPulseTime);
+    RadixSort::sort(weightedEvents, pulseTimeKey, numThreads);
     break;
   case WEIGHTED_NOTIME:
     // Do nothing; there is no time to sort
@@ -1278,13 +1414,27 @@ void EventList::sortPulseTimeTOF() const {
   if (this->order == PULSETIMETOF_SORT)
     return;
 
+  if (m_columns) {
+    // Does nothing if there is no time to sort
+    m_columns->sortPulseTimeTof();
+    updateExpandedColumns();
+    this->order = PULSETIMETOF_SORT;
+    return;
+  }
+
+  const int numThreads = sortThreads(getNumberEvents());
   switch (eventType) {
   case TOF:
-    std::sort(events.begin(), events.end(), compareEventPulseTimeTOF);
+    if (m_compactPulseTimes) {
+      RadixSort::sort(compactEvents, compactPulseTimeKey(*m_compactPulseTimes),
+                      tofKey, numThreads);
+      updateExpandedCompactEvents();
+    } else {
+      RadixSort::sort(events, pulseTimeKey, tofKey, numThreads);
+    }
     break;
   case WEIGHTED:
-    std::sort(weightedEvents.begin(), weightedEvents.end(),
-              compareEventPulseTimeTOF);
+    RadixSort::sort(weightedEvents, pulseTimeKey, tofKey, numThreads);
     break;
   case WEIGHTED_NOTIME:
     // Do nothing; there is no time to sort
@@ -1316,9 +1466,16 @@ void EventList::reverse() {
 
   // flip the events if they are tof sorted
   if (this->isSortedByTof()) {
+    if (m_columns) {
+      clearExpandedColumns();
+      m_columns->reverse();
+      m_columns->setSortedByTof(true);
+      return;
+    }
     switch (eventType) {
     case TOF:
       std::reverse(this->events.begin(), this->events.end());
+      std::reverse(this->compactEvents.begin(), this->compactEvents.end());
       break;
     case WEIGHTED:
       std::reverse(this->weightedEvents.begin(), this->weightedEvents.end());
@@ -1342,8 +1499,12 @@ void EventList::reverse() {
  * @return the number of events in the list.
  *  */
 size_t EventList::getNumberEvents() const {
+  if (m_columns)
+    return m_columns->size();
   switch (eventType) {
   case TOF:
+    if (m_compactPulseTimes)
+      return this->compactEvents.size();
     return this->events.size();
   case WEIGHTED:
     return this->weightedEvents.size();
@@ -1357,8 +1518,12 @@ size_t EventList::getNumberEvents() const {
  * Much like stl containers, returns true if there is nothing in the event list.
  */
 bool EventList::empty() const {
+  if (m_columns)
+    return m_columns->empty();
   switch (eventType) {
   case TOF:
+    if (m_compactPulseTimes)
+      return this->compactEvents.empty();
     return this->events.empty();
   case WEIGHTED:
     return this->weightedEvents.empty();
@@ -1376,9 +1541,14 @@ bool EventList::empty() const {
  * @return :: the memory used by the EventList, in bytes.
  * */
 size_t EventList::getMemorySize() const {
+  if (m_columns)
+    return m_columns->getMemorySize() + sizeof(EventList);
   switch (eventType) {
   case TOF:
-    return this->events.capacity() * sizeof(TofEvent) + sizeof(EventList);
+    // The pulse time table is shared, so it is not counted here.
+    return this->events.capacity() * sizeof(TofEvent) +
+           this->compactEvents.capacity() * sizeof(CompactTofEvent) +
+           sizeof(EventList);
   case WEIGHTED:
     return this->weightedEvents.capacity() * sizeof(WeightedEvent) +
            sizeof(EventList);
@@ -1609,7 +1779,8 @@ const MantidVec &EventList::dataE() const {
  * @param events :: input event list.
  * @param out :: output WeightedEventNoTime vector.
  * @param tolerance :: how close do two event's TOF have to be to be considered
- *the same.
+ *the same. If negative, -tolerance is relative to the TOF of the first event
+ *of each group, which gives logarithmic bins.
  */
 
 template <class T>
@@ -1624,6 +1795,8 @@ EventList::compressEventsHelper(const std::vector<T> &events,
 
   // The last TOF to which we are comparing.
   double lastTof = -std::numeric_limits<double>::max();
+  // The tolerance of the current group
+  double groupTolerance = 0.;
   // For getting an accurate average TOF
   double totalTof = 0;
   int num = 0;
@@ -1632,7 +1805,7 @@ EventList::compressEventsHelper(const std::vector<T> &events,
   double errorSquared = 0;
 
   for (auto it = events.cbegin(); it != events.cend(); it++) {
-    if ((it->m_tof - lastTof) <= tolerance) {
+    if ((it->m_tof - lastTof) <= groupTolerance) {
       // Carry the error and weight
       weight += it->weight();
       errorSquared += it->errorSquared();
@@ -1652,6 +1825,8 @@ EventList::compressEventsHelper(const std::vector<T> &events,
       weight = it->weight();
       errorSquared = it->errorSquared();
       lastTof = it->m_tof;
+      groupTolerance =
+          tolerance < 0. ? -tolerance * std::fabs(lastTof) : tolerance;
     }
   }
 
@@ -1701,6 +1876,8 @@ void EventList::compressEventsParallelHelper(
 
     // The last TOF to which we are comparing.
     double lastTof = -std::numeric_limits<double>::max();
+    // The tolerance of the current group
+    double groupTolerance = 0.;
     // For getting an accurate average TOF
     double totalTof = 0;
     int num = 0;
@@ -1716,7 +1893,7 @@ void EventList::compressEventsParallelHelper(
     if (thread == numThreads - 1)
       it_end = events.end();
     for (; it != it_end; it++) {
-      if ((it->m_tof - lastTof) <= tolerance) {
+      if ((it->m_tof - lastTof) <= groupTolerance) {
         // Carry the error and weight
         weight += it->weight();
         errorSquared += it->errorSquared();
@@ -1736,6 +1913,8 @@ void EventList::compressEventsParallelHelper(
         weight = it->weight();
         errorSquared = it->errorSquared();
         lastTof = it->m_tof;
+        groupTolerance =
+            tolerance < 0. ? -tolerance * std::fabs(lastTof) : tolerance;
       }
     }
 
@@ -1765,7 +1944,8 @@ void EventList::compressEventsParallelHelper(
  * The event list will be switched to WeightedEventNoTime.
  *
  * @param tolerance :: how close do two event's TOF have to be to be considered
- *the same.
+ *the same. A negative tolerance is relative to the TOF (logarithmic
+ *compression), so that -0.001 merges events within 0.1% of each other.
  * @param destination :: EventList that will receive the compressed events. Can
  *be == this.
  * @param parallel :: if true, the compression will be done with all available
@@ -1782,14 +1962,25 @@ void EventList::compressEvents(double tolerance, EventList *destination,
     this->sortTof4();
   else
     this->sortTof();
+  // Compact events are read directly below, columns are not.
+  if (destination == this) {
+    this->switchFromColumns();
+  } else {
+    this->expandColumns();
+    destination->unpackEvents();
+  }
   switch (eventType) {
   case TOF:
     //      if (parallel)
     //        compressEventsParallelHelper(this->events,
     //        destination->weightedEventsNoTime, tolerance);
     //      else
-    compressEventsHelper(this->events, destination->weightedEventsNoTime,
-                         tolerance);
+    if (m_compactPulseTimes)
+      compressEventsHelper(this->compactEvents,
+                           destination->weightedEventsNoTime, tolerance);
+    else
+      compressEventsHelper(this->events, destination->weightedEventsNoTime,
+                           tolerance);
     break;
 
   case WEIGHTED:
@@ -2113,9 +2304,26 @@ void EventList::generateHistogramTimeAtSample(const MantidVec &X, MantidVec &Y,
  */
 void EventList::generateHistogram(const MantidVec &X, MantidVec &Y,
                                   MantidVec &E, bool skipError) const {
-  // All types of weights need to be sorted by TOF
-
+  if (m_columns) {
+    // Keep the columns from being sorted by another thread while reading them
+    std::lock_guard<std::mutex> _lock(m_sortMutex);
+    m_columns->generateHistogram(X, Y, E, skipError);
+    return;
+  }
   size_t numEvents = getNumberEvents();
+
+  // Unsorted events can be binned directly if the bin of an event can be
+  // computed from its TOF. Checking the bin edges costs a pass over X, so
+  // short lists are still sorted.
+  if (this->order != TOF_SORT && X.size() > 1 && numEvents >= X.size()) {
+    EventBinner binner(X);
+    if (binner.isArithmetic()) {
+      generateHistogramUnsorted(binner, Y, E, skipError);
+      return;
+    }
+  }
+
+  // Otherwise all types of weights need to be sorted by TOF
   if (numEvents > NUM_EVENTS_PARALLEL_THRESHOLD &&
       PARALLEL_GET_MAX_THREADS >= 4)
     // Four-core sort
@@ -2146,6 +2354,46 @@ void EventList::generateHistogram(const MantidVec &X, MantidVec &Y,
   }
 }
 
+// --------------------------------------------------------------------------
+/** Generates the Y and E histograms w.r.t TOF without sorting the events,
+ * using bins computed by an EventBinner.
+ *
+ * @param binner: finds the bins of the events
+ * @param Y: counts returned
+ * @param E: errors returned
+ * @param skipError: skip calculating the error. This has no effect for weighted
+ *        events.
+ */
+void EventList::generateHistogramUnsorted(const EventBinner &binner,
+                                          MantidVec &Y, MantidVec &E,
+                                          bool skipError) const {
+  Y.assign(binner.numBins(), 0.0);
+  this->expandColumns();
+  // Keep the events from being sorted by another thread while reading them
+  std::lock_guard<std::mutex> _lock(m_sortMutex);
+  switch (eventType) {
+  case TOF:
+    if (m_compactPulseTimes)
+      binner.addCounts(compactEvents, Y);
+    else
+      binner.addCounts(events, Y);
+    if (!skipError)
+      this->generateErrorsHistogram(Y, E);
+    return;
+  case WEIGHTED:
+    E.assign(binner.numBins(), 0.0);
+    binner.addWeights(weightedEvents, Y, E);
+    break;
+  case WEIGHTED_NOTIME:
+    E.assign(binner.numBins(), 0.0);
+    binner.addWeights(weightedEventsNoTime, Y, E);
+    break;
+  }
+  // Errors were summed as squares
+  std::transform(E.begin(), E.end(), E.begin(),
+                 static_cast<double (*)(double)>(sqrt));
+}
+
 // --------------------------------------------------------------------------
 /** With respect to PulseTime Fill a histogram given specified histogram bounds.
  * Does not modify
@@ -2166,6 +2414,7 @@ void EventList::generateCountsHistogramPulseTime(const MantidVec &X,
 
   // Sort the events by pulsetime
   this->sortPulseTime();
+  this->expandEvents();
   // Clear the Y data, assign all to 0.
   Y.resize(x_size - 1, 0);
 
@@ -2235,6 +2484,7 @@ void EventList::generateCountsHistogramPulseTime(const double &xMin,
                                                  const double TOF_min,
                                                  const double TOF_max) const {
 
+  this->expandEvents();
   if (this->events.empty())
     return;
 
@@ -2280,6 +2530,7 @@ void EventList::generateCountsHistogramTimeAtSample(
 
   // Sort the events by pulsetime
   this->sortTimeAtSample(tofFactor, tofOffset);
+  this->expandEvents();
   // Clear the Y data, assign all to 0.
   Y.resize(x_size - 1, 0);
 
@@ -2351,18 +2602,36 @@ void EventList::generateCountsHistogram(const MantidVec &X,
 
   // Sort the events by tof
   this->sortTof();
+  this->expandColumns();
   // Clear the Y data, assign all to 0.
   Y.resize(x_size - 1, 0);
 
+  if (m_compactPulseTimes)
+    histogramCountsHelper(this->compactEvents, X, Y);
+  else
+    histogramCountsHelper(this->events, X, Y);
+}
+
+// --------------------------------------------------------------------------
+/** Fill a counts histogram from events sorted by tof.
+ *
+ * @param events :: vector of un-weighted events, sorted by tof
+ * @param X :: The x bins
+ * @param Y :: The counts histogram, already sized and zeroed
+ */
+template <class T>
+void EventList::histogramCountsHelper(const std::vector<T> &events,
+                                      const MantidVec &X, MantidVec &Y) {
   //---------------------- Histogram without weights
   //---------------------------------
 
   // Do we even have any events to do?
-  if (!this->events.empty()) {
+  if (!events.empty()) {
+    const size_t x_size = X.size();
     // Iterate through all events (sorted by tof)
-    std::vector<TofEvent>::const_iterator itev =
-        findFirstEvent(this->events, X[0]);
-    std::vector<TofEvent>::const_iterator itev_end =
+    typename std::vector<T>::const_iterator itev =
+        findFirstEvent(events, X[0]);
+    typename std::vector<T>::const_iterator itev_end =
         events.end(); // cache for speed
     // The above can still take you to end() if no events above X[0], so check
     // again.
@@ -2522,11 +2791,16 @@ void EventList::integrate(const double minX, const double maxX,
     // The event list must be sorted by TOF!
     this->sortTof();
   }
+  this->expandColumns();
 
   // Convert the list
   switch (eventType) {
   case TOF:
-    integrateHelper(this->events, minX, maxX, entireRange, sum, error);
+    if (m_compactPulseTimes)
+      integrateHelper(this->compactEvents, minX, maxX, entireRange, sum,
+                      error);
+    else
+      integrateHelper(this->events, minX, maxX, entireRange, sum, error);
     break;
   case WEIGHTED:
     integrateHelper(this->weightedEvents, minX, maxX, entireRange, sum, error);
@@ -2553,6 +2827,8 @@ void EventList::integrate(const double minX, const double maxX,
  */
 void EventList::convertTof(std::function<double(double)> func,
                            const int sorting) {
+  this->dropCompactEvents();
+  this->clearExpandedColumns();
   // fix the histogram parameter
   MantidVec &x = dataX();
   transform(x.begin(), x.end(), x.begin(), func);
@@ -2567,6 +2843,12 @@ void EventList::convertTof(std::function<double(double)> func,
   if (this->getNumberEvents() <= 0)
     return;
 
+  if (m_columns) {
+    m_columns->convertTof(func);
+    m_columns->setSortedByTof(this->order == TOF_SORT);
+    return;
+  }
+
   // Convert the list
   switch (eventType) {
   case TOF:
@@ -2602,11 +2884,21 @@ void EventList::convertTofHelper(std::vector<T> &events,
  * @param offset :: The value to shift the time-of-flight by
  */
 void EventList::convertTof(const double factor, const double offset) {
+  this->dropCompactEvents();
   // fix the histogram parameter
   MantidVec &x = dataX();
   for (double &iter : x)
     iter = iter * factor + offset;
 
+  if (m_columns) {
+    // The columns flip themselves if they are sorted and factor < 0
+    if ((factor < 0.) && (this->getSortType() == TOF_SORT))
+      std::reverse(x.begin(), x.end());
+    clearExpandedColumns();
+    m_columns->convertTof(factor, offset);
+    return;
+  }
+
   if ((factor < 0.) && (this->getSortType() == TOF_SORT))
     this->reverse();
 
@@ -2682,6 +2974,7 @@ void EventList::addPulsetimeHelper(std::vector<T> &events,
  * @param seconds :: The value to shift the pulsetime by, in seconds
  */
 void EventList::addPulsetime(const double seconds) {
+  this->unpackEvents();
   if (this->getNumberEvents() <= 0)
     return;
 
@@ -2759,6 +3052,7 @@ void EventList::maskTof(const double tofMin, const double tofMax) {
     return;
 
   // Start by sorting by tof
+  this->unpackEvents();
   this->sortTof();
 
   // Convert the list
@@ -2801,13 +3095,17 @@ void EventList::getTofsHelper(const std::vector<T> &events,
  *  @param tofs :: A reference to the vector to be filled
  */
 void EventList::getTofs(std::vector<double> &tofs) const {
+  this->expandColumns();
   // Set the capacity of the vector to avoid multiple resizes
   tofs.reserve(this->getNumberEvents());
 
   // Convert the list
   switch (eventType) {
   case TOF:
-    this->getTofsHelper(this->events, tofs);
+    if (m_compactPulseTimes)
+      this->getTofsHelper(this->compactEvents, tofs);
+    else
+      this->getTofsHelper(this->events, tofs);
     break;
   case WEIGHTED:
     this->getTofsHelper(this->weightedEvents, tofs);
@@ -2847,6 +3145,7 @@ void EventList::getWeightsHelper(const std::vector<T> &events,
  *  @param weights :: A reference to the vector to be filled
  */
 void EventList::getWeights(std::vector<double> &weights) const {
+  this->expandColumns();
   // Set the capacity of the vector to avoid multiple resizes
   weights.reserve(this->getNumberEvents());
 
@@ -2894,6 +3193,7 @@ void EventList::getWeightErrorsHelper(const std::vector<T> &events,
  *  @param weightErrors :: A reference to the vector to be filled
  */
 void EventList::getWeightErrors(std::vector<double> &weightErrors) const {
+  this->expandColumns();
   // Set the capacity of the vector to avoid multiple resizes
   weightErrors.reserve(this->getNumberEvents());
 
@@ -2943,6 +3243,7 @@ void EventList::getPulseTimesHelper(
  * @return by copy a vector of DateAndTime times
  */
 std::vector<Mantid::Kernel::DateAndTime> EventList::getPulseTimes() const {
+  this->expandColumns();
   std::vector<Mantid::Kernel::DateAndTime> times;
   // Set the capacity of the vector to avoid multiple resizes
   times.reserve(this->getNumberEvents());
@@ -2950,7 +3251,13 @@ std::vector<Mantid::Kernel::DateAndTime> EventList::getPulseTimes() const {
   // Convert the list
   switch (eventType) {
   case TOF:
-    this->getPulseTimesHelper(this->events, times);
+    if (m_compactPulseTimes) {
+      const auto &pulseTimes = *m_compactPulseTimes;
+      for (const auto &event : compactEvents)
+        times.push_back(pulseTimes[event.m_pulseIndex]);
+    } else {
+      this->getPulseTimesHelper(this->events, times);
+    }
     break;
   case WEIGHTED:
     this->getPulseTimesHelper(this->weightedEvents, times);
@@ -2973,11 +3280,14 @@ double EventList::getTofMin() const {
   // no events is a soft error
   if (this->empty())
     return tMin;
+  this->expandColumns();
 
   // when events are ordered by tof just need the first value
   if (this->order == TOF_SORT) {
     switch (eventType) {
     case TOF:
+      if (m_compactPulseTimes)
+        return this->compactEvents.begin()->tof();
       return this->events.begin()->tof();
     case WEIGHTED:
       return this->weightedEvents.begin()->tof();
@@ -2987,6 +3297,11 @@ double EventList::getTofMin() const {
   }
 
   // now we are stuck with a linear search
+  if (m_compactPulseTimes) {
+    for (const auto &event : compactEvents)
+      tMin = std::min(tMin, event.tof());
+    return tMin;
+  }
   double temp = tMin; // start with the largest possible value
   size_t numEvents = this->getNumberEvents();
   for (size_t i = 0; i < numEvents; i++) {
@@ -3019,11 +3334,14 @@ double EventList::getTofMax() const {
   // no events is a soft error
   if (this->empty())
     return tMax;
+  this->expandColumns();
 
   // when events are ordered by tof just need the first value
   if (this->order == TOF_SORT) {
     switch (eventType) {
     case TOF:
+      if (m_compactPulseTimes)
+        return this->compactEvents.rbegin()->tof();
       return this->events.rbegin()->tof();
     case WEIGHTED:
       return this->weightedEvents.rbegin()->tof();
@@ -3033,6 +3351,11 @@ double EventList::getTofMax() const {
   }
 
   // now we are stuck with a linear search
+  if (m_compactPulseTimes) {
+    for (const auto &event : compactEvents)
+      tMax = std::max(tMax, event.tof());
+    return tMax;
+  }
   size_t numEvents = this->getNumberEvents();
   double temp = tMax; // start with the smallest possible value
   for (size_t i = 0; i < numEvents; i++) {
@@ -3064,6 +3387,13 @@ DateAndTime EventList::getPulseTimeMin() const {
   // no events is a soft error
   if (this->empty())
     return tMin;
+  this->expandColumns();
+
+  if (m_compactPulseTimes) {
+    DateAndTime tMax;
+    this->getPulseTimeMinMax(tMin, tMax);
+    return tMin;
+  }
 
   // when events are ordered by pulse time just need the first value
   if (this->order == PULSETIME_SORT) {
@@ -3108,6 +3438,13 @@ DateAndTime EventList::getPulseTimeMax() const {
   // no events is a soft error
   if (this->empty())
     return tMax;
+  this->expandColumns();
+
+  if (m_compactPulseTimes) {
+    DateAndTime tMin;
+    this->getPulseTimeMinMax(tMin, tMax);
+    return tMax;
+  }
 
   // when events are ordered by pulse time just need the first value
   if (this->order == PULSETIME_SORT) {
@@ -3151,6 +3488,19 @@ void EventList::getPulseTimeMinMax(Mantid::Kernel::DateAndTime &tMin,
   // no events is a soft error
   if (this->empty())
     return;
+  this->expandColumns();
+
+  if (m_compactPulseTimes) {
+    const auto &pulseTimes = *m_compactPulseTimes;
+    for (const auto &event : compactEvents) {
+      const DateAndTime &temp = pulseTimes[event.m_pulseIndex];
+      if (temp > tMax)
+        tMax = temp;
+      if (temp < tMin)
+        tMin = temp;
+    }
+    return;
+  }
 
   // when events are ordered by pulse time just need the first/last values
   if (this->order == PULSETIME_SORT) {
@@ -3194,6 +3544,7 @@ void EventList::getPulseTimeMinMax(Mantid::Kernel::DateAndTime &tMin,
 
 DateAndTime EventList::getTimeAtSampleMax(const double &tofFactor,
                                           const double &tofOffset) const {
+  this->expandEvents();
   // set up as the minimum available date time.
   DateAndTime tMax = DateAndTime::minimum();
 
@@ -3248,6 +3599,7 @@ DateAndTime EventList::getTimeAtSampleMax(const double &tofFactor,
 
 DateAndTime EventList::getTimeAtSampleMin(const double &tofFactor,
                                           const double &tofOffset) const {
+  this->expandEvents();
   // set up as the minimum available date time.
   DateAndTime tMin = DateAndTime::maximum();
 
@@ -3327,6 +3679,7 @@ void EventList::setTofsHelper(std::vector<T> &events,
  * @param tofs :: The vector of doubles to set the tofs to.
  */
 void EventList::setTofs(const MantidVec &tofs) {
+  this->unpackEvents();
   this->order = UNSORTED;
 
   // Convert the list
@@ -3432,6 +3785,7 @@ void EventList::multiply(const double value, const double error) {
   // Do nothing if multiplying by exactly one and there is no error
   if ((value == 1.0) && (error == 0.0))
     return;
+  this->unpackEvents();
 
   switch (eventType) {
   case TOF:
@@ -3552,6 +3906,7 @@ void EventList::multiplyHistogramHelper(std::vector<T> &events,
  */
 void EventList::multiply(const MantidVec &X, const MantidVec &Y,
                          const MantidVec &E) {
+  this->unpackEvents();
   switch (eventType) {
   case TOF:
     // Switch to weights if needed.
@@ -3689,6 +4044,7 @@ void EventList::divideHistogramHelper(std::vector<T> &events,
  */
 void EventList::divide(const MantidVec &X, const MantidVec &Y,
                        const MantidVec &E) {
+  this->unpackEvents();
   switch (eventType) {
   case TOF:
     // Switch to weights if needed.
@@ -3830,6 +4186,7 @@ void EventList::filterByPulseTime(DateAndTime start, DateAndTime stop,
 
   // Start by sorting the event list by pulse time.
   this->sortPulseTime();
+  this->expandEvents();
   // Clear the output
   output.clear();
   // Has to match the given type
@@ -3863,6 +4220,7 @@ void EventList::filterByTimeAtSample(Kernel::DateAndTime start,
 
   // Start by sorting
   this->sortTimeAtSample(tofFactor, tofOffset);
+  this->expandEvents();
   // Clear the output
   output.clear();
   // Has to match the given type
@@ -3971,6 +4329,7 @@ void EventList::filterInPlaceHelper(Kernel::TimeSplitterType &splitter,
  *     that will be kept. Any other events will be deleted.
  */
 void EventList::filterInPlace(Kernel::TimeSplitterType &splitter) {
+  this->unpackEvents();
   // Start by sorting the event list by pulse time.
   this->sortPulseTime();
 
@@ -4062,6 +4421,7 @@ void EventList::splitByTimeHelper(Kernel::TimeSplitterType &splitter,
  */
 void EventList::splitByTime(Kernel::TimeSplitterType &splitter,
                             std::vector<EventList *> outputs) const {
+  this->expandEvents();
   if (eventType == WEIGHTED_NOTIME)
     throw std::runtime_error("EventList::splitByTime() called on an EventList "
                              "that no longer has time information.");
@@ -4204,6 +4564,7 @@ void EventList::splitByFullTime(Kernel::TimeSplitterType &splitter,
                                 std::map<int, EventList *> outputs,
                                 bool docorrection, double toffactor,
                                 double tofshift) const {
+  this->expandEvents();
   if (eventType == WEIGHTED_NOTIME)
     throw std::runtime_error("EventList::splitByTime() called on an EventList "
                              "that no longer has time information.");
@@ -4329,6 +4690,7 @@ std::string EventList::splitByFullTimeMatrixSplitter(
     const std::vector<int64_t> &vectimes, const std::vector<int> &vecgroups,
     std::map<int, EventList *> vec_outputEventList, bool docorrection,
     double toffactor, double tofshift) const {
+  this->expandEvents();
   // Check validity
   if (eventType == WEIGHTED_NOTIME)
     throw std::runtime_error("EventList::splitByTime() called on an EventList "
@@ -4379,6 +4741,139 @@ std::string EventList::splitByFullTimeMatrixSplitter(
   return debugmessage;
 }
 
+//----------------------------------------------------------------------------------------------
+/** Split a vector of events into the outputs in one pass. The output of each
+ * event is found by a binary search for its time in the interval boundaries,
+ * and each output is allocated once, from a count of the events it gets.
+ *
+ * @param splitTimes :: sorted boundaries of the intervals, in nanoseconds
+ * @param splitTargets :: index into outputs for each interval
+ * @param outputs :: the output event lists
+ * @param events :: either this->events or this->weightedEvents.
+ * @param pulseTimeOnly :: split by the pulse time of events instead of their
+ *full time
+ * @param docorrection :: flag to determine whether or not to apply correction
+ * @param toffactor :: factor to correct TOF in formula toffactor*tof+tofshift
+ * @param tofshift :: amount to shift (in SECOND) to correct TOF
+ */
+template <class T>
+void EventList::splitByTimeBoundariesHelper(
+    const std::vector<int64_t> &splitTimes,
+    const std::vector<size_t> &splitTargets,
+    const std::vector<EventList *> &outputs, const std::vector<T> &events,
+    bool pulseTimeOnly, bool docorrection, double toffactor,
+    double tofshift) const {
+  // Find the output of each event, and count the events of each output
+  std::vector<size_t> eventTargets(events.size());
+  std::vector<size_t> counts(outputs.size(), 0);
+  for (size_t i = 0; i < events.size(); ++i) {
+    const T &event = events[i];
+    int64_t time = event.m_pulsetime.totalNanoseconds();
+    if (!pulseTimeOnly) {
+      if (docorrection)
+        time =
+            calculateCorrectedFullTime(time, event.m_tof, toffactor, tofshift);
+      else
+        time += static_cast<int64_t>(event.m_tof * 1000);
+    }
+    const auto interval =
+        std::upper_bound(splitTimes.begin(), splitTimes.end(), time) -
+        splitTimes.begin();
+    eventTargets[i] = splitTargets[interval];
+    ++counts[eventTargets[i]];
+  }
+
+  // Make room for all the events of each output at once
+  std::vector<std::vector<T> *> outputEvents(outputs.size(), nullptr);
+  for (size_t j = 0; j < outputs.size(); ++j) {
+    if (counts[j] == 0 || !outputs[j])
+      continue;
+    getEventsFrom(*outputs[j], outputEvents[j]);
+    outputEvents[j]->reserve(outputEvents[j]->size() + counts[j]);
+  }
+
+  for (size_t i = 0; i < events.size(); ++i) {
+    // The events of a null output are dropped
+    if (auto output = outputEvents[eventTargets[i]])
+      output->push_back(events[i]);
+  }
+}
+
+//----------------------------------------------------------------------------------------------
+/** Split the event list into n outputs in a single pass over the events.
+ *
+ * The splitting intervals are given as a sorted vector of their boundaries.
+ * Events with a time before splitTimes[0] go to outputs[splitTargets[0]],
+ * events with splitTimes[i-1] <= time < splitTimes[i] go to
+ * outputs[splitTargets[i]] and events after the last boundary go to
+ * outputs[splitTargets.back()]. The events of a target whose output is null
+ * are dropped. The outputs are kept in the order of this list, sorted by
+ * pulse time.
+ *
+ * @param splitTimes :: sorted boundaries of the intervals, in nanoseconds
+ * @param splitTargets :: index into outputs for each interval. One more than
+ *the number of boundaries.
+ * @param outputs :: the output event lists, which are cleared first. May
+ *contain null pointers.
+ * @param pulseTimeOnly :: split by the pulse time of events instead of their
+ *full time (pulse time + tof)
+ * @param docorrection :: flag to determine whether or not to apply correction
+ * @param toffactor :: factor to correct TOF in formula toffactor*tof+tofshift
+ * @param tofshift :: amount to shift (in SECOND) to correct TOF
+ */
+void EventList::splitByTimeBoundaries(const std::vector<int64_t> &splitTimes,
+                                      const std::vector<size_t> &splitTargets,
+                                      const std::vector<EventList *> &outputs,
+                                      bool pulseTimeOnly, bool docorrection,
+                                      double toffactor, double tofshift) const {
+  this->expandEvents();
+  if (eventType == WEIGHTED_NOTIME)
+    throw std::runtime_error("EventList::splitByTimeBoundaries() called on an "
+                             "EventList that no longer has time information.");
+  if (splitTargets.size() != splitTimes.size() + 1)
+    throw std::invalid_argument("EventList::splitByTimeBoundaries() needs one "
+                                "more target than the number of boundaries.");
+  if (std::any_of(splitTargets.begin(), splitTargets.end(),
+                  [&outputs](size_t target) {
+        return target >= outputs.size();
+      }))
+    throw std::invalid_argument("EventList::splitByTimeBoundaries() has a "
+                                "target without an output EventList.");
+
+  this->sortPulseTimeTOF();
+
+  for (auto output : outputs) {
+    if (!output)
+      continue;
+    output->clear();
+    output->setDetectorIDs(this->getDetectorIDs());
+    output->setHistogram(m_histogram);
+    // Match the output event type.
+    output->switchTo(eventType);
+  }
+
+  switch (eventType) {
+  case TOF:
+    splitByTimeBoundariesHelper(splitTimes, splitTargets, outputs, this->events,
+                                pulseTimeOnly, docorrection, toffactor,
+                                tofshift);
+    break;
+  case WEIGHTED:
+    splitByTimeBoundariesHelper(splitTimes, splitTargets, outputs,
+                                this->weightedEvents, pulseTimeOnly,
+                                docorrection, toffactor, tofshift);
+    break;
+  case WEIGHTED_NOTIME:
+    break;
+  }
+
+  // Each output holds a subsequence of this list, so is sorted the same way
+  for (auto output : outputs) {
+    if (output)
+      output->order = this->order;
+  }
+}
+
 //-------------------------------------------
 //--------------------------------------------------
 /** Split the event list into n outputs by each event's pulse time only
@@ -4451,6 +4946,7 @@ void EventList::splitByPulseTimeHelper(Kernel::TimeSplitterType &splitter,
  */
 void EventList::splitByPulseTime(Kernel::TimeSplitterType &splitter,
                                  std::map<int, EventList *> outputs) const {
+  this->expandEvents();
   // Check for supported event type
   if (eventType == WEIGHTED_NOTIME)
     throw std::runtime_error("EventList::splitByTime() called on an EventList "
@@ -4542,6 +5038,24 @@ void getEventsFrom(const EventList &el,
   events = &el.getWeightedEventsNoTime();
 }
 
+//--------------------------------------------------------------------------
+/** Get the vector of events contained in an EventList;
+ * this is overloaded by event type.
+ *
+ * @param el :: The EventList to retrieve
+ * @param[out] events :: reference to a pointer to a vector of this type of
+ *event.
+ *             The pointer will be set to point to the vector.
+ * @throw runtime_error if the EventList does not hold compact events.
+ */
+void getEventsFrom(EventList &el, std::vector<CompactTofEvent> *&events) {
+  events = &el.getCompactEvents();
+}
+void getEventsFrom(const EventList &el,
+                   std::vector<CompactTofEvent> const *&events) {
+  events = &el.getCompactEvents();
+}
+
 //--------------------------------------------------------------------------
 /** Helper function for the conversion to TOF. This handles the different
  *  event types.
@@ -4554,13 +5068,21 @@ template <class T>
 void EventList::convertUnitsViaTofHelper(typename std::vector<T> &events,
                                          Mantid::Kernel::Unit *fromUnit,
                                          Mantid::Kernel::Unit *toUnit) {
-  auto itev = events.begin();
-  auto itev_end = events.end();
-  for (; itev != itev_end; itev++) {
-    // Conver to TOF
-    double tof = fromUnit->singleToTOF(itev->m_tof);
+  // Convert the events in blocks, so that the units convert many values per
+  // (virtual) call
+  const size_t blockSize = 1024;
+  double tofs[blockSize];
+  for (size_t start = 0; start < events.size(); start += blockSize) {
+    const size_t count = std::min(blockSize, events.size() - start);
+    auto block = events.begin() + start;
+    for (size_t i = 0; i < count; ++i)
+      tofs[i] = block[i].m_tof;
+    // Convert to TOF
+    fromUnit->manyToTOF(tofs, count);
     // And back from TOF to whatever
-    itev->m_tof = toUnit->singleFromTOF(tof);
+    toUnit->manyFromTOF(tofs, count);
+    for (size_t i = 0; i < count; ++i)
+      block[i].m_tof = tofs[i];
   }
 }
 
@@ -4585,6 +5107,7 @@ void EventList::convertUnitsViaTof(Mantid::Kernel::Unit *fromUnit,
     throw std::runtime_error(
         "EventList::convertUnitsViaTof(): toUnit is not initialized!");
 
+  this->unpackEvents();
   switch (eventType) {
   case TOF:
     convertUnitsViaTofHelper(this->events, fromUnit, toUnit);
@@ -4622,6 +5145,7 @@ void EventList::convertUnitsQuicklyHelper(typename std::vector<T> &events,
  *  @param power :: the Power b to apply to the conversion
  */
 void EventList::convertUnitsQuickly(const double &factor, const double &power) {
+  this->unpackEvents();
   switch (eventType) {
   case TOF:
     convertUnitsQuicklyHelper(this->events, factor, power);
@@ -388,6 +388,26 @@ void EventWorkspace::switchEventType(const Mantid::API::EventType type) {
     eventList->switchTo(type);
 }
 
+/** Choose how the events of every list are stored. Columnar lists keep the
+ * time-of-flight, pulse time and weights in separate arrays (see
+ * EventColumns), which makes sorting, converting and histogramming by
+ * time-of-flight faster. Other operations move the events of a list back out
+ * of the columns as needed.
+ *
+ * @param columnar :: true to store the events as columns, false to store them
+ *        as vectors of events.
+ */
+void EventWorkspace::setColumnarEvents(const bool columnar) {
+  const auto numberOfSpectra = static_cast<int64_t>(this->data.size());
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < numberOfSpectra; ++i) {
+    if (columnar)
+      data[i]->switchToColumns();
+    else
+      data[i]->switchFromColumns();
+  }
+}
+
 /// Returns true always - an EventWorkspace always represents histogramm-able
 /// data
 /// @returns If the data is a histogram - always true for an eventWorkspace
@@ -336,5 +336,54 @@ bool WeightedEventNoTime::equals(const WeightedEventNoTime &rhs,
   return true;
 }
 
+//==========================================================================
+/// --------------------- CompactTofEvent stuff -------------------------
+//==========================================================================
+/** Constructor, specifying only the time of flight. The pulse index is 0.
+ * @param tof :: time of flight, in microseconds
+ */
+CompactTofEvent::CompactTofEvent(double tof)
+    : m_tof(static_cast<float>(tof)), m_pulseIndex(0) {}
+
+/** Constructor, specifying the time of flight and the pulse index
+ * @param tof :: time of flight, in microseconds
+ * @param pulseIndex :: index into the pulse time table of the bank
+ */
+CompactTofEvent::CompactTofEvent(const float tof, const uint32_t pulseIndex)
+    : m_tof(tof), m_pulseIndex(pulseIndex) {}
+
+/// Empty constructor
+CompactTofEvent::CompactTofEvent() : m_tof(0), m_pulseIndex(0) {}
+
+/** Comparison operator.
+ * @param rhs: the other CompactTofEvent to compare.
+ * @return true if the CompactTofEvent's are identical.*/
+bool CompactTofEvent::operator==(const CompactTofEvent &rhs) const {
+  return (this->m_tof == rhs.m_tof) && (this->m_pulseIndex == rhs.m_pulseIndex);
+}
+
+/** < comparison operator, using the TOF to do the comparison.
+ * @param rhs: the other CompactTofEvent to compare.
+ * @return true if this->m_tof < rhs.m_tof*/
+bool CompactTofEvent::operator<(const CompactTofEvent &rhs) const {
+  return (this->m_tof < rhs.m_tof);
+}
+
+/** < comparison operator, using the TOF to do the comparison.
+ * @param rhs_tof: the other time of flight to compare.
+ * @return true if this->m_tof < rhs_tof*/
+bool CompactTofEvent::operator<(const double rhs_tof) const {
+  return (this->m_tof < rhs_tof);
+}
+
+/** Output a string representation of the event to a stream
+ * @param os :: Stream
+ * @param event :: CompactTofEvent to output to the stream
+ */
+ostream &operator<<(ostream &os, const CompactTofEvent &event) {
+  os << event.m_tof << ", pulse #" << event.m_pulseIndex;
+  return os;
+}
+
 } // DataObjects
 } // Mantid
@@ -0,0 +1,172 @@
+#include "MantidDataObjects/MDBoxMortonTree.h"
+#include "MantidGeometry/MDGeometry/MDDimensionExtents.h"
+
+#include <algorithm>
+
+namespace Mantid {
+namespace DataObjects {
+
+namespace {
+/// @return true if the most significant set bit of a is lower than that of b
+bool lessMsb(size_t a, size_t b) { return a < b && a < (a ^ b); }
+
+/// A grid box child and its cell indices within the parent
+struct ChildCell {
+  API::IMDNode *box;
+  std::vector<size_t> cell;
+};
+
+/** Compare the position of two cells along the Morton curve without building
+ * the interleaved keys: the order is decided by the dimension with the most
+ * significant differing bit. For bits of equal significance the last
+ * dimension decides, so the first dimension varies fastest.
+ */
+bool mortonLess(const ChildCell &a, const ChildCell &b) {
+  size_t msd = 0;
+  for (size_t d = 1; d < a.cell.size(); ++d) {
+    if (!lessMsb(a.cell[d] ^ b.cell[d], a.cell[msd] ^ b.cell[msd]))
+      msd = d;
+  }
+  return a.cell[msd] < b.cell[msd];
+}
+}
+
+/** Constructor. Linearizes the box structure below the given box.
+ *
+ * @param root :: the root box of the structure, usually the box of a workspace
+ */
+MDBoxMortonTree::MDBoxMortonTree(API::IMDNode *root)
+    : m_nd(root->getNumDims()) {
+  addBox(root);
+  // One past the end, so the leaves of the last subtree have an end too
+  m_firstLeaf.push_back(m_leaves.size());
+}
+
+/** Append a box and, recursively, its children in Morton order.
+ *
+ * @param box :: the box to add
+ */
+void MDBoxMortonTree::addBox(API::IMDNode *box) {
+  const size_t index = m_boxes.size();
+  m_boxes.push_back(box);
+  for (size_t d = 0; d < m_nd; ++d) {
+    const auto &extents = box->getExtents(d);
+    m_extents.push_back(extents.getMin());
+    m_extents.push_back(extents.getMax());
+  }
+  m_subtreeEnd.push_back(index + 1);
+  m_firstLeaf.push_back(m_leaves.size());
+
+  const size_t numChildren = box->isBox() ? 0 : box->getNumChildren();
+  if (numChildren == 0) {
+    m_leaves.push_back(box);
+    return;
+  }
+
+  // Position of each child in the grid of the box, from its lower corner
+  std::vector<ChildCell> children(numChildren);
+  for (size_t i = 0; i < numChildren; ++i) {
+    auto child = box->getChild(i);
+    children[i].box = child;
+    children[i].cell.resize(m_nd);
+    for (size_t d = 0; d < m_nd; ++d) {
+      const auto &extents = child->getExtents(d);
+      const coord_t width = extents.getMax() - extents.getMin();
+      const coord_t offset =
+          extents.getMin() - m_extents[2 * (index * m_nd + d)];
+      children[i].cell[d] =
+          width > 0 ? static_cast<size_t>(offset / width + 0.5) : 0;
+    }
+  }
+  std::sort(children.begin(), children.end(), mortonLess);
+  for (const auto &child : children)
+    addBox(child.box);
+  m_subtreeEnd[index] = m_boxes.size();
+}
+
+/** @return true if the coordinates are within the box at the given index
+ *
+ * @param index :: index of the box
+ * @param coords :: m_nd coordinates
+ */
+bool MDBoxMortonTree::contains(size_t index, const coord_t *coords) const {
+  const coord_t *extents = &m_extents[2 * index * m_nd];
+  for (size_t d = 0; d < m_nd; ++d) {
+    if (coords[d] < extents[2 * d] || coords[d] >= extents[2 * d + 1])
+      return false;
+  }
+  return true;
+}
+
+/** Fill the 2^nd vertexes of a box, in the order of
+ * MDBoxBase::getVertexesArray.
+ *
+ * @param index :: index of the box
+ * @param vertexes :: array of (1 << m_nd) * m_nd coordinates to fill
+ */
+void MDBoxMortonTree::fillVertexes(size_t index, coord_t *vertexes) const {
+  const coord_t *extents = &m_extents[2 * index * m_nd];
+  const size_t numVertexes = size_t(1) << m_nd;
+  for (size_t v = 0; v < numVertexes; ++v) {
+    for (size_t d = 0; d < m_nd; ++d)
+      *vertexes++ = extents[2 * d + ((v >> d) & 1)];
+  }
+}
+
+/** Find the leaf boxes that might be touching an implicit function.
+ *
+ * Subtrees that do not touch the function are skipped, and the leaves of
+ * subtrees fully contained by the function are copied as one range, without
+ * testing their boxes.
+ *
+ * @param outBoxes :: vector to append the leaf boxes to, in Morton order
+ * @param function :: the implicit function limiting the boxes
+ */
+void MDBoxMortonTree::getBoxes(
+    std::vector<API::IMDNode *> &outBoxes,
+    const Geometry::MDImplicitFunction &function) const {
+  const size_t numVertexes = size_t(1) << m_nd;
+  std::vector<coord_t> vertexes(numVertexes * m_nd);
+  size_t i = 0;
+  while (i < m_boxes.size()) {
+    fillVertexes(i, vertexes.data());
+    switch (function.boxContact(vertexes.data(), numVertexes)) {
+    case Geometry::MDImplicitFunction::NOT_TOUCHING:
+      i = m_subtreeEnd[i];
+      break;
+    case Geometry::MDImplicitFunction::CONTAINED:
+      outBoxes.insert(outBoxes.end(), m_leaves.begin() + m_firstLeaf[i],
+                      m_leaves.begin() + m_firstLeaf[m_subtreeEnd[i]]);
+      i = m_subtreeEnd[i];
+      break;
+    default:
+      if (isLeaf(i))
+        outBoxes.push_back(m_boxes[i]);
+      ++i;
+    }
+  }
+}
+
+/** Find the leaf box containing a point.
+ *
+ * @param coords :: m_nd coordinates of the point
+ * @return the leaf box, or nullptr if the point is outside of all boxes
+ */
+API::IMDNode *MDBoxMortonTree::getBoxAtCoord(const coord_t *coords) const {
+  if (m_boxes.empty() || !contains(0, coords))
+    return nullptr;
+  size_t i = 0;
+  while (!isLeaf(i)) {
+    const size_t end = m_subtreeEnd[i];
+    size_t child = i + 1;
+    while (child < end && !contains(child, coords))
+      child = m_subtreeEnd[child];
+    if (child == end)
+      return nullptr;
+    i = child;
+  }
+  return m_boxes[i];
+}
+
+} // namespace DataObjects
+} // namespace Mantid
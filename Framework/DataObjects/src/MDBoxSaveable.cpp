@@ -32,13 +32,18 @@ void MDBoxSaveable::save() const {
   * private function called from the DiskBuffer
  */
 void MDBoxSaveable::load() {
-  // Is the data in memory right now (cached copy)?
-  if (!m_isLoaded) {
-    API::IBoxControllerIO *fileIO = m_MDNode->getBoxController()->getFileIO();
+  API::IBoxControllerIO *fileIO = m_MDNode->getBoxController()->getFileIO();
+  {
+    std::lock_guard<std::mutex> lock(m_loadMutex);
+    // Is the data in memory right now (cached copy)?
+    if (isLoaded())
+      return;
     m_MDNode->loadAndAddFrom(fileIO, this->getFilePosition(),
                              this->getFileSize());
     this->setLoaded(true);
   }
+  // Counted outside of the lock, as the buffer may be saving other boxes
+  fileIO->objectLoaded(this);
 }
 }
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include "MantidDataObjects/Workspace2D.h"
 #include "MantidKernel/Exception.h"
 #include "MantidAPI/RefAxis.h"
+#include "MantidAPI/Run.h"
 #include "MantidAPI/SpectraAxis.h"
 #include "MantidAPI/WorkspaceProperty.h"
 #include "MantidAPI/WorkspaceFactory.h"
@@ -9,6 +10,8 @@
 #include "MantidKernel/VectorHelper.h"
 #include "MantidKernel/IPropertyManager.h"
 
+#include <unordered_set>
+
 using Mantid::API::ISpectrum;
 using Mantid::API::MantidImage;
 
@@ -113,6 +116,27 @@ size_t Workspace2D::blocksize() const {
              : 0;
 }
 
+/** Get the memory used by the workspace. X, Y, E or Dx vectors shared by
+ * several spectra (and possibly by other workspaces) are counted once.
+ * @return the size in bytes
+ */
+size_t Workspace2D::getMemorySize() const {
+  std::unordered_set<const void *> counted;
+  size_t total = 0;
+  auto count = [&counted, &total](const void *vector, const size_t size) {
+    if (counted.insert(vector).second)
+      total += size * sizeof(double);
+  };
+  for (const auto spectrum : data) {
+    count(&spectrum->x(), spectrum->x().size());
+    count(&spectrum->y(), spectrum->y().size());
+    count(&spectrum->e(), spectrum->e().size());
+    if (spectrum->hasDx())
+      count(&spectrum->dx(), spectrum->dx().size());
+  }
+  return total + run().getMemorySize();
+}
+
 /**
   * Copy the data (Y's) from an image to this workspace.
   * @param image :: An image to copy the data from.
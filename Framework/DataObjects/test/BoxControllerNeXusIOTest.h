@@ -48,6 +48,7 @@ public:
     // default settings
     TS_ASSERT_EQUALS(4, CoordSize);
     TS_ASSERT_EQUALS("MDEvent", typeName);
+    TS_ASSERT(!pSaver->getCompressEvents());
 
     // set size
     TS_ASSERT_THROWS(pSaver->setDataType(9, typeName), std::invalid_argument);
@@ -178,12 +179,14 @@ public:
     }
   };
 
-  template <typename FROM, typename TO> void WriteReadRead() {
+  template <typename FROM, typename TO>
+  void WriteReadRead(bool compressEvents = false) {
     using Mantid::DataObjects::BoxControllerNeXusIO;
 
     BoxControllerNeXusIO *pSaver(NULL);
     TS_ASSERT_THROWS_NOTHING(pSaver = createTestBoxController());
     pSaver->setDataType(sizeof(FROM), "MDEvent");
+    pSaver->setCompressEvents(compressEvents);
     std::string FullPathFile;
 
     TS_ASSERT_THROWS_NOTHING(pSaver->openFile(this->xxfFileName, "w"));
@@ -226,6 +229,14 @@ public:
 
   void test_WriteFloatReadDouble() { this->WriteReadRead<float, double>(); }
 
+  void test_WriteReadCompressedFloat() {
+    this->WriteReadRead<float, float>(true);
+  }
+
+  void test_WriteCompressedFloatReadDouble() {
+    this->WriteReadRead<float, double>(true);
+  }
+
 private:
   /// Create a test box controller. Ownership is passed to the caller
   Mantid::DataObjects::BoxControllerNeXusIO *createTestBoxController() {
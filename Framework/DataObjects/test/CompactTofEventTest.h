@@ -0,0 +1,65 @@
+#ifndef COMPACTTOFEVENTTEST_H_
+#define COMPACTTOFEVENTTEST_H_ 1
+
+#include <cxxtest/TestSuite.h>
+#include "MantidDataObjects/Events.h"
+
+#include <sstream>
+
+using namespace Mantid::DataObjects;
+
+//==========================================================================================
+class CompactTofEventTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static CompactTofEventTest *createSuite() {
+    return new CompactTofEventTest();
+  }
+  static void destroySuite(CompactTofEventTest *suite) { delete suite; }
+
+  void test_size() {
+    // Half of a TofEvent
+    TS_ASSERT_EQUALS(sizeof(CompactTofEvent), 8);
+  }
+
+  void test_constructors() {
+    CompactTofEvent e(123.5f, 7);
+    TS_ASSERT_EQUALS(e.tof(), 123.5);
+    TS_ASSERT_EQUALS(e.pulseIndex(), 7);
+    TS_ASSERT_EQUALS(e(), 123.5);
+
+    CompactTofEvent e2;
+    TS_ASSERT_EQUALS(e2.tof(), 0.);
+    TS_ASSERT_EQUALS(e2.pulseIndex(), 0);
+
+    CompactTofEvent e3(42.25);
+    TS_ASSERT_EQUALS(e3.tof(), 42.25);
+    TS_ASSERT_EQUALS(e3.pulseIndex(), 0);
+  }
+
+  void test_weights_are_one() {
+    CompactTofEvent e(10.f, 3);
+    TS_ASSERT_EQUALS(e.weight(), 1.0);
+    TS_ASSERT_EQUALS(e.error(), 1.0);
+    TS_ASSERT_EQUALS(e.errorSquared(), 1.0);
+  }
+
+  void test_compare() {
+    CompactTofEvent e1(10.f, 3), e2(10.f, 3), e3(10.f, 4), e4(11.f, 0);
+    TS_ASSERT(e1 == e2);
+    TS_ASSERT(!(e1 == e3));
+    TS_ASSERT(e1 < e4);
+    TS_ASSERT(!(e4 < e1));
+    TS_ASSERT(e1 < 10.5);
+    TS_ASSERT(!(e1 < 9.5));
+  }
+
+  void test_output() {
+    std::ostringstream out;
+    out << CompactTofEvent(1.5f, 2);
+    TS_ASSERT_EQUALS(out.str(), "1.5, pulse #2");
+  }
+};
+
+#endif
@@ -0,0 +1,148 @@
+#ifndef MANTID_DATAOBJECTS_EVENTBINNERTEST_H_
+#define MANTID_DATAOBJECTS_EVENTBINNERTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidDataObjects/EventBinner.h"
+#include "MantidDataObjects/Events.h"
+#include "MantidHistogramData/LinearGenerator.h"
+#include "MantidHistogramData/LogarithmicGenerator.h"
+
+#include <algorithm>
+#include <random>
+
+using namespace Mantid::DataObjects;
+using Mantid::MantidVec;
+using Mantid::HistogramData::LinearGenerator;
+using Mantid::HistogramData::LogarithmicGenerator;
+
+class EventBinnerTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static EventBinnerTest *createSuite() { return new EventBinnerTest(); }
+  static void destroySuite(EventBinnerTest *suite) { delete suite; }
+
+  void test_linear_edges_are_detected() {
+    MantidVec X(101);
+    std::generate(X.begin(), X.end(), LinearGenerator(100.0, 0.1));
+    EventBinner binner(X);
+    TS_ASSERT_EQUALS(binner.spacing(), EventBinner::Spacing::Linear);
+    TS_ASSERT(binner.isArithmetic());
+    TS_ASSERT_EQUALS(binner.numBins(), 100);
+  }
+
+  void test_linear_edges_with_short_last_bin_are_detected() {
+    // As made by Rebin with parameters 0,10,95
+    const MantidVec X{0, 10, 20, 30, 40, 50, 60, 70, 80, 90, 95};
+    EventBinner binner(X);
+    TS_ASSERT_EQUALS(binner.spacing(), EventBinner::Spacing::Linear);
+    TS_ASSERT_EQUALS(binner.binIndex(94.9), 9);
+    TS_ASSERT_EQUALS(binner.binIndex(89.9), 8);
+  }
+
+  void test_logarithmic_edges_are_detected() {
+    MantidVec X(200);
+    std::generate(X.begin(), X.end(), LogarithmicGenerator(10.0, 0.01));
+    EventBinner binner(X);
+    TS_ASSERT_EQUALS(binner.spacing(), EventBinner::Spacing::Logarithmic);
+    TS_ASSERT(binner.isArithmetic());
+  }
+
+  void test_irregular_edges() {
+    const MantidVec X{0, 1, 5, 6, 20};
+    EventBinner binner(X);
+    TS_ASSERT_EQUALS(binner.spacing(), EventBinner::Spacing::Irregular);
+    TS_ASSERT(!binner.isArithmetic());
+    TS_ASSERT_EQUALS(binner.binIndex(0.5), 0);
+    TS_ASSERT_EQUALS(binner.binIndex(5.0), 2);
+    TS_ASSERT_EQUALS(binner.binIndex(19.0), 3);
+  }
+
+  void test_binIndex_out_of_range() {
+    const MantidVec X{0, 10, 20};
+    EventBinner binner(X);
+    TS_ASSERT_EQUALS(binner.binIndex(-1.0), 2);
+    TS_ASSERT_EQUALS(binner.binIndex(20.0), 2);
+    TS_ASSERT_EQUALS(binner.binIndex(std::nan("")), 2);
+    TS_ASSERT_EQUALS(binner.binIndex(0.0), 0);
+    TS_ASSERT_EQUALS(binner.binIndex(10.0), 1);
+  }
+
+  void test_too_few_edges() {
+    EventBinner binner(MantidVec(1, 0.0));
+    TS_ASSERT_EQUALS(binner.numBins(), 0);
+    TS_ASSERT_EQUALS(binner.binIndex(0.0), 0);
+  }
+
+  void test_binIndex_matches_search_for_linear_edges() {
+    MantidVec X(1001);
+    std::generate(X.begin(), X.end(), LinearGenerator(-50.0, 0.3));
+    checkMatchesSearch(X);
+  }
+
+  void test_binIndex_matches_search_for_logarithmic_edges() {
+    MantidVec X(1001);
+    std::generate(X.begin(), X.end(), LogarithmicGenerator(5.0, 0.004));
+    checkMatchesSearch(X);
+  }
+
+  void test_binIndex_on_edges() {
+    // Events exactly on an edge belong to the bin above it
+    MantidVec X(1001);
+    std::generate(X.begin(), X.end(), LogarithmicGenerator(5.0, 0.004));
+    EventBinner binner(X);
+    for (size_t i = 0; i + 1 < X.size(); ++i)
+      TS_ASSERT_EQUALS(binner.binIndex(X[i]), i);
+  }
+
+  void test_addCounts_from_events() {
+    const MantidVec X{0, 10, 20, 30};
+    const std::vector<TofEvent> events{TofEvent(25), TofEvent(-1),
+                                       TofEvent(5),  TofEvent(30),
+                                       TofEvent(9),  TofEvent(10)};
+    MantidVec Y(3, 0.0);
+    EventBinner(X).addCounts(events, Y);
+    TS_ASSERT_EQUALS(Y, MantidVec({2, 1, 1}));
+  }
+
+  void test_addWeights_from_events() {
+    const MantidVec X{0, 10, 20, 30};
+    const std::vector<WeightedEvent> events{WeightedEvent(25, 0, 2.0, 4.0),
+                                            WeightedEvent(5, 0, 1.0, 1.0),
+                                            WeightedEvent(7, 0, 3.0, 9.0)};
+    MantidVec Y(3, 0.0), E2(3, 0.0);
+    EventBinner(X).addWeights(events, Y, E2);
+    TS_ASSERT_EQUALS(Y, MantidVec({4, 0, 2}));
+    TS_ASSERT_EQUALS(E2, MantidVec({10, 0, 4}));
+  }
+
+  void test_addCounts_from_array_spanning_blocks() {
+    MantidVec X(11);
+    std::generate(X.begin(), X.end(), LinearGenerator(0.0, 1.0));
+    std::vector<double> tofs;
+    for (int i = 0; i < 1000; ++i)
+      tofs.push_back(double(i % 10) + 0.5);
+    MantidVec Y(10, 0.0);
+    EventBinner(X).addCounts(tofs.data(), tofs.size(), Y);
+    TS_ASSERT_EQUALS(Y, MantidVec(10, 100.0));
+  }
+
+private:
+  void checkMatchesSearch(const MantidVec &X) {
+    EventBinner binner(X);
+    TS_ASSERT(binner.isArithmetic());
+    std::mt19937 generator(4321);
+    std::uniform_real_distribution<double> tofs(X.front() - 10.0,
+                                                X.back() + 10.0);
+    for (int i = 0; i < 100000; ++i) {
+      const double tof = tofs(generator);
+      size_t expected = X.size() - 1;
+      if (tof >= X.front() && tof < X.back())
+        expected = std::upper_bound(X.begin(), X.end(), tof) - X.begin() - 1;
+      TS_ASSERT_EQUALS(binner.binIndex(tof), expected);
+    }
+  }
+};
+
+#endif /* MANTID_DATAOBJECTS_EVENTBINNERTEST_H_ */
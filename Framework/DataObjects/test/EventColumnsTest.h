@@ -0,0 +1,278 @@
+#ifndef MANTID_DATAOBJECTS_EVENTCOLUMNSTEST_H_
+#define MANTID_DATAOBJECTS_EVENTCOLUMNSTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidDataObjects/EventColumns.h"
+#include "MantidDataObjects/EventList.h"
+
+using namespace Mantid::API;
+using namespace Mantid::DataObjects;
+using Mantid::MantidVec;
+
+class EventColumnsTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static EventColumnsTest *createSuite() { return new EventColumnsTest(); }
+  static void destroySuite(EventColumnsTest *suite) { delete suite; }
+
+  void test_default_constructor() {
+    EventColumns columns;
+    TS_ASSERT_EQUALS(columns.getEventType(), TOF);
+    TS_ASSERT(columns.empty());
+    TS_ASSERT(columns.hasPulseTimes());
+    TS_ASSERT(!columns.hasWeights());
+    TS_ASSERT(columns.isSortedByTof());
+  }
+
+  void test_construct_from_EventList_TOF() {
+    EventColumns columns(makeTofList());
+    TS_ASSERT_EQUALS(columns.size(), 4);
+    TS_ASSERT_EQUALS(columns.tofs(), std::vector<double>({3.5, 100, 50, 7}));
+    TS_ASSERT_EQUALS(columns.pulseTimes(),
+                     std::vector<int64_t>({400, 200, 60, 10}));
+    TS_ASSERT(columns.weights().empty());
+    TS_ASSERT(columns.errorSquareds().empty());
+    TS_ASSERT(!columns.isSortedByTof());
+  }
+
+  void test_construct_from_EventList_WEIGHTED_NOTIME() {
+    auto el = makeTofList();
+    el.switchTo(WEIGHTED_NOTIME);
+    EventColumns columns(el);
+    TS_ASSERT_EQUALS(columns.getEventType(), WEIGHTED_NOTIME);
+    TS_ASSERT(!columns.hasPulseTimes());
+    TS_ASSERT(columns.pulseTimes().empty());
+    TS_ASSERT_EQUALS(columns.weights().size(), 4);
+    TS_ASSERT_EQUALS(columns.errorSquareds().size(), 4);
+  }
+
+  void test_append_wrong_type_throws() {
+    EventColumns columns(WEIGHTED);
+    TS_ASSERT_THROWS(columns.append(TofEvent(1.0, 2)), std::invalid_argument);
+    TS_ASSERT_THROWS_NOTHING(columns.append(WeightedEvent(1.0, 2, 2.0, 4.0)));
+    TS_ASSERT_EQUALS(columns.size(), 1);
+  }
+
+  void test_getEvent() {
+    EventColumns columns(WEIGHTED);
+    columns.append(WeightedEvent(1.5, 20, 2.0, 4.0));
+    const auto event = columns.getEvent(0);
+    TS_ASSERT_EQUALS(event.tof(), 1.5);
+    TS_ASSERT_EQUALS(event.pulseTime(), 20);
+    TS_ASSERT_EQUALS(event.weight(), 2.0);
+    TS_ASSERT_EQUALS(event.errorSquared(), 4.0);
+  }
+
+  void test_sortTof_keeps_columns_together() {
+    EventColumns columns(makeWeightedList());
+    columns.sortTof();
+    TS_ASSERT(columns.isSortedByTof());
+    TS_ASSERT_EQUALS(columns.tofs(), std::vector<double>({3.5, 7, 50, 100}));
+    TS_ASSERT_EQUALS(columns.pulseTimes(),
+                     std::vector<int64_t>({400, 10, 60, 200}));
+    TS_ASSERT_EQUALS(columns.weights(), std::vector<float>({1, 4, 3, 2}));
+    TS_ASSERT_EQUALS(columns.errorSquareds(),
+                     std::vector<float>({1, 16, 9, 4}));
+  }
+
+  void test_convertTof_linear() {
+    EventColumns columns(makeTofList());
+    columns.convertTof(2.0, 1.0);
+    TS_ASSERT_EQUALS(columns.tofs(), std::vector<double>({8, 201, 101, 15}));
+    // Pulse times are untouched
+    TS_ASSERT_EQUALS(columns.pulseTimes(),
+                     std::vector<int64_t>({400, 200, 60, 10}));
+  }
+
+  void test_convertTof_negative_factor_keeps_sorted_order() {
+    EventColumns columns(makeTofList());
+    columns.sortTof();
+    columns.convertTof(-1.0);
+    TS_ASSERT(columns.isSortedByTof());
+    TS_ASSERT_EQUALS(columns.tofs(),
+                     std::vector<double>({-100, -50, -7, -3.5}));
+    TS_ASSERT_EQUALS(columns.pulseTimes(),
+                     std::vector<int64_t>({200, 60, 10, 400}));
+  }
+
+  void test_convertTof_function_marks_unsorted() {
+    EventColumns columns(makeTofList());
+    columns.sortTof();
+    columns.convertTof([](double tof) { return tof * tof; });
+    TS_ASSERT(!columns.isSortedByTof());
+    TS_ASSERT_EQUALS(columns.tofs()[0], 3.5 * 3.5);
+  }
+
+  void test_generateHistogram_matches_EventList_for_TOF() {
+    auto el = makeTofList();
+    const MantidVec X{0, 5, 10, 60, 80};
+    MantidVec Yexpected, Eexpected;
+    el.generateHistogram(X, Yexpected, Eexpected);
+
+    EventColumns columns(makeTofList());
+    MantidVec Y, E;
+    // Unsorted path
+    columns.generateHistogram(X, Y, E);
+    TS_ASSERT_EQUALS(Y, Yexpected);
+    TS_ASSERT_EQUALS(E, Eexpected);
+    // Sorted path
+    columns.sortTof();
+    columns.generateHistogram(X, Y, E);
+    TS_ASSERT_EQUALS(Y, Yexpected);
+    TS_ASSERT_EQUALS(E, Eexpected);
+  }
+
+  void test_generateHistogram_weighted() {
+    EventColumns columns(makeWeightedList());
+    const MantidVec X{0, 10, 200};
+    MantidVec Y, E;
+    columns.generateHistogram(X, Y, E);
+    TS_ASSERT_EQUALS(Y, MantidVec({5, 5}));
+    TS_ASSERT_DELTA(E[0], std::sqrt(17.0), 1e-12);
+    TS_ASSERT_DELTA(E[1], std::sqrt(13.0), 1e-12);
+  }
+
+  void test_generateHistogram_with_no_bins() {
+    EventColumns columns(makeTofList());
+    MantidVec Y(3, 1.0), E(3, 1.0);
+    columns.generateHistogram(MantidVec(1, 0.0), Y, E);
+    TS_ASSERT(Y.empty());
+    TS_ASSERT(E.empty());
+  }
+
+  void test_copyTo_round_trips() {
+    const auto original = makeWeightedList();
+    EventColumns columns(original);
+    EventList el;
+    columns.copyTo(el);
+    TS_ASSERT_EQUALS(el.getEventType(), WEIGHTED);
+    TS_ASSERT_EQUALS(el.getWeightedEvents(), original.getWeightedEvents());
+  }
+
+  void test_copyTo_keeps_sort_order() {
+    EventColumns columns(makeTofList());
+    columns.sortTof();
+    EventList el;
+    columns.copyTo(el);
+    TS_ASSERT(el.isSortedByTof());
+    TS_ASSERT_EQUALS(el.getEvents()[0].tof(), 3.5);
+  }
+
+  void test_copyTo_cannot_remove_weights_and_keeps_the_list() {
+    EventColumns columns(makeTofList());
+    auto el = makeWeightedList();
+    TS_ASSERT_THROWS(columns.copyTo(el), std::runtime_error);
+    TS_ASSERT_EQUALS(el.getEventType(), WEIGHTED);
+    TS_ASSERT_EQUALS(el.getWeightedEvents(),
+                     makeWeightedList().getWeightedEvents());
+  }
+
+  void test_copyTo_vector() {
+    EventColumns columns(makeWeightedList());
+    std::vector<WeightedEvent> events(2);
+    columns.copyTo(events);
+    TS_ASSERT_EQUALS(events.size(), 4);
+    TS_ASSERT_EQUALS(events[1].tof(), 100);
+    TS_ASSERT_EQUALS(events[1].weight(), 2.0);
+    std::vector<WeightedEventNoTime> noTimeEvents;
+    TS_ASSERT_THROWS(columns.copyTo(noTimeEvents), std::invalid_argument);
+  }
+
+  void test_sortPulseTime() {
+    EventColumns columns(makeWeightedList());
+    columns.sortTof();
+    columns.sortPulseTime();
+    TS_ASSERT(!columns.isSortedByTof());
+    TS_ASSERT_EQUALS(columns.pulseTimes(),
+                     std::vector<int64_t>({10, 60, 200, 400}));
+    TS_ASSERT_EQUALS(columns.tofs(), std::vector<double>({7, 50, 100, 3.5}));
+    TS_ASSERT_EQUALS(columns.weights(), std::vector<float>({4, 3, 2, 1}));
+  }
+
+  void test_sortPulseTimeTof() {
+    EventColumns columns(EventList(std::vector<TofEvent>{
+        TofEvent(5, 20), TofEvent(3, 10), TofEvent(1, 20), TofEvent(4, 10)}));
+    columns.sortPulseTimeTof();
+    TS_ASSERT_EQUALS(columns.pulseTimes(),
+                     std::vector<int64_t>({10, 10, 20, 20}));
+    TS_ASSERT_EQUALS(columns.tofs(), std::vector<double>({3, 4, 1, 5}));
+  }
+
+  void test_sortTimeAtSample() {
+    // The time at sample is pulse + tof * tofFactor, in ns with tof in us.
+    EventColumns columns(EventList(std::vector<TofEvent>{
+        TofEvent(1, 2500), TofEvent(2, 500), TofEvent(3, 1000)}));
+    columns.sortTimeAtSample(1.0, 0.0);
+    TS_ASSERT_EQUALS(columns.tofs(), std::vector<double>({2, 1, 3}));
+    columns.sortTimeAtSample(0.0, 0.0);
+    TS_ASSERT_EQUALS(columns.tofs(), std::vector<double>({2, 3, 1}));
+  }
+
+  void test_sorting_without_pulse_times_does_nothing() {
+    EventColumns columns(EventList(std::vector<WeightedEventNoTime>{
+        WeightedEventNoTime(5, 1.0, 1.0), WeightedEventNoTime(3, 1.0, 1.0)}));
+    columns.sortPulseTime();
+    TS_ASSERT_EQUALS(columns.tofs(), std::vector<double>({5, 3}));
+  }
+
+  void test_reverse() {
+    EventColumns columns(makeWeightedList());
+    columns.reverse();
+    TS_ASSERT_EQUALS(columns.tofs(), std::vector<double>({7, 50, 100, 3.5}));
+    TS_ASSERT_EQUALS(columns.pulseTimes(),
+                     std::vector<int64_t>({10, 60, 200, 400}));
+    TS_ASSERT_EQUALS(columns.errorSquareds(),
+                     std::vector<float>({16, 9, 4, 1}));
+  }
+
+private:
+  EventList makeTofList() {
+    return EventList(std::vector<TofEvent>{
+        TofEvent(3.5, 400), TofEvent(100, 200), TofEvent(50, 60),
+        TofEvent(7, 10)});
+  }
+
+  EventList makeWeightedList() {
+    return EventList(std::vector<WeightedEvent>{
+        WeightedEvent(3.5, 400, 1.0, 1.0), WeightedEvent(100, 200, 2.0, 4.0),
+        WeightedEvent(50, 60, 3.0, 9.0), WeightedEvent(7, 10, 4.0, 16.0)});
+  }
+};
+
+class EventColumnsTestPerformance : public CxxTest::TestSuite {
+public:
+  static EventColumnsTestPerformance *createSuite() {
+    return new EventColumnsTestPerformance();
+  }
+  static void destroySuite(EventColumnsTestPerformance *suite) {
+    delete suite;
+  }
+
+  EventColumnsTestPerformance() : m_columns(WEIGHTED) {
+    const size_t nEvents = 5000000;
+    m_columns.reserve(nEvents);
+    for (size_t i = 0; i < nEvents; ++i) {
+      const double tof = static_cast<double>((i * 7919) % 20000);
+      m_columns.append(WeightedEvent(tof, static_cast<int64_t>(i), 1.0, 1.0));
+    }
+    for (double x = 0.; x <= 20000.; x += 10.)
+      m_X.push_back(x);
+  }
+
+  void test_sortTof() { m_columns.sortTof(); }
+
+  void test_convertTof() { m_columns.convertTof(1.01, 2.0); }
+
+  void test_generateHistogram() {
+    MantidVec Y, E;
+    m_columns.generateHistogram(m_X, Y, E);
+  }
+
+private:
+  EventColumns m_columns;
+  MantidVec m_X;
+};
+
+#endif /* MANTID_DATAOBJECTS_EVENTCOLUMNSTEST_H_ */
@@ -6,9 +6,13 @@
 #include "MantidDataObjects/EventWorkspace.h"
 #include "MantidKernel/Timer.h"
 #include "MantidKernel/CPUTimer.h"
+#include "MantidHistogramData/LinearGenerator.h"
+#include "MantidHistogramData/LogarithmicGenerator.h"
 
+#include <boost/make_shared.hpp>
 #include <boost/scoped_ptr.hpp>
 #include <cmath>
+#include <thread>
 
 using namespace Mantid;
 using namespace Mantid::API;
@@ -1126,6 +1130,38 @@ public:
     }
   }
 
+  void test_histogram_unsorted_with_linear_and_log_bins() {
+    for (int this_type = 0; this_type < 3; this_type++) {
+      for (const bool logBins : {false, true}) {
+        this->fake_data();
+        el.switchTo(static_cast<EventType>(this_type));
+        if (this_type != TOF)
+          el.multiply(2.0, 0.5);
+        MantidVec X(NUMEVENTS / 2);
+        if (logBins)
+          std::generate(X.begin(), X.end(), LogarithmicGenerator(1e5, 0.05));
+        else
+          std::generate(X.begin(), X.end(), LinearGenerator(0.0, 2e5));
+
+        MantidVec Y, E;
+        el.generateHistogram(X, Y, E);
+        // The bins were computed, so the events did not need sorting
+        TS_ASSERT(!el.isSortedByTof());
+
+        EventList sorted(el);
+        sorted.sortTof();
+        MantidVec Ysorted, Esorted;
+        sorted.generateHistogram(X, Ysorted, Esorted);
+        TS_ASSERT_EQUALS(Y.size(), Ysorted.size());
+        TS_ASSERT_EQUALS(E.size(), Esorted.size());
+        for (size_t i = 0; i < Y.size(); i++) {
+          TS_ASSERT_DELTA(Y[i], Ysorted[i], 1e-10);
+          TS_ASSERT_DELTA(E[i], Esorted[i], 1e-10);
+        }
+      }
+    }
+  }
+
   void test_histogram_const_call() {
     this->fake_uniform_data();
     this->test_setX(); // Set it up WITH THE default binning
@@ -1805,6 +1841,69 @@ public:
     return;
   }
 
+  //-----------------------------------------------------------------------------------------------
+  /** Test splitting events in one pass by the boundaries of the intervals
+   */
+  void test_splitByTimeBoundaries() {
+    // One event in each interval [i, i+1) ms
+    fake_uniform_time_sns_data();
+    std::vector<EventList> lists(3);
+    std::vector<EventList *> outputs{&lists[0], &lists[1], &lists[2]};
+
+    const std::vector<int64_t> splitTimes{100000000, 200000000, 300000000};
+    const std::vector<size_t> splitTargets{0, 1, 2, 0};
+    for (const bool pulseTimeOnly : {false, true}) {
+      el.splitByTimeBoundaries(splitTimes, splitTargets, outputs,
+                               pulseTimeOnly, false, 1.0, 0.0);
+      TS_ASSERT_EQUALS(lists[0].getNumberEvents(), 800);
+      TS_ASSERT_EQUALS(lists[1].getNumberEvents(), 100);
+      TS_ASSERT_EQUALS(lists[2].getNumberEvents(), 100);
+      TS_ASSERT_EQUALS(lists[1].getEvent(0).pulseTime(),
+                       DateAndTime(int64_t(100000000)));
+      TS_ASSERT_EQUALS(lists[2].getEvent(99).pulseTime(),
+                       DateAndTime(int64_t(299000000)));
+      TS_ASSERT_EQUALS(lists[1].getSortType(), PULSETIMETOF_SORT);
+    }
+
+    // Shift every event back by 50 ms
+    el.switchTo(WEIGHTED);
+    el *= 2.;
+    el.splitByTimeBoundaries(splitTimes, splitTargets, outputs, false, true,
+                             0.0, -0.05);
+    TS_ASSERT_EQUALS(lists[1].getEventType(), WEIGHTED);
+    TS_ASSERT_EQUALS(lists[1].getNumberEvents(), 100);
+    TS_ASSERT_EQUALS(lists[1].getEvent(0).pulseTime(),
+                     DateAndTime(int64_t(150000000)));
+    TS_ASSERT_EQUALS(lists[1].getEvent(0).weight(), 2.);
+  }
+
+  void test_splitByTimeBoundaries_needs_an_output_for_each_target() {
+    fake_uniform_time_sns_data();
+    EventList output;
+    std::vector<EventList *> outputs{&output, nullptr};
+    TS_ASSERT_THROWS(el.splitByTimeBoundaries({100}, {0}, outputs, false,
+                                              false, 1.0, 0.0),
+                     std::invalid_argument);
+    TS_ASSERT_THROWS(el.splitByTimeBoundaries({100}, {0, 2}, outputs, false,
+                                              false, 1.0, 0.0),
+                     std::invalid_argument);
+    TS_ASSERT_THROWS_NOTHING(el.splitByTimeBoundaries({100}, {0, 0}, outputs,
+                                                      false, false, 1.0, 0.0));
+    TS_ASSERT_EQUALS(output.getNumberEvents(), 1000);
+  }
+
+  void test_splitByTimeBoundaries_drops_the_events_of_null_outputs() {
+    // One event in each interval [i, i+1) ms
+    fake_uniform_time_sns_data();
+    EventList output;
+    std::vector<EventList *> outputs{&output, nullptr};
+    el.splitByTimeBoundaries({100000000, 200000000}, {1, 0, 1}, outputs, false,
+                             false, 1.0, 0.0);
+    TS_ASSERT_EQUALS(output.getNumberEvents(), 100);
+    TS_ASSERT_EQUALS(output.getEvent(0).pulseTime(),
+                     DateAndTime(int64_t(100000000)));
+  }
+
   //-----------------------------------------------------------------------------------------------
   void test_splitByTime_allTypes() {
     // Go through each possible EventType as the input
@@ -1995,6 +2094,23 @@ public:
   }
 
   //----------------------------------------------------------------------------------------------
+  void test_compressEvents_logarithmic() {
+    el = EventList();
+    for (const double tof : {100.0, 100.05, 100.2, 1000.0, 1000.5, 1002.0})
+      el.addEventQuickly(TofEvent(tof, 0));
+
+    // Within 0.1% of the first event of each group
+    el.compressEvents(-0.001, &el);
+    TS_ASSERT_EQUALS(el.getNumberEvents(), 4);
+    const auto &events = el.getWeightedEventsNoTime();
+    TS_ASSERT_DELTA(events[0].tof(), 100.025, 1e-6);
+    TS_ASSERT_DELTA(events[0].weight(), 2.0, 1e-6);
+    TS_ASSERT_DELTA(events[1].tof(), 100.2, 1e-6);
+    TS_ASSERT_DELTA(events[2].tof(), 1000.25, 1e-6);
+    TS_ASSERT_DELTA(events[2].weight(), 2.0, 1e-6);
+    TS_ASSERT_DELTA(events[3].tof(), 1002.0, 1e-6);
+  }
+
   void test_compressEvents_InPlace_or_Not() {
     for (int this_type = 0; this_type < 3; this_type++) {
       for (size_t inplace = 0; inplace < 2; inplace++) {
@@ -2614,6 +2730,278 @@ public:
     TS_ASSERT_EQUALS(freqHist.counts()[0], 4.0);
     TS_ASSERT_EQUALS(freqHist.counts()[1], 2.0);
   }
+
+  //==================================================================================
+  //--- Compact events ---
+  //==================================================================================
+
+  void test_switchToCompactEvents_only_on_empty_tof_list() {
+    auto pulseTimes = makePulseTimeTable();
+    TS_ASSERT_THROWS(el.switchToCompactEvents(PulseTimeTable_const_sptr()),
+                     std::invalid_argument);
+    // el already has events
+    TS_ASSERT(!el.switchToCompactEvents(pulseTimes));
+    TS_ASSERT(!el.hasCompactEvents());
+
+    EventList weighted;
+    weighted.switchTo(WEIGHTED);
+    TS_ASSERT(!weighted.switchToCompactEvents(pulseTimes));
+
+    EventList compact;
+    TS_ASSERT(compact.switchToCompactEvents(pulseTimes));
+    TS_ASSERT(compact.hasCompactEvents());
+    TS_ASSERT_EQUALS(compact.getCompactPulseTimes(), pulseTimes);
+    TS_ASSERT_EQUALS(compact.getEventType(), TOF);
+    // Once filled, the table can't change
+    compact.getCompactEvents().emplace_back(1.f, 0);
+    TS_ASSERT(compact.switchToCompactEvents(pulseTimes));
+    TS_ASSERT(!compact.switchToCompactEvents(makePulseTimeTable()));
+  }
+
+  void test_getCompactEvents_throws_on_regular_list() {
+    TS_ASSERT_THROWS(el.getCompactEvents(), std::runtime_error);
+  }
+
+  void test_compact_events_sort_and_histogram_without_expanding() {
+    EventList compact = makeCompactList();
+    TS_ASSERT_EQUALS(compact.getNumberEvents(), 4);
+    TS_ASSERT(!compact.empty());
+    TS_ASSERT_EQUALS(compact.getTofMin(), 3.5);
+    TS_ASSERT_EQUALS(compact.getTofMax(), 100.);
+
+    MantidVec X{0, 10, 60, 200}, Y, E;
+    compact.generateHistogram(X, Y, E);
+    TS_ASSERT_EQUALS(Y, MantidVec({2, 1, 1}));
+    TS_ASSERT_DELTA(E[0], M_SQRT2, 1e-12);
+    TS_ASSERT(compact.isSortedByTof());
+    TS_ASSERT_EQUALS(compact.getCompactEvents()[0].tof(), 3.5);
+    TS_ASSERT_EQUALS(compact.getCompactEvents()[0].pulseIndex(), 2);
+    TS_ASSERT_EQUALS(compact.integrate(0., 60., false), 3.);
+    TS_ASSERT_EQUALS(compact.getTofs(), std::vector<double>({3.5, 7, 50, 100}));
+    TS_ASSERT(compact.hasCompactEvents());
+  }
+
+  void test_compact_events_pulse_times() {
+    EventList compact = makeCompactList();
+    const auto pulseTimes = *compact.getCompactPulseTimes();
+    TS_ASSERT_EQUALS(compact.getPulseTimes(),
+                     std::vector<DateAndTime>({pulseTimes[1], pulseTimes[1],
+                                               pulseTimes[2], pulseTimes[0]}));
+    TS_ASSERT_EQUALS(compact.getPulseTimeMin(), pulseTimes[0]);
+    TS_ASSERT_EQUALS(compact.getPulseTimeMax(), pulseTimes[2]);
+    TS_ASSERT(compact.hasCompactEvents());
+  }
+
+  void test_compact_events_expand_when_needed() {
+    EventList compact = makeCompactList();
+    const auto pulseTimes = *compact.getCompactPulseTimes();
+    const auto &events = compact.getEvents();
+    TS_ASSERT(!compact.hasCompactEvents());
+    TS_ASSERT_EQUALS(events.size(), 4);
+    TS_ASSERT_EQUALS(events[0], TofEvent(100, pulseTimes[1]));
+    TS_ASSERT_EQUALS(events[3], TofEvent(7, pulseTimes[0]));
+  }
+
+  void test_compact_events_const_access_keeps_compact_events() {
+    EventList compact = makeCompactList();
+    const EventList &constList = compact;
+    const auto pulseTimes = *compact.getCompactPulseTimes();
+    const auto &events = constList.getEvents();
+    TS_ASSERT(compact.hasCompactEvents());
+    TS_ASSERT_EQUALS(events.size(), 4);
+    TS_ASSERT_EQUALS(events[3], TofEvent(7, pulseTimes[0]));
+    // Sorting reorders the compact events and their copy alike
+    constList.sortPulseTimeTOF();
+    TS_ASSERT_EQUALS(constList.getCompactEvents()[0].tof(), 7.);
+    TS_ASSERT_EQUALS(constList.getCompactEvents()[3].pulseIndex(), 2);
+    TS_ASSERT_EQUALS(events[0], TofEvent(7, pulseTimes[0]));
+    TS_ASSERT_EQUALS(events[1], TofEvent(50, pulseTimes[1]));
+    TS_ASSERT_EQUALS(events[3], TofEvent(3.5, pulseTimes[2]));
+    // Modifying the list leaves the TofEvent's
+    compact.addPulsetime(0.);
+    TS_ASSERT(!compact.hasCompactEvents());
+    TS_ASSERT_EQUALS(compact.getEvents()[1], TofEvent(50, pulseTimes[1]));
+  }
+
+  void test_compact_events_concurrent_const_access() {
+    EventList compact = makeCompactList();
+    const EventList &constList = compact;
+    std::vector<size_t> numEvents(4, 0);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < numEvents.size(); ++i)
+      threads.emplace_back([&constList, &numEvents, i] {
+        numEvents[i] =
+            constList.getEvents().size() + constList.getNumberEvents();
+      });
+    for (auto &thread : threads)
+      thread.join();
+    for (auto num : numEvents)
+      TS_ASSERT_EQUALS(num, 8);
+    TS_ASSERT(compact.hasCompactEvents());
+  }
+
+  void test_compact_events_switch_to_weighted() {
+    EventList compact = makeCompactList();
+    compact *= 2.0;
+    TS_ASSERT(!compact.hasCompactEvents());
+    TS_ASSERT_EQUALS(compact.getEventType(), WEIGHTED);
+    TS_ASSERT_EQUALS(compact.getWeightedEvents().size(), 4);
+    TS_ASSERT_EQUALS(compact.getWeightedEvents()[2].weight(), 2.0);
+  }
+
+  void test_compact_events_compress() {
+    EventList compact = makeCompactList();
+    compact.compressEvents(5., &compact);
+    TS_ASSERT(!compact.hasCompactEvents());
+    TS_ASSERT_EQUALS(compact.getEventType(), WEIGHTED_NOTIME);
+    // 3.5 and 7 are combined
+    TS_ASSERT_EQUALS(compact.getNumberEvents(), 3);
+    TS_ASSERT_EQUALS(compact.getWeightedEventsNoTime()[0].weight(), 2.0);
+  }
+
+  void test_compact_events_copy_and_compare() {
+    EventList compact = makeCompactList();
+    EventList copy(compact);
+    TS_ASSERT(copy.hasCompactEvents());
+    TS_ASSERT_EQUALS(copy.getCompactPulseTimes(),
+                     compact.getCompactPulseTimes());
+    TS_ASSERT(copy == compact);
+    copy.clear();
+    TS_ASSERT(!copy.hasCompactEvents());
+    TS_ASSERT(copy.empty());
+  }
+
+  void test_compact_events_memory() {
+    EventList compact = makeCompactList();
+    EventList regular(makeCompactList().getEvents());
+    TS_ASSERT_LESS_THAN(compact.getMemorySize(), regular.getMemorySize());
+  }
+
+  void test_columns_sort_and_histogram_without_expanding() {
+    EventList columnar = makeColumnarList();
+    TS_ASSERT(columnar.hasColumns());
+    TS_ASSERT_EQUALS(columnar.getNumberEvents(), 4);
+    TS_ASSERT(!columnar.empty());
+
+    MantidVec X{0, 10, 60, 200}, Y, E;
+    columnar.generateHistogram(X, Y, E);
+    TS_ASSERT_EQUALS(Y, MantidVec({2, 1, 1}));
+    TS_ASSERT_DELTA(E[0], M_SQRT2, 1e-12);
+
+    columnar.sortTof();
+    TS_ASSERT(columnar.isSortedByTof());
+    columnar.generateHistogram(X, Y, E);
+    TS_ASSERT_EQUALS(Y, MantidVec({2, 1, 1}));
+    TS_ASSERT(columnar.hasColumns());
+  }
+
+  void test_columns_sort_pulse_time() {
+    EventList columnar = makeColumnarList();
+    columnar.sortPulseTime();
+    TS_ASSERT_EQUALS(columnar.getSortType(), PULSETIME_SORT);
+    TS_ASSERT(columnar.hasColumns());
+    const EventList &constList = columnar;
+    TS_ASSERT_EQUALS(constList.getEvents()[0], TofEvent(7, DateAndTime(10)));
+    TS_ASSERT_EQUALS(constList.getTofs(),
+                     std::vector<double>({7, 100, 50, 3.5}));
+    // The copy read above follows later sorts.
+    columnar.sortTof();
+    TS_ASSERT_EQUALS(constList.getEvents()[0],
+                     TofEvent(3.5, DateAndTime(400)));
+    TS_ASSERT(columnar.hasColumns());
+  }
+
+  void test_columns_convertTof() {
+    EventList columnar = makeColumnarList();
+    columnar.setX(make_cow<HistogramX>(std::vector<double>{0, 10, 200}));
+    columnar.sortTof();
+    columnar.convertTof(-2.0, 1.0);
+    TS_ASSERT(columnar.hasColumns());
+    TS_ASSERT(columnar.isSortedByTof());
+    TS_ASSERT_EQUALS(columnar.readX(), std::vector<double>({-399, -19, 1}));
+    TS_ASSERT_EQUALS(columnar.getTofs(),
+                     std::vector<double>({-199, -99, -13, -6}));
+
+    columnar.convertTof([](double tof) { return -tof; }, -1);
+    TS_ASSERT(columnar.isSortedByTof());
+    TS_ASSERT_EQUALS(columnar.getTofs(),
+                     std::vector<double>({6, 13, 99, 199}));
+    TS_ASSERT_EQUALS(columnar.readX(), std::vector<double>({-1, 19, 399}));
+  }
+
+  void test_columns_modifying_the_events_moves_them_out() {
+    EventList columnar = makeColumnarList();
+    columnar += TofEvent(1, DateAndTime(5));
+    TS_ASSERT(!columnar.hasColumns());
+    TS_ASSERT_EQUALS(columnar.getNumberEvents(), 5);
+
+    columnar = makeColumnarList();
+    columnar *= 2.0;
+    TS_ASSERT(!columnar.hasColumns());
+    TS_ASSERT_EQUALS(columnar.getEventType(), WEIGHTED);
+    TS_ASSERT_EQUALS(columnar.getWeightedEvents()[2].weight(), 2.0);
+
+    columnar = makeColumnarList();
+    columnar.compressEvents(5., &columnar);
+    TS_ASSERT(!columnar.hasColumns());
+    TS_ASSERT_EQUALS(columnar.getNumberEvents(), 3);
+  }
+
+  void test_columns_copy_and_compare() {
+    EventList columnar = makeColumnarList();
+    EventList copy(columnar);
+    TS_ASSERT(copy.hasColumns());
+    TS_ASSERT(copy == columnar);
+    copy.switchFromColumns();
+    TS_ASSERT(!copy.hasColumns());
+    TS_ASSERT(copy == columnar);
+    copy.clear();
+    TS_ASSERT(!copy.hasColumns());
+    TS_ASSERT(copy.empty());
+  }
+
+  void test_columns_concurrent_const_access() {
+    EventList columnar = makeColumnarList();
+    const EventList &constList = columnar;
+    std::vector<size_t> numEvents(4, 0);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < numEvents.size(); ++i)
+      threads.emplace_back([&constList, &numEvents, i] {
+        numEvents[i] =
+            constList.getEvents().size() + constList.getNumberEvents();
+      });
+    for (auto &thread : threads)
+      thread.join();
+    for (auto num : numEvents)
+      TS_ASSERT_EQUALS(num, 8);
+    TS_ASSERT(columnar.hasColumns());
+  }
+
+private:
+  PulseTimeTable_const_sptr makePulseTimeTable() {
+    return boost::make_shared<std::vector<DateAndTime>>(
+        std::vector<DateAndTime>{DateAndTime(10), DateAndTime(200),
+                                 DateAndTime(400)});
+  }
+
+  /// Same tofs as el, in a compact list
+  EventList makeCompactList() {
+    EventList compact;
+    compact.switchToCompactEvents(makePulseTimeTable());
+    auto &events = compact.getCompactEvents();
+    events.emplace_back(100.f, 1);
+    events.emplace_back(50.f, 1);
+    events.emplace_back(3.5f, 2);
+    events.emplace_back(7.f, 0);
+    return compact;
+  }
+
+  /// Same events as makeCompactList(), in columns
+  EventList makeColumnarList() {
+    EventList columnar(makeCompactList().getEvents());
+    columnar.switchToColumns();
+    return columnar;
+  }
 };
 
 //==========================================================================================
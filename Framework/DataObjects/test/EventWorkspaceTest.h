@@ -547,6 +547,32 @@ public:
     }
   }
 
+  void test_setColumnarEvents() {
+    EventWorkspace_sptr test_in =
+        WorkspaceCreationHelper::CreateRandomEventWorkspace(NUMBINS, NUMPIXELS);
+    MantidVec Y, E;
+    test_in->generateHistogram(2, test_in->readX(2), Y, E);
+
+    test_in->setColumnarEvents(true);
+    for (int wi = 0; wi < NUMPIXELS; wi++)
+      TS_ASSERT(test_in->getSpectrum(wi).hasColumns());
+    TS_ASSERT_EQUALS(test_in->getNumberEvents(), NUMBINS * NUMPIXELS);
+    MantidVec columnsY, columnsE;
+    test_in->generateHistogram(2, test_in->readX(2), columnsY, columnsE);
+    TS_ASSERT_EQUALS(columnsY, Y);
+    TS_ASSERT_EQUALS(columnsE, E);
+
+    test_in->sortAll(TOF_SORT, nullptr);
+    TS_ASSERT(test_in->getSpectrum(2).hasColumns());
+    const auto &events = test_in->getSpectrum(2).getEvents();
+    for (size_t i = 0; i + 1 < events.size(); i++)
+      TS_ASSERT_LESS_THAN_EQUALS(events[i].tof(), events[i + 1].tof());
+
+    test_in->setColumnarEvents(false);
+    TS_ASSERT(!test_in->getSpectrum(2).hasColumns());
+    TS_ASSERT_EQUALS(test_in->getNumberEvents(), NUMBINS * NUMPIXELS);
+  }
+
   /** Test sortAll() when there are more cores available than pixels.
    * This test will only work on machines with 2 cores at least.
    */
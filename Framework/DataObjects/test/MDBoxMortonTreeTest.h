@@ -0,0 +1,117 @@
+#ifndef MANTID_DATAOBJECTS_MDBOXMORTONTREETEST_H_
+#define MANTID_DATAOBJECTS_MDBOXMORTONTREETEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidDataObjects/MDBoxMortonTree.h"
+#include "MantidDataObjects/MDGridBox.h"
+#include "MantidGeometry/MDGeometry/MDBoxImplicitFunction.h"
+#include "MantidTestHelpers/MDEventsTestHelper.h"
+
+#include <algorithm>
+#include <memory>
+
+using namespace Mantid;
+using namespace Mantid::DataObjects;
+using Mantid::API::IMDNode;
+using Mantid::Geometry::MDBoxImplicitFunction;
+
+class MDBoxMortonTreeTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static MDBoxMortonTreeTest *createSuite() {
+    return new MDBoxMortonTreeTest();
+  }
+  static void destroySuite(MDBoxMortonTreeTest *suite) { delete suite; }
+
+  typedef MDGridBox<MDLeanEvent<2>, 2> gbox_t;
+
+  void setUp() override {
+    // 4x4 boxes of width 4, with the box at (1, 1) split again into 4x4
+    m_root = MDEventsTestHelper::makeMDGridBox<2>(4, 4, 0.0, 16.0);
+    m_root->splitContents(5);
+  }
+
+  void tearDown() override {
+    delete m_root->getBoxController();
+    delete m_root;
+  }
+
+  void test_boxes_are_depth_first_in_Morton_order() {
+    MDBoxMortonTree tree(m_root);
+    TS_ASSERT_EQUALS(tree.getNumDims(), 2);
+    TS_ASSERT_EQUALS(tree.getNumBoxes(), 1 + 16 + 16);
+    TS_ASSERT_EQUALS(tree.getBoxes()[0], m_root);
+    const auto &leaves = tree.getLeaves();
+    TS_ASSERT_EQUALS(leaves.size(), 15 + 16);
+
+    // Cells (x, y) with the first dimension varying fastest are at x + 4 * y
+    const size_t order[] = {0, 1, 4,  5,  2,  3,  6,  7,
+                            8, 9, 12, 13, 10, 11, 14, 15};
+    auto split = m_root->getChild(5);
+    std::vector<IMDNode *> expected;
+    for (auto index : order) {
+      if (index == 5) {
+        for (auto subIndex : order)
+          expected.push_back(split->getChild(subIndex));
+      } else {
+        expected.push_back(m_root->getChild(index));
+      }
+    }
+    TS_ASSERT(leaves == expected);
+
+    // The split box is followed by its children
+    const auto &boxes = tree.getBoxes();
+    auto it = std::find(boxes.begin(), boxes.end(), split);
+    TS_ASSERT_EQUALS(it - boxes.begin(), 4);
+    TS_ASSERT_EQUALS(*(it + 1), split->getChild(0));
+  }
+
+  void test_getBoxAtCoord_matches_the_grid_box() {
+    MDBoxMortonTree tree(m_root);
+    for (coord_t x = 0.25f; x < 16.0f; x += 0.5f) {
+      for (coord_t y = 0.25f; y < 16.0f; y += 0.5f) {
+        const coord_t coords[2] = {x, y};
+        TS_ASSERT_EQUALS(tree.getBoxAtCoord(coords),
+                         m_root->getBoxAtCoord(coords));
+      }
+    }
+    const coord_t outside[2] = {-1.0f, 2.0f};
+    TS_ASSERT(!tree.getBoxAtCoord(outside));
+  }
+
+  void test_getBoxes_with_function_matches_testing_every_leaf() {
+    MDBoxMortonTree tree(m_root);
+    std::vector<coord_t> min{2.5f, 3.5f};
+    std::vector<coord_t> max{9.5f, 6.5f};
+    MDBoxImplicitFunction function(min, max);
+
+    std::vector<IMDNode *> boxes;
+    tree.getBoxes(boxes, function);
+
+    std::vector<IMDNode *> expected;
+    for (auto leaf : tree.getLeaves()) {
+      size_t numVertexes;
+      std::unique_ptr<coord_t[]> vertexes(
+          leaf->getVertexesArray(numVertexes));
+      if (function.boxContact(vertexes.get(), numVertexes) !=
+          MDBoxImplicitFunction::NOT_TOUCHING)
+        expected.push_back(leaf);
+    }
+    TS_ASSERT(!boxes.empty());
+    TS_ASSERT(boxes == expected);
+
+    // A function containing everything returns all leaves
+    MDBoxImplicitFunction all(std::vector<coord_t>{-1.0f, -1.0f},
+                              std::vector<coord_t>{17.0f, 17.0f});
+    boxes.clear();
+    tree.getBoxes(boxes, all);
+    TS_ASSERT(boxes == tree.getLeaves());
+  }
+
+private:
+  gbox_t *m_root;
+};
+
+#endif /* MANTID_DATAOBJECTS_MDBOXMORTONTREETEST_H_ */
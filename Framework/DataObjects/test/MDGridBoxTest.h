@@ -897,6 +897,45 @@ public:
     delete bcc;
   }
 
+  //-------------------------------------------------------------------------------------
+  /** addEvents sorts the events into the boxes of nested grid boxes, keeping
+   * the order of the events within each box */
+  void test_addEvents_with_recursive_gridding() {
+    auto superbox = MDEventsTestHelper::makeMDGridBox<2>();
+    // The 0-th box is split further
+    TS_ASSERT_THROWS_NOTHING(superbox->splitContents(0));
+
+    std::vector<MDLeanEvent<2>> events;
+    const coord_t centers[4][2] = {
+        {0.15f, 0.05f}, {9.5f, 9.5f}, {0.05f, 0.05f}, {0.15f, 0.05f}};
+    for (size_t i = 0; i < 4; ++i)
+      events.push_back(
+          MDLeanEvent<2>(static_cast<float>(i + 1), 1.0f, centers[i]));
+    TS_ASSERT_EQUALS(superbox->addEvents(events), 0);
+    superbox->refreshCache(NULL);
+    TS_ASSERT_EQUALS(superbox->getNPoints(), 4);
+    TS_ASSERT_EQUALS(superbox->getSignal(), 10.0);
+
+    auto gb = dynamic_cast<MDGridBox<MDLeanEvent<2>, 2> *>(
+        superbox->getBoxes()[0]);
+    TS_ASSERT(gb);
+    TS_ASSERT_EQUALS(gb->getNPoints(), 3);
+    auto box0 = dynamic_cast<MDBox<MDLeanEvent<2>, 2> *>(gb->getBoxes()[0]);
+    auto box1 = dynamic_cast<MDBox<MDLeanEvent<2>, 2> *>(gb->getBoxes()[1]);
+    TS_ASSERT_EQUALS(box0->getNPoints(), 1);
+    TS_ASSERT_EQUALS(box0->getConstEvents()[0].getSignal(), 3.0);
+    box0->releaseEvents();
+    TS_ASSERT_EQUALS(box1->getNPoints(), 2);
+    TS_ASSERT_EQUALS(box1->getConstEvents()[0].getSignal(), 1.0);
+    TS_ASSERT_EQUALS(box1->getConstEvents()[1].getSignal(), 4.0);
+    box1->releaseEvents();
+    TS_ASSERT_EQUALS(superbox->getBoxes()[99]->getNPoints(), 1);
+
+    BoxController *const bcc = superbox->getBoxController();
+    delete superbox;
+    delete bcc;
+  }
+
   ////-------------------------------------------------------------------------------------
   ///** Tests add_events with limits into the vectorthat bad events are thrown
   /// out when using addEvents.
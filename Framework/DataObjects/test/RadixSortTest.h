@@ -0,0 +1,182 @@
+#ifndef MANTID_DATAOBJECTS_RADIXSORTTEST_H_
+#define MANTID_DATAOBJECTS_RADIXSORTTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidDataObjects/Events.h"
+#include "MantidDataObjects/RadixSort.h"
+
+#include <algorithm>
+#include <limits>
+#include <random>
+
+using namespace Mantid::DataObjects;
+using Mantid::Kernel::DateAndTime;
+
+class RadixSortTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static RadixSortTest *createSuite() { return new RadixSortTest(); }
+  static void destroySuite(RadixSortTest *suite) { delete suite; }
+
+  void test_double_keys_keep_order() {
+    const std::vector<double> values{
+        -std::numeric_limits<double>::max(), -1e10, -2.5, -1e-300, 0.0, 1e-300,
+        1.0, 2.5, 1e10, std::numeric_limits<double>::max()};
+    for (size_t i = 1; i < values.size(); ++i)
+      TS_ASSERT_LESS_THAN(RadixSort::key(values[i - 1]),
+                          RadixSort::key(values[i]));
+  }
+
+  void test_float_keys_keep_order() {
+    const std::vector<float> values{-1e10f, -2.5f, -1e-30f, 0.0f,
+                                    1e-30f, 1.0f,  2.5f,    1e10f};
+    for (size_t i = 1; i < values.size(); ++i)
+      TS_ASSERT_LESS_THAN(RadixSort::key(values[i - 1]),
+                          RadixSort::key(values[i]));
+  }
+
+  void test_integer_keys_keep_order() {
+    const std::vector<int64_t> values{std::numeric_limits<int64_t>::min(),
+                                      -1000, -1, 0, 1, 1000,
+                                      std::numeric_limits<int64_t>::max()};
+    for (size_t i = 1; i < values.size(); ++i)
+      TS_ASSERT_LESS_THAN(RadixSort::key(values[i - 1]),
+                          RadixSort::key(values[i]));
+  }
+
+  void test_sort_short_vector() {
+    std::vector<double> values{3.0, -1.0, 2.0, 0.5};
+    RadixSort::sort(values, [](double x) { return RadixSort::key(x); });
+    TS_ASSERT_EQUALS(values, std::vector<double>({-1.0, 0.5, 2.0, 3.0}));
+  }
+
+  void test_sort_matches_stable_sort() {
+    for (int numThreads = 1; numThreads <= 4; ++numThreads) {
+      auto events = makeEvents(10000);
+      auto expected = events;
+      std::stable_sort(expected.begin(), expected.end(),
+                       [](const TofEvent &a, const TofEvent &b) {
+                         return a.tof() < b.tof();
+                       });
+      RadixSort::sort(events, tofKey, numThreads);
+      TS_ASSERT_EQUALS(events, expected);
+    }
+  }
+
+  void test_sort_is_stable() {
+    // Only 10 distinct TOFs, so the pulse times must keep their order
+    std::vector<TofEvent> events;
+    for (int i = 0; i < 10000; ++i)
+      events.emplace_back(double((i * 7) % 10), DateAndTime(int64_t(i)));
+    RadixSort::sort(events, tofKey, 3);
+    for (size_t i = 1; i < events.size(); ++i) {
+      TS_ASSERT_LESS_THAN_EQUALS(events[i - 1].tof(), events[i].tof());
+      if (events[i - 1].tof() == events[i].tof())
+        TS_ASSERT_LESS_THAN(events[i - 1].pulseTime(), events[i].pulseTime());
+    }
+  }
+
+  void test_sort_by_two_keys() {
+    auto events = makeEvents(5000);
+    auto expected = events;
+    std::stable_sort(expected.begin(), expected.end(),
+                     [](const TofEvent &a, const TofEvent &b) {
+                       if (a.pulseTime() != b.pulseTime())
+                         return a.pulseTime() < b.pulseTime();
+                       return a.tof() < b.tof();
+                     });
+    auto pulseTimeKey = [](const TofEvent &event) {
+      return RadixSort::key(event.pulseTime().totalNanoseconds());
+    };
+    RadixSort::sort(events, pulseTimeKey, tofKey, 2);
+    TS_ASSERT_EQUALS(events, expected);
+  }
+
+  void test_sort_inside_parallel_loop() {
+    std::vector<std::vector<TofEvent>> lists(8, makeEvents(5000));
+    auto expected = lists.front();
+    std::stable_sort(expected.begin(), expected.end(),
+                     [](const TofEvent &a, const TofEvent &b) {
+                       return a.tof() < b.tof();
+                     });
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int i = 0; i < static_cast<int>(lists.size()); ++i)
+      RadixSort::sort(lists[i], tofKey, 4);
+    for (const auto &events : lists)
+      TS_ASSERT_EQUALS(events, expected);
+  }
+
+  void test_sort_all_equal_keys() {
+    std::vector<TofEvent> events;
+    for (int i = 0; i < 10000; ++i)
+      events.emplace_back(5.0, DateAndTime(int64_t(i)));
+    const auto expected = events;
+    RadixSort::sort(events, tofKey, 2);
+    TS_ASSERT_EQUALS(events, expected);
+  }
+
+private:
+  static uint64_t tofKey(const TofEvent &event) {
+    return RadixSort::key(event.tof());
+  }
+
+  /// Events with random TOFs and a few distinct pulse times
+  std::vector<TofEvent> makeEvents(const size_t numEvents) {
+    std::mt19937 generator(12345);
+    std::uniform_real_distribution<double> tofs(-100.0, 20000.0);
+    std::uniform_int_distribution<int64_t> pulses(0, 50);
+    std::vector<TofEvent> events;
+    events.reserve(numEvents);
+    for (size_t i = 0; i < numEvents; ++i)
+      events.emplace_back(tofs(generator),
+                          DateAndTime(pulses(generator) * 1000000));
+    return events;
+  }
+};
+
+class RadixSortTestPerformance : public CxxTest::TestSuite {
+public:
+  static RadixSortTestPerformance *createSuite() {
+    return new RadixSortTestPerformance();
+  }
+  static void destroySuite(RadixSortTestPerformance *suite) { delete suite; }
+
+  RadixSortTestPerformance() {
+    std::mt19937 generator(12345);
+    std::uniform_real_distribution<double> tofs(0.0, 20000.0);
+    const size_t numEvents = 10000000;
+    m_events.reserve(numEvents);
+    for (size_t i = 0; i < numEvents; ++i)
+      m_events.emplace_back(tofs(generator),
+                            DateAndTime(static_cast<int64_t>(i / 1000)));
+  }
+
+  void test_sort_tof() {
+    auto events = m_events;
+    RadixSort::sort(events, tofKey);
+  }
+
+  void test_sort_tof_4_threads() {
+    auto events = m_events;
+    RadixSort::sort(events, tofKey, 4);
+  }
+
+  void test_std_sort_tof() {
+    auto events = m_events;
+    std::sort(events.begin(), events.end(),
+              [](const TofEvent &a, const TofEvent &b) {
+                return a.tof() < b.tof();
+              });
+  }
+
+private:
+  static uint64_t tofKey(const TofEvent &event) {
+    return RadixSort::key(event.tof());
+  }
+
+  std::vector<TofEvent> m_events;
+};
+
+#endif /* MANTID_DATAOBJECTS_RADIXSORTTEST_H_ */
@@ -194,6 +194,17 @@ public:
                      nhist * (nbins + 1) * sizeof(double));
   }
 
+  void test_getMemorySize_counts_shared_data_once() {
+    ws = Create2DWorkspaceBinned(nhist, nbins);
+    // X, Y and E are all shared by the spectra
+    const size_t sharedSize = ws->getMemorySize();
+    for (int i = 0; i < nhist; i++) {
+      ws->dataY(i)[0] += 1; // Each spectrum gets its own Y
+    }
+    TS_ASSERT_EQUALS(ws->getMemorySize(),
+                     sharedSize + (nhist - 1) * nbins * sizeof(double));
+  }
+
   /** Refs #3003: very odd bug when getting detector in parallel only!
    * This does not reproduce it :( */
   void test_getDetector_parallel() {
@@ -12,6 +12,8 @@
 
 #include "tbb/concurrent_unordered_map.h"
 
+#include <array>
+#include <atomic>
 #include <vector>
 #include <typeinfo>
 
@@ -72,8 +74,17 @@ public:
   /// Parameter map iterator typedef
   typedef tbb::concurrent_unordered_multimap<
       ComponentID, boost::shared_ptr<Parameter>>::const_iterator pmap_cit;
+  /// Parameters that are read whenever the position of a component is
+  /// computed. They are also stored by component under an integer key, so
+  /// looking them up with getBuiltin() needs no comparisons of names.
+  enum class Builtin { Position, Rotation, Scale, ScaleX, ScaleY };
+
   /// Default constructor
   ParameterMap();
+  /// Copy constructor
+  ParameterMap(const ParameterMap &other);
+  /// Copy assignment
+  ParameterMap &operator=(const ParameterMap &other);
   /// Returns true if the map is empty, false otherwise
   inline bool empty() const { return m_map.empty(); }
   /// Return the size of the map
@@ -105,13 +116,26 @@ public:
   /// Clears the map
   inline void clear() {
     m_map.clear();
+    m_builtins.clear();
+    ++m_maskGeneration;
     clearPositionSensitiveCaches();
   }
+  /// Returns a number that changes whenever a parameter other than the
+  /// "masked" flag is added, changed or removed, so that users can tell
+  /// whether positions they computed are still valid
+  size_t generation() const { return m_generation.load(); }
+  /// Returns a number that changes whenever a "masked" flag is added, changed
+  /// or removed
+  size_t maskGeneration() const { return m_maskGeneration.load(); }
   /// method swaps two parameter maps contents  each other. All caches contents
   /// is nullified (TO DO: it can be efficiently swapped too)
   void swap(ParameterMap &other) {
     m_map.swap(other.m_map);
+    m_builtins.swap(other.m_builtins);
+    ++m_maskGeneration;
+    ++other.m_maskGeneration;
     clearPositionSensitiveCaches();
+    other.clearPositionSensitiveCaches();
   }
   /// Clear any parameters with the given name
   void clearParametersByName(const std::string &name);
@@ -217,6 +241,8 @@ public:
   /// Get a parameter with a given name and type (c-string version)
   boost::shared_ptr<Parameter> get(const IComponent *comp, const char *name,
                                    const char *type = "") const;
+  /// Get a built-in parameter without looking it up by name
+  Parameter *getBuiltin(const IComponent *comp, Builtin which) const;
   /// Finds the parameter in the map via the parameter type.
   boost::shared_ptr<Parameter> getByType(const IComponent *comp,
                                          const std::string &type) const;
@@ -350,17 +376,42 @@ private:
   component_map_cit positionOf(const IComponent *comp, const char *name,
                                const char *type) const;
 
+  /// Number of values of Builtin
+  static const size_t NUM_BUILTINS = 5;
+  /// The built-in parameters of one component, indexed by Builtin
+  typedef std::array<boost::shared_ptr<Parameter>, NUM_BUILTINS>
+      builtin_parameters;
+  /// Index of the built-in parameter with the given name, or NUM_BUILTINS
+  static size_t builtinIndex(const char *name);
+  /// Keep the built-in parameters of a component up to date after an add
+  void setBuiltin(const ComponentID id,
+                  const boost::shared_ptr<Parameter> &par);
+
   /// internal list of parameter files loaded
   std::vector<std::string> m_parameterFileNames;
 
   /// internal parameter map instance
   pmap m_map;
+  /// built-in parameters ("pos", "rot", ...) of each component, which are in
+  /// m_map as well
+  tbb::concurrent_unordered_map<ComponentID, builtin_parameters> m_builtins;
   /// internal cache map instance for cached position values
   mutable Kernel::Cache<const ComponentID, Kernel::V3D> m_cacheLocMap;
   /// internal cache map instance for cached rotation values
   mutable Kernel::Cache<const ComponentID, Kernel::Quat> m_cacheRotMap;
   /// internal cache map for cached bounding boxes
   mutable Kernel::Cache<const ComponentID, BoundingBox> m_boundingBoxMap;
+  /// incremented by changes of the parameters, @see generation()
+  std::atomic<size_t> m_generation;
+  /// incremented by changes of "masked" flags, @see maskGeneration()
+  std::atomic<size_t> m_maskGeneration;
+  /// Records a change of the parameter with the given name
+  void parameterChanged(const std::string &name) {
+    if (name == "masked")
+      ++m_maskGeneration;
+    else
+      ++m_generation;
+  }
 };
 
 /// ParameterMap shared pointer typedef
@@ -287,9 +287,9 @@ void Component::rotate(double angle, const V3D &axis) {
 */
 const V3D Component::getRelativePos() const {
   if (m_map) {
-    if (m_map->contains(m_base, "pos")) {
-      return m_map->get(m_base, "pos")->value<V3D>();
-    } else
+    if (auto par = m_map->getBuiltin(m_base, ParameterMap::Builtin::Position))
+      return par->value<V3D>();
+    else
       return m_base->m_pos;
   } else
     return m_pos;
@@ -302,8 +302,7 @@ const V3D Component::getRelativePos() const {
 */
 V3D Component::getScaleFactor() const {
   if (m_map) {
-    Parameter_sptr par = m_map->get(m_base, "sca");
-    if (par) {
+    if (auto par = m_map->getBuiltin(m_base, ParameterMap::Builtin::Scale)) {
       return par->value<V3D>();
     }
   }
@@ -355,9 +354,8 @@ V3D Component::getPos() const {
 */
 const Quat &Component::getRelativeRot() const {
   if (m_map) {
-    if (m_map->contains(m_base, "rot")) {
-      return m_map->get(m_base, "rot")->value<Quat>();
-    }
+    if (auto par = m_map->getBuiltin(m_base, ParameterMap::Builtin::Rotation))
+      return par->value<Quat>();
     return m_base->m_rot;
   } else
     return m_rot;
@@ -36,6 +36,10 @@ const std::string STRING_PARAM_NAME = "string";
 const std::string V3D_PARAM_NAME = "V3D";
 const std::string QUAT_PARAM_NAME = "Quat";
 
+// names of the built-in parameters, in the order of ParameterMap::Builtin
+const char *const BUILTIN_PARAM_NAMES[] = {"pos", "rot", "sca", "scalex",
+                                           "scaley"};
+
 // static logger reference
 Kernel::Logger g_log("ParameterMap");
 }
@@ -45,7 +49,40 @@ Kernel::Logger g_log("ParameterMap");
 /**
  * Default constructor
  */
-ParameterMap::ParameterMap() : m_parameterFileNames(), m_map() {}
+ParameterMap::ParameterMap()
+    : m_parameterFileNames(), m_map(), m_builtins(), m_generation(0),
+      m_maskGeneration(0) {}
+
+/**
+ * Copy constructor
+ * @param other :: The map to copy
+ */
+ParameterMap::ParameterMap(const ParameterMap &other)
+    : m_parameterFileNames(other.m_parameterFileNames), m_map(other.m_map),
+      m_builtins(other.m_builtins), m_cacheLocMap(other.m_cacheLocMap),
+      m_cacheRotMap(other.m_cacheRotMap),
+      m_boundingBoxMap(other.m_boundingBoxMap),
+      m_generation(other.m_generation.load()),
+      m_maskGeneration(other.m_maskGeneration.load()) {}
+
+/**
+ * Copy assignment
+ * @param other :: The map to copy
+ * @return this map
+ */
+ParameterMap &ParameterMap::operator=(const ParameterMap &other) {
+  if (this != &other) {
+    m_parameterFileNames = other.m_parameterFileNames;
+    m_map = other.m_map;
+    m_builtins = other.m_builtins;
+    m_cacheLocMap = other.m_cacheLocMap;
+    m_cacheRotMap = other.m_cacheRotMap;
+    m_boundingBoxMap = other.m_boundingBoxMap;
+    ++m_generation;
+    ++m_maskGeneration;
+  }
+  return *this;
+}
 
 /**
 * Return string to be inserted into the parameter map
@@ -263,13 +300,17 @@ const std::string ParameterMap::diff(const ParameterMap &rhs,
  */
 void ParameterMap::clearParametersByName(const std::string &name) {
   // Key is component ID so have to search through whole lot
+  const size_t builtin = builtinIndex(name.c_str());
   for (auto itr = m_map.begin(); itr != m_map.end();) {
     if (itr->second->name() == name) {
+      if (builtin < NUM_BUILTINS)
+        m_builtins[itr->first][builtin].reset();
       PARALLEL_CRITICAL(unsafe_erase) { itr = m_map.unsafe_erase(itr); }
     } else {
       ++itr;
     }
   }
+  parameterChanged(name);
   // Check if the caches need invalidating
   if (name == pos() || name == rot())
     clearPositionSensitiveCaches();
@@ -284,15 +325,19 @@ void ParameterMap::clearParametersByName(const std::string &name,
                                          const IComponent *comp) {
   if (!m_map.empty()) {
     const ComponentID id = comp->getComponentID();
+    const size_t builtin = builtinIndex(name.c_str());
     auto itrs = m_map.equal_range(id);
     for (auto it = itrs.first; it != itrs.second;) {
       if (it->second->name() == name) {
+        if (builtin < NUM_BUILTINS)
+          m_builtins[id][builtin].reset();
         PARALLEL_CRITICAL(unsafe_erase) { it = m_map.unsafe_erase(it); }
       } else {
         ++it;
       }
     }
 
+    parameterChanged(name);
     // Check if the caches need invalidating
     if (name == pos() || name == rot())
       clearPositionSensitiveCaches();
@@ -360,6 +405,8 @@ void ParameterMap::add(const IComponent *comp,
     m_map.insert(std::make_pair(comp->getComponentID(), par));
 #endif
   }
+  setBuiltin(comp->getComponentID(), par);
+  parameterChanged(par->name());
 }
 
 /** Create or adjust "pos" parameter for a component
@@ -741,6 +788,22 @@ boost::shared_ptr<Parameter> ParameterMap::get(const IComponent *comp,
   return result;
 }
 
+/** Return a built-in parameter of a component. This is the same parameter as
+ * get() returns for its name, but it is found without comparing names.
+ * @param comp :: Component to which parameter is related
+ * @param which :: The parameter
+ * @returns The parameter, or NULL if the component does not have it
+ */
+Parameter *ParameterMap::getBuiltin(const IComponent *comp,
+                                    Builtin which) const {
+  if (!comp || m_builtins.empty())
+    return nullptr;
+  auto itr = m_builtins.find(comp->getComponentID());
+  if (itr == m_builtins.end())
+    return nullptr;
+  return boost::atomic_load(&itr->second[static_cast<size_t>(which)]).get();
+}
+
 /**Return an iterator pointing to a named parameter of a given type.
  * @param comp :: Component to which parameter is related
  * @param name :: Parameter name
@@ -957,10 +1020,37 @@ std::string ParameterMap::asString() const {
   return out.str();
 }
 
+/**
+ * @param name :: The name of a parameter
+ * @returns the index of the built-in parameter with the name, or NUM_BUILTINS
+ * if it is not built-in. Names are compared ignoring case, as in get().
+ */
+size_t ParameterMap::builtinIndex(const char *name) {
+  for (size_t i = 0; i < NUM_BUILTINS; ++i) {
+    if (strcasecmp(name, BUILTIN_PARAM_NAMES[i]) == 0)
+      return i;
+  }
+  return NUM_BUILTINS;
+}
+
+/**
+ * Store a parameter that has been added to the map with the built-in
+ * parameters of its component, if it is one of them
+ * @param id :: The component
+ * @param par :: The parameter
+ */
+void ParameterMap::setBuiltin(const ComponentID id,
+                              const boost::shared_ptr<Parameter> &par) {
+  const size_t index = builtinIndex(par->nameAsCString());
+  if (index < NUM_BUILTINS)
+    boost::atomic_store(&m_builtins[id][index], par);
+}
+
 /**
  * Clears the location, rotation & bounding box caches
  */
 void ParameterMap::clearPositionSensitiveCaches() {
+  ++m_generation;
   m_cacheLocMap.clear();
   m_cacheRotMap.clear();
   m_boundingBoxMap.clear();
@@ -1031,6 +1121,7 @@ void ParameterMap::copyFromParameterMap(const IComponent *oldComp,
   auto oldParameterNames = oldPMap->names(oldComp);
   for (const auto &oldParameterName : oldParameterNames) {
     Parameter_sptr thisParameter = oldPMap->get(oldComp, oldParameterName);
+    setBuiltin(newComp->getComponentID(), thisParameter);
 // Insert the fetched parameter in the m_map
 #if TBB_VERSION_MAJOR >= 4 && TBB_VERSION_MINOR >= 4 && !CLANG_ON_LINUX
     m_map.emplace(newComp->getComponentID(), std::move(thisParameter));
@@ -1039,6 +1130,8 @@ void ParameterMap::copyFromParameterMap(const IComponent *oldComp,
         std::make_pair(newComp->getComponentID(), std::move(thisParameter)));
 #endif
   }
+  ++m_generation;
+  ++m_maskGeneration;
 }
 
 //--------------------------------------------------------------------------------------------
@@ -210,8 +210,9 @@ int RectangularDetector::ypixels() const {
 double RectangularDetector::xstep() const {
   if (m_map) {
     double scaling = 1.0;
-    if (m_map->contains(m_rectBase, "scalex"))
-      scaling = m_map->get(m_rectBase, "scalex")->value<double>();
+    if (auto par = m_map->getBuiltin(m_rectBase,
+                                     ParameterMap::Builtin::ScaleX))
+      scaling = par->value<double>();
     return m_rectBase->m_xstep * scaling;
   } else
     return this->m_xstep;
@@ -222,8 +223,9 @@ double RectangularDetector::xstep() const {
 double RectangularDetector::ystep() const {
   if (m_map) {
     double scaling = 1.0;
-    if (m_map->contains(m_rectBase, "scaley"))
-      scaling = m_map->get(m_rectBase, "scaley")->value<double>();
+    if (auto par = m_map->getBuiltin(m_rectBase,
+                                     ParameterMap::Builtin::ScaleY))
+      scaling = par->value<double>();
     return m_rectBase->m_ystep * scaling;
   } else
     return this->m_ystep;
@@ -234,8 +236,9 @@ double RectangularDetector::ystep() const {
 double RectangularDetector::xstart() const {
   if (m_map) {
     double scaling = 1.0;
-    if (m_map->contains(m_rectBase, "scalex"))
-      scaling = m_map->get(m_rectBase, "scalex")->value<double>();
+    if (auto par = m_map->getBuiltin(m_rectBase,
+                                     ParameterMap::Builtin::ScaleX))
+      scaling = par->value<double>();
     return m_rectBase->m_xstart * scaling;
   } else
     return this->m_xstart;
@@ -246,8 +249,9 @@ double RectangularDetector::xstart() const {
 double RectangularDetector::ystart() const {
   if (m_map) {
     double scaling = 1.0;
-    if (m_map->contains(m_rectBase, "scaley"))
-      scaling = m_map->get(m_rectBase, "scaley")->value<double>();
+    if (auto par = m_map->getBuiltin(m_rectBase,
+                                     ParameterMap::Builtin::ScaleY))
+      scaling = par->value<double>();
     return m_rectBase->m_ystart * scaling;
   } else
     return this->m_ystart;
@@ -258,8 +262,9 @@ double RectangularDetector::ystart() const {
 double RectangularDetector::xsize() const {
   if (m_map) {
     double scaling = 1.0;
-    if (m_map->contains(m_rectBase, "scalex"))
-      scaling = m_map->get(m_rectBase, "scalex")->value<double>();
+    if (auto par = m_map->getBuiltin(m_rectBase,
+                                     ParameterMap::Builtin::ScaleX))
+      scaling = par->value<double>();
     return m_rectBase->m_xsize * scaling;
   } else
     return this->m_xsize;
@@ -270,8 +275,9 @@ double RectangularDetector::xsize() const {
 double RectangularDetector::ysize() const {
   if (m_map) {
     double scaling = 1.0;
-    if (m_map->contains(m_rectBase, "scaley"))
-      scaling = m_map->get(m_rectBase, "scaley")->value<double>();
+    if (auto par = m_map->getBuiltin(m_rectBase,
+                                     ParameterMap::Builtin::ScaleY))
+      scaling = par->value<double>();
     return m_rectBase->m_ysize * scaling;
   } else
     return this->m_ysize;
@@ -325,11 +331,13 @@ int RectangularDetector::idstep() const {
 V3D RectangularDetector::getRelativePosAtXY(int x, int y) const {
   if (m_map) {
     double scalex = 1.0;
-    if (m_map->contains(m_rectBase, "scalex"))
-      scalex = m_map->get(m_rectBase, "scalex")->value<double>();
+    if (auto par = m_map->getBuiltin(m_rectBase,
+                                     ParameterMap::Builtin::ScaleX))
+      scalex = par->value<double>();
     double scaley = 1.0;
-    if (m_map->contains(m_rectBase, "scaley"))
-      scaley = m_map->get(m_rectBase, "scaley")->value<double>();
+    if (auto par = m_map->getBuiltin(m_rectBase,
+                                     ParameterMap::Builtin::ScaleY))
+      scaley = par->value<double>();
     return m_rectBase->getRelativePosAtXY(x, y) * V3D(scalex, scaley, 1.0);
   } else
     return V3D(m_xstart + m_xstep * x, m_ystart + m_ystep * y, 0);
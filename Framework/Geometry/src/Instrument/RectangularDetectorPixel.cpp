@@ -52,9 +52,11 @@ const Kernel::V3D RectangularDetectorPixel::getRelativePos() const {
   // so the xstep() etc. returned are the UNSCALED one.
   if (m_map) {
     // Apply the scaling factors
-    if (auto scalex = m_map->get(m_panel, "scalex"))
+    if (auto scalex =
+            m_map->getBuiltin(m_panel, ParameterMap::Builtin::ScaleX))
       x *= scalex->value<double>();
-    if (auto scaley = m_map->get(m_panel, "scaley"))
+    if (auto scaley =
+            m_map->getBuiltin(m_panel, ParameterMap::Builtin::ScaleY))
       y *= scaley->value<double>();
   }
   return V3D(x, y, 0);
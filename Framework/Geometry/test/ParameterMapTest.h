@@ -383,6 +383,81 @@ public:
     TS_ASSERT_EQUALS(origValue, origParameter->value<Quat>());
   }
 
+  void test_Generation_Changes_With_Parameters() {
+    ParameterMap pmap;
+    auto generation = pmap.generation();
+    auto maskGeneration = pmap.maskGeneration();
+
+    pmap.addDouble(m_testInstrument.get(), "testDouble", 1.0);
+    TS_ASSERT_DIFFERS(pmap.generation(), generation);
+    TS_ASSERT_EQUALS(pmap.maskGeneration(), maskGeneration);
+    generation = pmap.generation();
+
+    // Masking does not change the generation of other parameters
+    IComponent_sptr comp = m_testInstrument->getChild(0);
+    pmap.addBool(comp.get(), "masked", true);
+    TS_ASSERT_EQUALS(pmap.generation(), generation);
+    TS_ASSERT_DIFFERS(pmap.maskGeneration(), maskGeneration);
+    maskGeneration = pmap.maskGeneration();
+
+    pmap.addV3D(comp.get(), ParameterMap::pos(), Mantid::Kernel::V3D(1, 2, 3));
+    TS_ASSERT_DIFFERS(pmap.generation(), generation);
+    generation = pmap.generation();
+
+    pmap.clearParametersByName("masked");
+    TS_ASSERT_EQUALS(pmap.generation(), generation);
+    TS_ASSERT_DIFFERS(pmap.maskGeneration(), maskGeneration);
+    maskGeneration = pmap.maskGeneration();
+
+    pmap.clear();
+    TS_ASSERT_DIFFERS(pmap.generation(), generation);
+    TS_ASSERT_DIFFERS(pmap.maskGeneration(), maskGeneration);
+  }
+
+  void test_getBuiltin_Follows_Named_Parameters() {
+    using Mantid::Kernel::V3D;
+    ParameterMap pmap;
+    IComponent_sptr comp = m_testInstrument->getChild(0);
+    const auto position = ParameterMap::Builtin::Position;
+    TS_ASSERT(!pmap.getBuiltin(comp.get(), position));
+
+    pmap.addV3D(comp.get(), ParameterMap::pos(), V3D(1, 2, 3));
+    pmap.addDouble(comp.get(), "ScaleX", 2.0);
+    pmap.addDouble(comp.get(), "notBuiltin", 3.0);
+    auto pos = pmap.getBuiltin(comp.get(), position);
+    TS_ASSERT(pos);
+    TS_ASSERT_EQUALS(pos, pmap.get(comp.get(), ParameterMap::pos()).get());
+    TS_ASSERT_EQUALS(V3D(1, 2, 3), pos->value<V3D>());
+    // Names of built-in parameters are not case sensitive, as in get()
+    auto scalex = pmap.getBuiltin(comp.get(), ParameterMap::Builtin::ScaleX);
+    TS_ASSERT(scalex);
+    TS_ASSERT_EQUALS(2.0, scalex->value<double>());
+    TS_ASSERT(!pmap.getBuiltin(comp.get(), ParameterMap::Builtin::Rotation));
+    TS_ASSERT(!pmap.getBuiltin(m_testInstrument.get(), position));
+
+    // Replacing a parameter replaces the built-in one
+    pmap.addV3D(comp.get(), ParameterMap::pos(), V3D(4, 5, 6));
+    TS_ASSERT_EQUALS(V3D(4, 5, 6),
+                     pmap.getBuiltin(comp.get(), position)->value<V3D>());
+
+    // Copies have their own built-in parameters
+    ParameterMap copy(pmap);
+    copy.addV3D(comp.get(), ParameterMap::pos(), V3D(7, 8, 9));
+    TS_ASSERT_EQUALS(V3D(7, 8, 9),
+                     copy.getBuiltin(comp.get(), position)->value<V3D>());
+    TS_ASSERT_EQUALS(V3D(4, 5, 6),
+                     pmap.getBuiltin(comp.get(), position)->value<V3D>());
+
+    pmap.clearParametersByName(ParameterMap::pos());
+    TS_ASSERT(!pmap.getBuiltin(comp.get(), position));
+    TS_ASSERT(pmap.getBuiltin(comp.get(), ParameterMap::Builtin::ScaleX));
+    pmap.clearParametersByName("ScaleX", comp.get());
+    TS_ASSERT(!pmap.getBuiltin(comp.get(), ParameterMap::Builtin::ScaleX));
+    TS_ASSERT(copy.getBuiltin(comp.get(), position));
+    copy.clear();
+    TS_ASSERT(!copy.getBuiltin(comp.get(), position));
+  }
+
   void testMap_Contains_Newly_Added_Value_For_Correct_Component() {
     ParameterMap pmap;
     const std::string name("NewValue");
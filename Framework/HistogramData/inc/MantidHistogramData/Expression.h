@@ -0,0 +1,397 @@
+#ifndef MANTID_HISTOGRAMDATA_EXPRESSION_H_
+#define MANTID_HISTOGRAMDATA_EXPRESSION_H_
+
+#include "MantidHistogramData/DllConfig.h"
+#include "MantidHistogramData/Histogram.h"
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+namespace Mantid {
+namespace HistogramData {
+
+/** This header provides lazily evaluated element-wise arithmetic for Counts,
+  Frequencies and the other histogram data types, with propagation of
+  uncertainties.
+
+  Operands are wrapped with lazy() and combined with +, -, * and / into an
+  expression object, which does not allocate or compute anything. The
+  expression is evaluated by assign(), in a single loop over the bins, without
+  temporary vectors:
+
+  @code
+  // y = (counts - background) * scale / norm, with variances.
+  assign(result, resultVariances,
+         (lazy(counts, variances) - lazy(bkg, bkgVariances)) * scale /
+             lazy(norm, normVariances));
+  @endcode
+
+  Variances are propagated as in HistogramMath.h, assuming that the operands
+  are uncorrelated. Operands given without uncertainties and scalars have zero
+  variance. Since the output of each bin depends only on the same bin of the
+  inputs, the output may be one of the operands.
+
+  Expressions refer to the data of their operands, they must not outlive
+  them.
+
+  Copyright &copy; 2016 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+namespace detail {
+
+/// Size of scalar operands, which are compatible with any length.
+constexpr size_t anyLength = std::numeric_limits<size_t>::max();
+
+/// Base class of all expression nodes, used to constrain the operators.
+template <class E> struct Expression {
+  const E &derived() const { return static_cast<const E &>(*this); }
+};
+
+/// Leaf of an expression: values without uncertainties.
+class Values : public Expression<Values> {
+public:
+  explicit Values(const std::vector<double> &values)
+      : m_values(values.data()), m_size(values.size()) {}
+  size_t size() const { return m_size; }
+  double value(const size_t i) const { return m_values[i]; }
+  double variance(const size_t) const { return 0.0; }
+
+private:
+  const double *m_values;
+  size_t m_size;
+};
+
+/// Leaf of an expression: values with variances.
+class ValuesAndVariances : public Expression<ValuesAndVariances> {
+public:
+  ValuesAndVariances(const std::vector<double> &values,
+                     const std::vector<double> &variances)
+      : m_values(values.data()), m_variances(variances.data()),
+        m_size(values.size()) {
+    if (variances.size() != m_size)
+      throw std::runtime_error(
+          "Invalid expression: values and uncertainties must have same length");
+  }
+  size_t size() const { return m_size; }
+  double value(const size_t i) const { return m_values[i]; }
+  double variance(const size_t i) const { return m_variances[i]; }
+
+private:
+  const double *m_values;
+  const double *m_variances;
+  size_t m_size;
+};
+
+/// Leaf of an expression: values with standard deviations.
+class ValuesAndStandardDeviations
+    : public Expression<ValuesAndStandardDeviations> {
+public:
+  ValuesAndStandardDeviations(const std::vector<double> &values,
+                              const std::vector<double> &sigmas)
+      : m_values(values.data()), m_sigmas(sigmas.data()),
+        m_size(values.size()) {
+    if (sigmas.size() != m_size)
+      throw std::runtime_error(
+          "Invalid expression: values and uncertainties must have same length");
+  }
+  size_t size() const { return m_size; }
+  double value(const size_t i) const { return m_values[i]; }
+  double variance(const size_t i) const { return m_sigmas[i] * m_sigmas[i]; }
+
+private:
+  const double *m_values;
+  const double *m_sigmas;
+  size_t m_size;
+};
+
+/// Leaf of an expression: a constant without uncertainty.
+class Scalar : public Expression<Scalar> {
+public:
+  explicit Scalar(const double value) : m_value(value) {}
+  size_t size() const { return anyLength; }
+  double value(const size_t) const { return m_value; }
+  double variance(const size_t) const { return 0.0; }
+
+private:
+  const double m_value;
+};
+
+/// Element-wise binary operation. Op provides the value and variance of the
+/// result for the values and variances of the operands.
+template <class Op, class L, class R>
+class Binary : public Expression<Binary<Op, L, R>> {
+public:
+  Binary(const L &lhs, const R &rhs)
+      : m_lhs(lhs), m_rhs(rhs), m_size(commonSize(lhs.size(), rhs.size())) {}
+  size_t size() const { return m_size; }
+  double value(const size_t i) const {
+    return Op::value(m_lhs.value(i), m_rhs.value(i));
+  }
+  double variance(const size_t i) const {
+    return Op::variance(m_lhs.value(i), m_lhs.variance(i), m_rhs.value(i),
+                        m_rhs.variance(i));
+  }
+
+private:
+  static size_t commonSize(const size_t lhs, const size_t rhs) {
+    if (lhs == anyLength || lhs == rhs)
+      return rhs;
+    if (rhs == anyLength)
+      return lhs;
+    throw std::runtime_error(
+        "Invalid expression: operands must have same length");
+  }
+
+  // Leaves and nodes are small and are stored by value, so temporary
+  // sub-expressions do not dangle.
+  const L m_lhs;
+  const R m_rhs;
+  const size_t m_size;
+};
+
+struct Add {
+  static double value(const double a, const double b) { return a + b; }
+  static double variance(const double, const double va, const double,
+                         const double vb) {
+    return va + vb;
+  }
+};
+
+struct Subtract {
+  static double value(const double a, const double b) { return a - b; }
+  static double variance(const double, const double va, const double,
+                         const double vb) {
+    return va + vb;
+  }
+};
+
+struct Multiply {
+  static double value(const double a, const double b) { return a * b; }
+  static double variance(const double a, const double va, const double b,
+                         const double vb) {
+    return va * b * b + vb * a * a;
+  }
+};
+
+struct Divide {
+  static double value(const double a, const double b) { return a / b; }
+  static double variance(const double a, const double va, const double b,
+                         const double vb) {
+    const double invB2 = 1.0 / (b * b);
+    return (va + vb * a * a * invB2) * invB2;
+  }
+};
+
+/// Evaluates the values of expr into values, discarding uncertainties.
+template <class E, class V>
+void evaluate(const Expression<E> &expr, V &values) {
+  const auto &e = expr.derived();
+  const size_t size = e.size();
+  if (size != values.size())
+    throw std::runtime_error(
+        "Invalid operation: Cannot assign expression, lengths must match");
+  for (size_t i = 0; i < size; ++i)
+    values[i] = e.value(i);
+}
+
+/// Evaluates expr into values and uncertainties. The uncertainty is computed
+/// from the variance by toUncertainty.
+template <class E, class V, class U, class F>
+void evaluate(const Expression<E> &expr, V &values, U &uncertainties,
+              F toUncertainty) {
+  const auto &e = expr.derived();
+  const size_t size = e.size();
+  if (size != values.size() || size != uncertainties.size())
+    throw std::runtime_error(
+        "Invalid operation: Cannot assign expression, lengths must match");
+  for (size_t i = 0; i < size; ++i) {
+    // Compute both before writing, the output may also be an operand.
+    const double value = e.value(i);
+    const double variance = e.variance(i);
+    values[i] = value;
+    uncertainties[i] = toUncertainty(variance);
+  }
+}
+
+inline double identity(const double variance) { return variance; }
+inline double squareRoot(const double variance) { return std::sqrt(variance); }
+
+// The operators are in namespace detail, such that they are found by
+// argument-dependent lookup for the expression types.
+#define MANTID_HISTOGRAMDATA_EXPRESSION_OPERATOR(OP, NAME)                     \
+  template <class L, class R>                                                  \
+  Binary<NAME, L, R> operator OP(const Expression<L> &lhs,                     \
+                                 const Expression<R> &rhs) {                   \
+    return {lhs.derived(), rhs.derived()};                                     \
+  }                                                                            \
+  template <class L>                                                           \
+  Binary<NAME, L, Scalar> operator OP(const Expression<L> &lhs,                \
+                                      const double rhs) {                      \
+    return {lhs.derived(), Scalar(rhs)};                                       \
+  }                                                                            \
+  template <class R>                                                           \
+  Binary<NAME, Scalar, R> operator OP(const double lhs,                        \
+                                      const Expression<R> &rhs) {              \
+    return {Scalar(lhs), rhs.derived()};                                       \
+  }
+
+MANTID_HISTOGRAMDATA_EXPRESSION_OPERATOR(+, Add)
+MANTID_HISTOGRAMDATA_EXPRESSION_OPERATOR(-, Subtract)
+MANTID_HISTOGRAMDATA_EXPRESSION_OPERATOR(*, Multiply)
+MANTID_HISTOGRAMDATA_EXPRESSION_OPERATOR(/, Divide)
+
+#undef MANTID_HISTOGRAMDATA_EXPRESSION_OPERATOR
+
+/// Initializes a NULL output with the length of the expression.
+template <class T> void allocate(T &data, const size_t size) {
+  if (!data && size != anyLength)
+    data = T(size);
+}
+} // namespace detail
+
+/// Returns an expression operand for values without uncertainties.
+template <class T>
+detail::Values lazy(const detail::VectorOf<T, HistogramY> &values) {
+  return detail::Values(values.rawData());
+}
+
+/// Returns an expression operand for the values of a HistogramY.
+inline detail::Values lazy(const HistogramY &values) {
+  return detail::Values(values.rawData());
+}
+
+/// Returns an expression operand for Y data with uncertainties.
+inline detail::ValuesAndStandardDeviations
+lazy(const HistogramY &values, const HistogramE &uncertainties) {
+  return {values.rawData(), uncertainties.rawData()};
+}
+
+/// Returns an expression operand for counts with variances.
+inline detail::ValuesAndVariances lazy(const Counts &counts,
+                                       const CountVariances &variances) {
+  return {counts.rawData(), variances.rawData()};
+}
+
+/// Returns an expression operand for counts with standard deviations.
+inline detail::ValuesAndStandardDeviations
+lazy(const Counts &counts, const CountStandardDeviations &sigmas) {
+  return {counts.rawData(), sigmas.rawData()};
+}
+
+/// Returns an expression operand for frequencies with variances.
+inline detail::ValuesAndVariances lazy(const Frequencies &frequencies,
+                                       const FrequencyVariances &variances) {
+  return {frequencies.rawData(), variances.rawData()};
+}
+
+/// Returns an expression operand for frequencies with standard deviations.
+inline detail::ValuesAndStandardDeviations
+lazy(const Frequencies &frequencies,
+     const FrequencyStandardDeviations &sigmas) {
+  return {frequencies.rawData(), sigmas.rawData()};
+}
+
+/// Returns an expression operand for the Y data and uncertainties of a
+/// Histogram. The histogram must have uncertainties.
+inline detail::ValuesAndStandardDeviations lazy(const Histogram &histogram) {
+  if (!histogram.sharedE())
+    throw std::runtime_error(
+        "Invalid expression: Histogram has no uncertainties");
+  return {histogram.y().rawData(), histogram.e().rawData()};
+}
+
+/// Evaluates expr into values, discarding uncertainties. A NULL output is
+/// initialized with the length of the expression.
+template <class T, class E>
+void assign(detail::VectorOf<T, HistogramY> &values,
+            const detail::Expression<E> &expr) {
+  detail::allocate(static_cast<T &>(values), expr.derived().size());
+  detail::evaluate(expr, values.mutableRawData());
+}
+
+/// Evaluates expr into Y data and uncertainties.
+template <class E>
+void assign(HistogramY &values, HistogramE &uncertainties,
+            const detail::Expression<E> &expr) {
+  detail::evaluate(expr, values, uncertainties, detail::squareRoot);
+}
+
+/// Evaluates expr into counts and their variances.
+template <class E>
+void assign(Counts &counts, CountVariances &variances,
+            const detail::Expression<E> &expr) {
+  detail::allocate(counts, expr.derived().size());
+  detail::allocate(variances, expr.derived().size());
+  detail::evaluate(expr, counts.mutableRawData(), variances.mutableRawData(),
+                   detail::identity);
+}
+
+/// Evaluates expr into counts and their standard deviations.
+template <class E>
+void assign(Counts &counts, CountStandardDeviations &sigmas,
+            const detail::Expression<E> &expr) {
+  detail::allocate(counts, expr.derived().size());
+  detail::allocate(sigmas, expr.derived().size());
+  detail::evaluate(expr, counts.mutableRawData(), sigmas.mutableRawData(),
+                   detail::squareRoot);
+}
+
+/// Evaluates expr into frequencies and their variances.
+template <class E>
+void assign(Frequencies &frequencies, FrequencyVariances &variances,
+            const detail::Expression<E> &expr) {
+  detail::allocate(frequencies, expr.derived().size());
+  detail::allocate(variances, expr.derived().size());
+  detail::evaluate(expr, frequencies.mutableRawData(),
+                   variances.mutableRawData(), detail::identity);
+}
+
+/// Evaluates expr into frequencies and their standard deviations.
+template <class E>
+void assign(Frequencies &frequencies, FrequencyStandardDeviations &sigmas,
+            const detail::Expression<E> &expr) {
+  detail::allocate(frequencies, expr.derived().size());
+  detail::allocate(sigmas, expr.derived().size());
+  detail::evaluate(expr, frequencies.mutableRawData(),
+                   sigmas.mutableRawData(), detail::squareRoot);
+}
+
+/// Evaluates expr into the Y data and uncertainties of histogram. The YMode
+/// of the histogram is not changed. If the histogram has no uncertainties only
+/// the Y data is set.
+template <class E>
+void assign(Histogram &histogram, const detail::Expression<E> &expr) {
+  if (!histogram.sharedY())
+    throw std::runtime_error(
+        "Invalid operation: Cannot assign expression to Histogram without Y");
+  if (histogram.sharedE())
+    detail::evaluate(expr, histogram.mutableY(), histogram.mutableE(),
+                     detail::squareRoot);
+  else
+    detail::evaluate(expr, histogram.mutableY());
+}
+
+} // namespace HistogramData
+} // namespace Mantid
+
+#endif /* MANTID_HISTOGRAMDATA_EXPRESSION_H_ */
@@ -0,0 +1,141 @@
+#ifndef MANTID_HISTOGRAMDATA_EXPRESSIONTEST_H_
+#define MANTID_HISTOGRAMDATA_EXPRESSIONTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidHistogramData/Expression.h"
+#include "MantidHistogramData/Histogram.h"
+#include "MantidHistogramData/HistogramMath.h"
+
+using namespace Mantid::HistogramData;
+
+class ExpressionTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static ExpressionTest *createSuite() { return new ExpressionTest(); }
+  static void destroySuite(ExpressionTest *suite) { delete suite; }
+
+  void test_values_only() {
+    const Counts counts{4, 9};
+    const Counts background{1, 3};
+    Counts result;
+    assign(result, (lazy(counts) - lazy(background)) * 2.0 + 1.0);
+    TS_ASSERT_EQUALS(result.size(), 2);
+    TS_ASSERT_EQUALS(result[0], 7.0);
+    TS_ASSERT_EQUALS(result[1], 13.0);
+  }
+
+  void test_scalar_on_left() {
+    const Frequencies frequencies{2, 4};
+    Frequencies result(2);
+    assign(result, 1.0 - 8.0 / lazy(frequencies));
+    TS_ASSERT_EQUALS(result[0], -3.0);
+    TS_ASSERT_EQUALS(result[1], -1.0);
+  }
+
+  void test_add_and_subtract_variances() {
+    const Counts counts{4, 9};
+    const CountVariances variances{4, 9};
+    const Counts background{1, 2};
+    const CountVariances bkgVariances{1, 2};
+    Counts sum;
+    CountVariances sumVariances;
+    assign(sum, sumVariances,
+           lazy(counts, variances) + lazy(background, bkgVariances));
+    TS_ASSERT_EQUALS(sum[0], 5.0);
+    TS_ASSERT_EQUALS(sum[1], 11.0);
+    TS_ASSERT_EQUALS(sumVariances[0], 5.0);
+    TS_ASSERT_EQUALS(sumVariances[1], 11.0);
+    Counts difference;
+    CountVariances differenceVariances;
+    assign(difference, differenceVariances,
+           lazy(counts, variances) - lazy(background, bkgVariances));
+    TS_ASSERT_EQUALS(difference[0], 3.0);
+    TS_ASSERT_EQUALS(difference[1], 7.0);
+    TS_ASSERT_EQUALS(differenceVariances[0], 5.0);
+    TS_ASSERT_EQUALS(differenceVariances[1], 11.0);
+  }
+
+  void test_scalar_scales_standard_deviations() {
+    const Counts counts{4, 9};
+    const CountStandardDeviations sigmas{2, 3};
+    Counts result;
+    CountStandardDeviations resultSigmas;
+    assign(result, resultSigmas, lazy(counts, sigmas) * 3.0);
+    TS_ASSERT_EQUALS(result[0], 12.0);
+    TS_ASSERT_EQUALS(result[1], 27.0);
+    TS_ASSERT_EQUALS(resultSigmas[0], 6.0);
+    TS_ASSERT_EQUALS(resultSigmas[1], 9.0);
+  }
+
+  void test_matches_HistogramMath() {
+    const BinEdges edges{1, 2, 3};
+    const Histogram hist(edges, Counts{4, 9}, CountStandardDeviations{2, 1});
+    const Histogram bkg(edges, Counts{1, 2}, CountStandardDeviations{1, 1});
+    Histogram norm(edges, Counts{2, 4}, CountStandardDeviations{0.5, 2});
+    norm.setYMode(Histogram::YMode::Frequencies);
+    const auto expected = (hist - bkg) * 1.5 / norm;
+
+    Histogram result(hist);
+    assign(result, (lazy(hist) - lazy(bkg)) * 1.5 / lazy(norm));
+    for (size_t i = 0; i < 2; ++i) {
+      TS_ASSERT_DELTA(result.y()[i], expected.y()[i], 1e-14);
+      TS_ASSERT_DELTA(result.e()[i], expected.e()[i], 1e-14);
+    }
+    // The input is unchanged, the output detached from the shared data.
+    TS_ASSERT_EQUALS(hist.y()[0], 4.0);
+    TS_ASSERT_EQUALS(hist.e()[0], 2.0);
+  }
+
+  void test_output_may_be_operand() {
+    Frequencies frequencies{2, 4};
+    FrequencyVariances variances{1, 4};
+    const Frequencies norm{2, 2};
+    assign(frequencies, variances,
+           lazy(frequencies, variances) / lazy(norm) + 1.0);
+    TS_ASSERT_EQUALS(frequencies[0], 2.0);
+    TS_ASSERT_EQUALS(frequencies[1], 3.0);
+    TS_ASSERT_EQUALS(variances[0], 0.25);
+    TS_ASSERT_EQUALS(variances[1], 1.0);
+  }
+
+  void test_HistogramY_and_HistogramE() {
+    HistogramY y{6, 8};
+    HistogramE e{3, 4};
+    const Counts monitor{2, 4};
+    const CountStandardDeviations monitorSigmas{1, 2};
+    // Divide in place, as NormaliseToMonitor does
+    assign(y, e, lazy(y, e) / lazy(monitor, monitorSigmas));
+    TS_ASSERT_EQUALS(y[0], 3.0);
+    TS_ASSERT_EQUALS(y[1], 2.0);
+    TS_ASSERT_DELTA(e[0], std::sqrt(9.0 / 4.0 + 36.0 / 16.0), 1e-14);
+    TS_ASSERT_DELTA(e[1], std::sqrt(16.0 / 16.0 + 64.0 * 4.0 / 256.0), 1e-14);
+  }
+
+  void test_histogram_without_uncertainties() {
+    Histogram hist(BinEdges{1, 2, 3});
+    hist.setCounts(2, 1.0);
+    const Counts counts{4, 9};
+    assign(hist, lazy(counts) * 2.0);
+    TS_ASSERT_EQUALS(hist.y()[0], 8.0);
+    TS_ASSERT_EQUALS(hist.y()[1], 18.0);
+    TS_ASSERT(!hist.sharedE());
+    TS_ASSERT_THROWS(lazy(hist), std::runtime_error);
+  }
+
+  void test_length_mismatch() {
+    const Counts counts{4, 9};
+    const Counts other{1, 2, 3};
+    const CountVariances variances{1, 2, 3};
+    Counts result;
+    TS_ASSERT_THROWS(assign(result, lazy(counts) + lazy(other)),
+                     std::runtime_error);
+    TS_ASSERT_THROWS(lazy(counts, variances), std::runtime_error);
+    Counts wrongLength(3);
+    TS_ASSERT_THROWS(assign(wrongLength, lazy(counts) * 2.0),
+                     std::runtime_error);
+  }
+};
+
+#endif /* MANTID_HISTOGRAMDATA_EXPRESSIONTEST_H_ */
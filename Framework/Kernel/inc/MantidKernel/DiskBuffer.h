@@ -12,11 +12,15 @@
 #include <boost/multi_index/ordered_index.hpp>
 #include <boost/multi_index/sequenced_index.hpp>
 #endif
+#include <atomic>
+#include <condition_variable>
 #include <cstdint>
+#include <deque>
 #include <limits>
 #include <list>
 #include <map>
 #include <mutex>
+#include <thread>
 #include <vector>
 
 namespace Mantid {
@@ -31,6 +35,11 @@ namespace Kernel {
   It also stores a list of "free" blocks in the output file,
   to allow new blocks to fill them later.
 
+  Objects that will be used soon can be prefetched: a background thread loads
+  them in the order given, as long as the to-write buffer has room for them,
+  and adds them to the buffer so they are written out or dropped like any
+  other object.
+
   @date 2011-12-30
 
   Copyright &copy; 2011 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
@@ -77,11 +86,31 @@ public:
   DiskBuffer(uint64_t m_writeBufferSize);
   DiskBuffer(const DiskBuffer &) = delete;
   DiskBuffer &operator=(const DiskBuffer &) = delete;
-  virtual ~DiskBuffer() = default;
+  virtual ~DiskBuffer();
 
   void toWrite(ISaveable *item);
   void flushCache();
   void objectDeleted(ISaveable *item);
+  void objectLoaded(const ISaveable *item);
+
+  // Prefetching
+  void prefetch(const std::vector<ISaveable *> &items);
+  void cancelPrefetch();
+  void waitForPrefetch();
+
+  /// Counters of the objects loaded from the file
+  struct Statistics {
+    /// Objects loaded by a prefetch
+    uint64_t numPrefetched;
+    /// Prefetched objects that were used before being dropped from memory
+    uint64_t numHits;
+    /// Objects loaded when they were used, without a prefetch
+    uint64_t numMisses;
+    /// Total size of the data loaded, in the units of the file positions
+    uint64_t dataRead;
+  };
+  Statistics getStatistics() const;
+  void resetStatistics();
 
   // Free space map methods
   void freeBlock(uint64_t const pos, uint64_t const size);
@@ -133,6 +162,7 @@ public:
 
 protected:
   inline void writeOldObjects();
+  void addToBuffer(ISaveable *item, bool prefetched);
 
   // ----------------------- To-write buffer
   // --------------------------------------
@@ -142,15 +172,16 @@ protected:
   /// Amount of memory to accumulate in the write buffer before writing.
   size_t m_writeBufferSize;
 
-  /// Total amount of memory in the "toWrite" buffer.
-  size_t m_writeBufferUsed;
+  /// Total amount of memory in the "toWrite" buffer. Modified with m_mutex
+  /// locked, and read by the prefetch thread without it.
+  std::atomic<size_t> m_writeBufferUsed;
   /// number of objects stored in to write buffer list
   size_t m_nObjectsToWrite;
   /** A forward list for the buffer of "toWrite" objects.   */
   std::list<ISaveable *> m_toWriteBuffer;
 
   /// Mutex for modifying the the toWrite buffer.
-  std::mutex m_mutex;
+  mutable std::mutex m_mutex;
 
   // ----------------------- Free space map
   // --------------------------------------
@@ -167,7 +198,29 @@ protected:
   /// Length of the file. This is where new blocks that don't fit get placed.
   mutable uint64_t m_fileLength;
 
+  // ----------------------- Prefetching --------------------------------------
+  /// Objects waiting to be loaded by the prefetch thread, in order
+  std::deque<ISaveable *> m_prefetchQueue;
+  /// The object the prefetch thread is loading, if any
+  ISaveable *m_prefetchCurrent;
+  /// Tells the prefetch thread to finish
+  bool m_stopPrefetch;
+  /// Mutex for the prefetch queue
+  std::mutex m_prefetchMutex;
+  /// Wakes the prefetch thread, or threads waiting for it
+  std::condition_variable m_prefetchCondition;
+  /// Thread loading the queued objects, started by the first prefetch
+  std::thread m_prefetchThread;
+  /// Set once the prefetch thread has been started
+  std::atomic<bool> m_prefetchStarted;
+
+  /// Load counters, modified with m_mutex locked
+  Statistics m_statistics;
+
 private:
+  void prefetchLoop();
+  bool prefetchReady() const;
+  void wakePrefetch();
 };
 
 } // namespace Kernel
@@ -5,6 +5,7 @@
 #include <list>
 #include <vector>
 #include <algorithm>
+#include <atomic>
 #include <mutex>
 #ifndef Q_MOC_RUN
 #include <boost/optional.hpp>
@@ -70,8 +71,9 @@ public:
   }
   /**@return  true if the object has been load in the memory -- the load
    * function should call setter, or if the object was constructed in memory it
-   * should be loaded too */
-  bool isLoaded() const { return m_isLoaded; }
+   * should be loaded too. Once it returns true, the loaded data can be read
+   * from any thread. */
+  bool isLoaded() const { return m_isLoaded.load(std::memory_order_acquire); }
 
   // protected?
   /**sets the value of the isLoad parameter, indicating that data from HDD have
@@ -79,7 +81,7 @@ public:
    *@param Yes -- boolean true or false --usually only load functiomn should set
    *it to true
   */
-  void setLoaded(bool Yes) { m_isLoaded = Yes; }
+  void setLoaded(bool Yes) { m_isLoaded.store(Yes, std::memory_order_release); }
 
   /// @return true if it the data of the object is busy and so cannot be
   /// cleared; false if the data was released and can be cleared/written.
@@ -149,8 +151,9 @@ protected:
   /// representation on it (though this representation may be incorrect as data
   /// changed in memory)
   mutable bool m_wasSaved;
-  /// this boolean indicates, if the data have its copy in memory
-  bool m_isLoaded;
+  /// this boolean indicates, if the data have its copy in memory. Atomic, as
+  /// the prefetch thread of the DiskBuffer sets it while others read it
+  std::atomic<bool> m_isLoaded;
 
 private:
   // the iterator which describes the position of this object in the DiskBuffer.
@@ -159,6 +162,9 @@ private:
   // the size of the object in the memory buffer, used to calculate the total
   // amount of memory the objects occupy
   size_t m_BufMemorySize;
+  // true if the object was loaded by a prefetch of the DiskBuffer and has not
+  // been used since
+  bool m_prefetched;
   /// Start point in the NXS file where the events are located
   uint64_t m_fileIndexStart;
   /// Number of events saved in the file, after the start index location
@@ -170,6 +170,11 @@ threadSafe(const Arg &workspace, Args &&... others) {
 
 #define PARALLEL_THREAD_NUMBER omp_get_thread_num()
 
+/** True inside an active parallel region, where a nested parallel loop would
+ * multiply the number of threads
+ */
+#define PARALLEL_IN_REGION omp_in_parallel()
+
 #define PARALLEL PRAGMA(omp parallel)
 
 #define PARALLEL_SECTIONS PRAGMA(omp sections nowait)
@@ -194,6 +199,7 @@ threadSafe(const Arg &workspace, Args &&... others) {
 #define PARALLEL_CRITICAL(name)
 #define PARALLEL_ATOMIC
 #define PARALLEL_THREAD_NUMBER 0
+#define PARALLEL_IN_REGION false
 #define PARALLEL_SET_NUM_THREADS(MaxCores)
 #define PARALLEL_SET_DYNAMIC(val)
 #define PARALLEL_NUMBER_OF_THREADS 1
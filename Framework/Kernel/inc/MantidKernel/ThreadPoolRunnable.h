@@ -28,6 +28,9 @@ public:
 
   void clearWait();
 
+  /// Whether the calling thread is running the tasks of a thread pool
+  static bool inPoolThread();
+
 private:
   /// ID of this thread.
   size_t m_threadnum;
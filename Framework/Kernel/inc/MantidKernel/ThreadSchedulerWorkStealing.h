@@ -0,0 +1,91 @@
+#ifndef MANTID_KERNEL_THREADSCHEDULERWORKSTEALING_H_
+#define MANTID_KERNEL_THREADSCHEDULERWORKSTEALING_H_
+
+#include "MantidKernel/DllConfig.h"
+#include "MantidKernel/ThreadScheduler.h"
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Mantid {
+namespace Kernel {
+
+/** ThreadSchedulerWorkStealing : A ThreadScheduler with a queue of tasks for
+  each thread, so that threads do not all wait on one lock to push and pop.
+
+  A thread pops the task it was given most recently from its own queue. When
+  its queue is empty it steals the oldest task from the queue of another
+  thread. Tasks pushed from outside the pool go to the queue holding the
+  smallest total cost, so the costs of the tasks still spread the work evenly
+  between the threads. Tasks pushed by a running task (e.g. when splitting MD
+  boxes) go to the queue of the thread running it, where they are run next.
+
+  Tasks are not run in the order they were pushed. Use ThreadSchedulerFIFO if
+  that matters, or ThreadSchedulerMutexes if tasks have mutexes.
+
+  Copyright &copy; 2016 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+class MANTID_KERNEL_DLL ThreadSchedulerWorkStealing : public ThreadScheduler {
+public:
+  explicit ThreadSchedulerWorkStealing(size_t numQueues = 0);
+  ~ThreadSchedulerWorkStealing() override;
+
+  void push(Task *newTask) override;
+  Task *pop(size_t threadnum) override;
+  size_t size() override;
+  bool empty() override;
+  void clear() override;
+  double totalCost() override;
+
+  /// @return the number of queues, normally one per thread of the pool
+  size_t numQueues() const { return m_queues.size(); }
+
+private:
+  /// The tasks of one thread
+  struct Queue {
+    /// Held to change tasks or pushedCost
+    std::mutex lock;
+    std::deque<Task *> tasks;
+    /// Number of tasks, readable without the lock
+    std::atomic<size_t> size{0};
+    /// Cost of the tasks, readable without the lock
+    std::atomic<double> cost{0.};
+    /// Cost of all the tasks ever pushed here
+    double pushedCost = 0.;
+  };
+
+  void pushTo(Queue &queue, Task *newTask);
+  Task *popFrom(Queue &queue, bool newest);
+  size_t cheapestQueue() const;
+
+  /// One queue per thread
+  std::vector<std::unique_ptr<Queue>> m_queues;
+  /// Total number of tasks in all the queues
+  std::atomic<size_t> m_size;
+};
+
+} // namespace Kernel
+} // namespace Mantid
+
+#endif /* MANTID_KERNEL_THREADSCHEDULERWORKSTEALING_H_ */
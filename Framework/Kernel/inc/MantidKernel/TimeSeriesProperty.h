@@ -10,7 +10,9 @@
 #include "MantidKernel/Property.h"
 #include "MantidKernel/PropertyNexus.h"
 #include "MantidKernel/Statistics.h"
+#include <atomic>
 #include <cstdint>
+#include <mutex>
 #include <utility>
 
 namespace Mantid {
@@ -114,6 +116,8 @@ class DLLExport TimeSeriesProperty : public Property,
 public:
   /// Constructor
   explicit TimeSeriesProperty(const std::string &name);
+  /// Copy constructor
+  TimeSeriesProperty(const TimeSeriesProperty<TYPE> &other);
   /// Virtual destructor
   ~TimeSeriesProperty() override;
   /// "Virtual" copy constructor
@@ -283,6 +287,14 @@ public:
 
   /// Return a TimeSeriesPropertyStatistics object
   TimeSeriesPropertyStatistics getStatistics() const;
+  /// Return the time-weighted statistics of the log within a time interval
+  TimeSeriesPropertyStatistics
+  getStatisticsInInterval(const TimeInterval &interval) const;
+  /// Index the log for repeated averageValueInFilter and
+  /// getStatisticsInInterval queries
+  void buildIntervalIndex() const;
+  /// Free the index made by buildIntervalIndex
+  void clearIntervalIndex() const;
 
   /// Detects whether there are duplicated entries (of time) in property &
   /// eliminates them
@@ -294,7 +306,15 @@ public:
   /**Reserve memory for efficient adding values to existing property
     * makes sense only when you have reasonably precise estimate of the
     * total size you'll need easily available in advance.  */
-  void reserve(size_t size) { m_values.reserve(size); };
+  void reserve(size_t size) {
+    decompress();
+    m_values.reserve(size);
+  };
+
+  /// Pack the values into a compact delta/run-length encoded form
+  void compress();
+  /// Returns true if the values are currently held in compressed form
+  bool isCompressed() const { return m_isCompressed; }
 
 private:
   //----------------------------------------------------------------------------------------------
@@ -313,9 +333,50 @@ private:
   size_t findNthIndexFromQuickRef(int n) const;
   /// Set a value from another property
   std::string setValueFromProperty(const Property &right) override;
+  /// Unpack the compressed form back into m_values
+  void decompress() const;
+
+  /// Compact form of m_values: times are stored as variable-length encoded
+  /// differences to the previous time and values as runs of equal values
+  struct Compressed {
+    std::vector<uint8_t> timeDeltas;
+    std::vector<TYPE> runValues;
+    std::vector<uint32_t> runLengths;
+    size_t size = 0;
+  };
 
   /// Holds the time series data
   mutable std::vector<TimeValueUnit<TYPE>> m_values;
+  /// Holds the time series data while compressed (m_values is then empty)
+  mutable Compressed m_compressed;
+  /// True while the values are held in m_compressed
+  mutable std::atomic<bool> m_isCompressed;
+  /// Lets const methods called from several threads decompress the values
+  /// and build m_intervalIndex only once
+  mutable std::mutex m_lazyMutex;
+
+  /// Running time integrals and a segment tree of the extrema of the sorted
+  /// values, so that queries over a time interval take O(log n)
+  struct IntervalIndex {
+    /// Subtracted from the values before integrating them, so that the
+    /// variance is not the difference of two large numbers
+    double shift = 0.0;
+    /// Integral of (value - shift) over time from the first entry to entry i
+    std::vector<double> integral;
+    /// Integral of (value - shift)^2 from the first entry to entry i
+    std::vector<double> integralOfSquares;
+    /// Minimum and maximum of each node; the leaves start at index n
+    std::vector<std::pair<double, double>> minMax;
+  };
+  /// Built by buildIntervalIndex; empty when out of date
+  mutable IntervalIndex m_intervalIndex;
+  /// True while m_intervalIndex is up to date
+  mutable std::atomic<bool> m_hasIntervalIndex;
+  /// Index the current values, which must be sorted
+  IntervalIndex makeIntervalIndex() const;
+  /// Time integrals of the shifted value and its square up to the given time
+  std::pair<double, double> integralsUpTo(const IntervalIndex &index,
+                                          const DateAndTime &time) const;
 
   /// The number of values (or time intervals) in the time series. It can be
   /// different from m_propertySeries.size()
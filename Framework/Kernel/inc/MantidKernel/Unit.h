@@ -184,6 +184,21 @@ public:
    */
   virtual double singleFromTOF(const double tof) const = 0;
 
+  /** Convert many X values to TOF in place, as singleToTOF() does for one.
+   * Units override this with a loop that does not make a virtual call per
+   * value.
+   * @param values :: the values to convert
+   * @param count :: the number of values
+   */
+  virtual void manyToTOF(double *values, const size_t count) const;
+
+  /** Convert many tof values to this unit in place, as singleFromTOF() does
+   * for one.
+   * @param values :: the values to convert
+   * @param count :: the number of values
+   */
+  virtual void manyFromTOF(double *values, const size_t count) const;
+
   /// @return true if the unit was initialized and so can use singleToTOF()
   bool isInitialized() const { return initialized; }
 
@@ -304,6 +319,8 @@ public:
   void init() override;
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void manyToTOF(double *values, const size_t count) const override;
+  void manyFromTOF(double *values, const size_t count) const override;
   Unit *clone() const override;
   ///@return -DBL_MAX as ToF convertible to TOF for in any time range
   double conversionTOFMin() const override;
@@ -321,6 +338,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void manyToTOF(double *values, const size_t count) const override;
+  void manyFromTOF(double *values, const size_t count) const override;
   void init() override;
   Unit *clone() const override;
 
@@ -348,6 +367,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void manyToTOF(double *values, const size_t count) const override;
+  void manyFromTOF(double *values, const size_t count) const override;
   void init() override;
   Unit *clone() const override;
 
@@ -395,6 +416,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void manyToTOF(double *values, const size_t count) const override;
+  void manyFromTOF(double *values, const size_t count) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
@@ -418,6 +441,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void manyToTOF(double *values, const size_t count) const override;
+  void manyFromTOF(double *values, const size_t count) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
@@ -440,6 +465,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void manyToTOF(double *values, const size_t count) const override;
+  void manyFromTOF(double *values, const size_t count) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
@@ -463,6 +490,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void manyToTOF(double *values, const size_t count) const override;
+  void manyFromTOF(double *values, const size_t count) const override;
   void init() override;
   Unit *clone() const override;
 
@@ -532,6 +561,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void manyToTOF(double *values, const size_t count) const override;
+  void manyFromTOF(double *values, const size_t count) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
@@ -551,6 +582,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void manyToTOF(double *values, const size_t count) const override;
+  void manyFromTOF(double *values, const size_t count) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
@@ -59,6 +59,32 @@ rebinHistogram(const std::vector<double> &xold, const std::vector<double> &yold,
                std::vector<double> &ynew, std::vector<double> &enew,
                bool addition);
 
+/** The overlaps of a set of old bins with a set of new bins, as a sparse
+ * matrix of weights. Computing them once and calling apply() for each
+ * histogram gives the same result as rebin() for many histograms with the same
+ * X values, without walking through the bin edges for each of them.
+ */
+class MANTID_KERNEL_DLL RebinOverlaps {
+public:
+  RebinOverlaps(const std::vector<double> &xold,
+                const std::vector<double> &xnew, bool distribution);
+  void apply(const std::vector<double> &yold, const std::vector<double> &eold,
+             std::vector<double> &ynew, std::vector<double> &enew) const;
+
+private:
+  size_t m_sizeOld;
+  /// Width of the new bins, used for distributions only.
+  std::vector<double> m_newWidths;
+  /// Index of the first overlap of each new bin, and one past the last.
+  std::vector<size_t> m_firstOverlap;
+  std::vector<size_t> m_oldIndex;
+  std::vector<double> m_yWeight;
+  std::vector<double> m_eWeight;
+  bool m_distribution;
+  /// False if the bins were found to be invalid, see rebin().
+  bool m_normalize{true};
+};
+
 /// Convert an array of bin boundaries to bin center values.
 void MANTID_KERNEL_DLL convertToBinCentre(const std::vector<double> &bin_edges,
                                           std::vector<double> &bin_centres);
@@ -1,8 +1,14 @@
 #include "MantidKernel/DiskBuffer.h"
+#include <algorithm>
 #include <sstream>
 
 using namespace Mantid::Kernel;
 
+namespace {
+/// The buffer whose prefetch thread is the current thread, if any
+thread_local const DiskBuffer *prefetchingBuffer = nullptr;
+}
+
 namespace Mantid {
 namespace Kernel {
 
@@ -11,7 +17,9 @@ namespace Kernel {
  */
 DiskBuffer::DiskBuffer()
     : m_writeBufferSize(50), m_writeBufferUsed(0), m_nObjectsToWrite(0),
-      m_free(), m_free_bySize(m_free.get<1>()), m_fileLength(0) {
+      m_free(), m_free_bySize(m_free.get<1>()), m_fileLength(0),
+      m_prefetchCurrent(nullptr), m_stopPrefetch(false),
+      m_prefetchStarted(false), m_statistics() {
   m_free.clear();
 }
 
@@ -25,10 +33,26 @@ DiskBuffer::DiskBuffer()
 DiskBuffer::DiskBuffer(uint64_t m_writeBufferSize)
     : m_writeBufferSize(m_writeBufferSize), m_writeBufferUsed(0),
       m_nObjectsToWrite(0), m_free(), m_free_bySize(m_free.get<1>()),
-      m_fileLength(0) {
+      m_fileLength(0), m_prefetchCurrent(nullptr), m_stopPrefetch(false),
+      m_prefetchStarted(false), m_statistics() {
   m_free.clear();
 }
 
+//----------------------------------------------------------------------------------------------
+/** Destructor. Stops the prefetch thread, if it was started.
+ */
+DiskBuffer::~DiskBuffer() {
+  if (m_prefetchThread.joinable()) {
+    {
+      std::lock_guard<std::mutex> lock(m_prefetchMutex);
+      m_stopPrefetch = true;
+      m_prefetchQueue.clear();
+    }
+    m_prefetchCondition.notify_all();
+    m_prefetchThread.join();
+  }
+}
+
 //---------------------------------------------------------------------------------------------
 /** Call this method when an object is ready to be written
  * out to disk.
@@ -43,27 +67,53 @@ void DiskBuffer::toWrite(ISaveable *item) {
     return;
   //    if (!m_useWriteBuffer) return;
 
+  addToBuffer(item, false);
+
+  // Should we now write out the old data?
+  if (m_writeBufferUsed > m_writeBufferSize)
+    writeOldObjects();
+}
+
+//---------------------------------------------------------------------------------------------
+/** Add an object to the to-write buffer, or update its size if it is already
+ * there.
+ *
+ * @param item :: item that can be written to disk.
+ * @param prefetched :: true if the item has just been loaded by a prefetch,
+ * false if it is being used.
+ */
+void DiskBuffer::addToBuffer(ISaveable *item, bool prefetched) {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  bool madeRoom = false;
+  if (prefetched) {
+    item->m_prefetched = true;
+    m_statistics.numPrefetched++;
+    m_statistics.dataRead += item->getFileSize();
+  } else if (item->m_prefetched) {
+    item->m_prefetched = false;
+    m_statistics.numHits++;
+  }
+
   if (item->getBufPostion()) // already in the buffer and probably have changed
                              // its size in memory
   {
     // forget old memory size
-    std::unique_lock<std::mutex> uniqueLock(m_mutex);
-    m_writeBufferUsed -= item->getBufferSize();
+    const size_t oldMemorySize = item->getBufferSize();
+    m_writeBufferUsed -= oldMemorySize;
     // add new size
     size_t newMemorySize = item->getDataMemorySize();
     m_writeBufferUsed += newMemorySize;
-    uniqueLock.unlock();
     item->setBufferSize(newMemorySize);
+    madeRoom = newMemorySize < oldMemorySize;
   } else {
-    std::lock_guard<std::mutex> lock(m_mutex);
     m_toWriteBuffer.push_front(item);
     m_writeBufferUsed += item->setBufferPosition(m_toWriteBuffer.begin());
     m_nObjectsToWrite++;
   }
-
-  // Should we now write out the old data?
-  if (m_writeBufferUsed > m_writeBufferSize)
-    writeOldObjects();
+  lock.unlock();
+  // The next object in the prefetch queue may fit now
+  if (madeRoom)
+    wakePrefetch();
 }
 
 //---------------------------------------------------------------------------------------------
@@ -77,6 +127,15 @@ void DiskBuffer::toWrite(ISaveable *item) {
 void DiskBuffer::objectDeleted(ISaveable *item) {
   if (item == nullptr)
     return;
+  // Forget a pending prefetch, and wait for one in progress
+  if (m_prefetchStarted) {
+    std::unique_lock<std::mutex> prefetchLock(m_prefetchMutex);
+    m_prefetchQueue.erase(
+        std::remove(m_prefetchQueue.begin(), m_prefetchQueue.end(), item),
+        m_prefetchQueue.end());
+    m_prefetchCondition.wait(
+        prefetchLock, [this, item] { return m_prefetchCurrent != item; });
+  }
   // have it ever been in the buffer?
   std::unique_lock<std::mutex> uniqueLock(m_mutex);
   auto opt2it = item->getBufPostion();
@@ -91,6 +150,9 @@ void DiskBuffer::objectDeleted(ISaveable *item) {
   item->clearBufferState();
   uniqueLock.unlock();
 
+  // There may be room for prefetching again
+  wakePrefetch();
+
   // Mark the amount of space used on disk as free
   if (item->wasSaved())
     this->freeBlock(item->getFilePosition(), item->getFileSize());
@@ -153,6 +215,7 @@ void DiskBuffer::writeOldObjects() {
       }
       // tell the object that it has been removed from the buffer
       obj->clearBufferState();
+      obj->m_prefetched = false;
     } else // object busy
     {
       // The object is busy, can't write. Save it for later
@@ -180,16 +243,161 @@ void DiskBuffer::writeOldObjects() {
   m_toWriteBuffer.swap(couldNotWrite);
   m_writeBufferUsed = memoryNotWritten;
   m_nObjectsToWrite = objectsNotWritten;
+
+  // There may be room for prefetching again
+  wakePrefetch();
 }
 
 //---------------------------------------------------------------------------------------------
 /** Flush out all the data in the memory; and writes out everything in the
- * to-write cache. */
+ * to-write cache. Pending prefetches are cancelled. */
 void DiskBuffer::flushCache() {
+  cancelPrefetch();
   // Now write everything out.
   writeOldObjects();
 }
 
+//---------------------------------------------------------------------------------------------
+/** Call this method when an object has been loaded from the file because it
+ * is being used. Loads done by a prefetch are counted by the buffer itself.
+ *
+ * @param item :: the ISaveable object that has been loaded.
+ */
+void DiskBuffer::objectLoaded(const ISaveable *item) {
+  if (item == nullptr || prefetchingBuffer == this)
+    return;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_statistics.numMisses++;
+    m_statistics.dataRead += item->getFileSize();
+  }
+  // The object may be waiting in the prefetch queue
+  wakePrefetch();
+}
+
+//---------------------------------------------------------------------------------------------
+/** Load objects in the background, in the order given, before they are used.
+ *
+ * A thread loads the objects one at a time while the to-write buffer has room
+ * for them, and adds them to the buffer. The objects must be used read-only
+ * until they have been loaded, and their load() must be safe to call from
+ * another thread. The items replace any prefetches still pending.
+ *
+ * @param items :: the objects, in the order they will be used.
+ */
+void DiskBuffer::prefetch(const std::vector<ISaveable *> &items) {
+  if (m_writeBufferSize == 0)
+    return;
+  {
+    std::lock_guard<std::mutex> lock(m_prefetchMutex);
+    m_prefetchQueue.clear();
+    for (auto item : items) {
+      if (item && item->wasSaved() && !item->isLoaded())
+        m_prefetchQueue.push_back(item);
+    }
+    if (!m_prefetchStarted && !m_prefetchQueue.empty()) {
+      m_prefetchThread = std::thread(&DiskBuffer::prefetchLoop, this);
+      m_prefetchStarted = true;
+    }
+  }
+  m_prefetchCondition.notify_all();
+}
+
+//---------------------------------------------------------------------------------------------
+/** Drop the pending prefetches and wait for a load in progress to finish. */
+void DiskBuffer::cancelPrefetch() {
+  if (!m_prefetchStarted)
+    return;
+  std::unique_lock<std::mutex> lock(m_prefetchMutex);
+  m_prefetchQueue.clear();
+  m_prefetchCondition.wait(lock, [this] { return !m_prefetchCurrent; });
+}
+
+//---------------------------------------------------------------------------------------------
+/** Wait until the prefetch thread has nothing it can load: its queue is empty
+ * or the next object does not fit in the to-write buffer. Returns at once if
+ * nothing was prefetched. */
+void DiskBuffer::waitForPrefetch() {
+  if (!m_prefetchStarted)
+    return;
+  std::unique_lock<std::mutex> lock(m_prefetchMutex);
+  m_prefetchCondition.wait(lock, [this] {
+    return m_stopPrefetch || (!m_prefetchCurrent && !prefetchReady());
+  });
+}
+
+/** Wake the prefetch thread after a change that may let it continue. The
+ * mutex is taken so that the thread cannot miss the change between testing
+ * for it and waiting. */
+void DiskBuffer::wakePrefetch() {
+  if (!m_prefetchStarted)
+    return;
+  { std::lock_guard<std::mutex> lock(m_prefetchMutex); }
+  m_prefetchCondition.notify_all();
+}
+
+/// @return true if the prefetch thread should stop or can load the next object
+/// of the queue. Call with m_prefetchMutex locked.
+bool DiskBuffer::prefetchReady() const {
+  if (m_stopPrefetch)
+    return true;
+  if (m_prefetchQueue.empty())
+    return false;
+  // Loaded meanwhile: nothing to read
+  const ISaveable *next = m_prefetchQueue.front();
+  if (next->isLoaded())
+    return true;
+  // An object larger than the whole buffer is loaded only into an empty one
+  return m_writeBufferUsed == 0 ||
+         m_writeBufferUsed + next->getFileSize() <= m_writeBufferSize;
+}
+
+/** The loop of the prefetch thread: load the queued objects while the buffer
+ * has room for them. */
+void DiskBuffer::prefetchLoop() {
+  prefetchingBuffer = this;
+  std::unique_lock<std::mutex> lock(m_prefetchMutex);
+  while (true) {
+    if (!prefetchReady()) {
+      // Tell threads in waitForPrefetch() that there is nothing to do, then
+      // sleep until new objects are queued or the buffer has more room.
+      m_prefetchCondition.notify_all();
+      do {
+        m_prefetchCondition.wait(lock);
+      } while (!prefetchReady());
+    }
+    if (m_stopPrefetch)
+      return;
+
+    ISaveable *item = m_prefetchQueue.front();
+    m_prefetchQueue.pop_front();
+    if (item->isLoaded())
+      continue;
+    m_prefetchCurrent = item;
+    lock.unlock();
+
+    item->load();
+    addToBuffer(item, true);
+
+    lock.lock();
+    m_prefetchCurrent = nullptr;
+    m_prefetchCondition.notify_all();
+  }
+}
+
+//---------------------------------------------------------------------------------------------
+/// @return the counters of the objects loaded from the file
+DiskBuffer::Statistics DiskBuffer::getStatistics() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_statistics;
+}
+
+/// Set the counters of the objects loaded from the file to zero
+void DiskBuffer::resetStatistics() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_statistics = Statistics();
+}
+
 //---------------------------------------------------------------------------------------------
 /** This method is called by this->relocate when object that has shrunk
  * and so has left a bit of free space after itself on the file;
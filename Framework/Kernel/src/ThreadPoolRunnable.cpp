@@ -3,6 +3,11 @@
 namespace Mantid {
 namespace Kernel {
 
+namespace {
+/// True while the current thread runs the tasks of a ThreadPoolRunnable
+thread_local bool runningTasks = false;
+}
+
 //-----------------------------------------------------------------------------------
 /** Constructor
  *
@@ -28,12 +33,20 @@ ThreadPoolRunnable::ThreadPoolRunnable(size_t threadnum,
 /** Clear the wait time of the runnable so that it stops waiting for tasks. */
 void ThreadPoolRunnable::clearWait() { m_waitSec = 0.0; }
 
+//-----------------------------------------------------------------------------------
+/** @return true if called from a task run by a ThreadPoolRunnable. Code that
+ * may run in such a task can use this to avoid starting threads of its own
+ * on top of those of the pool.
+ */
+bool ThreadPoolRunnable::inPoolThread() { return runningTasks; }
+
 //-----------------------------------------------------------------------------------
 /** Thread method. Will wait for new tasks and run them
  * as scheduled to it.
  */
 void ThreadPoolRunnable::run() {
   Task *task;
+  runningTasks = true;
 
   // If there are no tasks yet, wait up to m_waitSec for them to come up
   while (m_scheduler->empty() && m_waitSec > 0.0) {
@@ -84,6 +97,7 @@ void ThreadPoolRunnable::run() {
   }
   // Ran out of tasks that could be run.
   // Thread now will exit
+  runningTasks = false;
 }
 
 } // namespace Mantid
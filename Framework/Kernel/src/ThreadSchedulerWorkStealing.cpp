@@ -0,0 +1,146 @@
+#include "MantidKernel/ThreadSchedulerWorkStealing.h"
+#include "MantidKernel/ThreadPool.h"
+
+namespace Mantid {
+namespace Kernel {
+
+namespace {
+/// The scheduler whose tasks the current thread last popped
+thread_local const ThreadSchedulerWorkStealing *currentScheduler = nullptr;
+/// The queue of that scheduler belonging to the current thread
+thread_local size_t currentQueue = 0;
+}
+
+/** Constructor
+ * @param numQueues :: number of queues, which should be the number of threads
+ *of the ThreadPool. 0 (the default) means one per core, as ThreadPool does.
+ */
+ThreadSchedulerWorkStealing::ThreadSchedulerWorkStealing(size_t numQueues)
+    : ThreadScheduler(), m_queues(), m_size(0) {
+  if (numQueues == 0)
+    numQueues = ThreadPool::getNumPhysicalCores();
+  m_queues.reserve(numQueues);
+  for (size_t i = 0; i < numQueues; ++i)
+    m_queues.emplace_back(new Queue);
+}
+
+/// Destructor. Deletes any tasks left.
+ThreadSchedulerWorkStealing::~ThreadSchedulerWorkStealing() { clear(); }
+
+/** Add a Task. A task pushed by a running task goes to the queue of the thread
+ * running it; any other goes to the queue with the smallest cost.
+ * @param newTask :: Task to add
+ */
+void ThreadSchedulerWorkStealing::push(Task *newTask) {
+  const size_t queue = (currentScheduler == this)
+                           ? currentQueue % m_queues.size()
+                           : cheapestQueue();
+  pushTo(*m_queues[queue], newTask);
+}
+
+/** Retrieve the next Task for a thread: the newest one from its own queue, or
+ * else the oldest one from the queue of another thread.
+ * @param threadnum :: ID of the calling thread.
+ * @return a Task pointer to execute, or NULL if there are none.
+ */
+Task *ThreadSchedulerWorkStealing::pop(size_t threadnum) {
+  const size_t own = threadnum % m_queues.size();
+  currentScheduler = this;
+  currentQueue = own;
+
+  if (Task *task = popFrom(*m_queues[own], true))
+    return task;
+  for (size_t i = 1; i < m_queues.size(); ++i) {
+    if (Task *task = popFrom(*m_queues[(own + i) % m_queues.size()], false))
+      return task;
+  }
+  return nullptr;
+}
+
+/// @return the number of tasks in all the queues
+size_t ThreadSchedulerWorkStealing::size() { return m_size.load(); }
+
+/// @return true if there are no tasks in any queue
+bool ThreadSchedulerWorkStealing::empty() { return m_size.load() == 0; }
+
+/// Empty out all the queues, deleting the tasks
+void ThreadSchedulerWorkStealing::clear() {
+  for (auto &queue : m_queues) {
+    std::lock_guard<std::mutex> lock(queue->lock);
+    for (auto task : queue->tasks)
+      delete task;
+    m_size -= queue->tasks.size();
+    queue->tasks.clear();
+    queue->size = 0;
+    queue->cost = 0.;
+    queue->pushedCost = 0.;
+  }
+  m_costExecuted = 0;
+}
+
+/// @return the total cost of all the tasks pushed since the last clear()
+double ThreadSchedulerWorkStealing::totalCost() {
+  double cost = 0.;
+  for (auto &queue : m_queues) {
+    std::lock_guard<std::mutex> lock(queue->lock);
+    cost += queue->pushedCost;
+  }
+  return cost;
+}
+
+/** Add a task to the back of a queue
+ * @param queue :: the queue
+ * @param newTask :: Task to add
+ */
+void ThreadSchedulerWorkStealing::pushTo(Queue &queue, Task *newTask) {
+  const double cost = newTask->cost();
+  std::lock_guard<std::mutex> lock(queue.lock);
+  queue.tasks.push_back(newTask);
+  queue.size = queue.tasks.size();
+  queue.cost = queue.cost + cost;
+  queue.pushedCost += cost;
+  ++m_size;
+}
+
+/** Take a task from a queue
+ * @param queue :: the queue
+ * @param newest :: take the newest task (from the back) rather than the oldest
+ * @return the task, or NULL if the queue is empty
+ */
+Task *ThreadSchedulerWorkStealing::popFrom(Queue &queue, bool newest) {
+  // Don't wait on the lock of a queue that has nothing to take
+  if (queue.size.load() == 0)
+    return nullptr;
+  std::lock_guard<std::mutex> lock(queue.lock);
+  if (queue.tasks.empty())
+    return nullptr;
+  Task *task = nullptr;
+  if (newest) {
+    task = queue.tasks.back();
+    queue.tasks.pop_back();
+  } else {
+    task = queue.tasks.front();
+    queue.tasks.pop_front();
+  }
+  queue.size = queue.tasks.size();
+  queue.cost = queue.tasks.empty() ? 0. : queue.cost - task->cost();
+  --m_size;
+  return task;
+}
+
+/// @return the index of the queue with the smallest cost of tasks waiting
+size_t ThreadSchedulerWorkStealing::cheapestQueue() const {
+  size_t cheapest = 0;
+  double cheapestCost = m_queues[0]->cost.load();
+  for (size_t i = 1; i < m_queues.size() && cheapestCost > 0.; ++i) {
+    const double cost = m_queues[i]->cost.load();
+    if (cost < cheapestCost) {
+      cheapest = i;
+      cheapestCost = cost;
+    }
+  }
+  return cheapest;
+}
+
+} // namespace Kernel
+} // namespace Mantid
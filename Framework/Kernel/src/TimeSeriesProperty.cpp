@@ -8,11 +8,37 @@
 
 #include <boost/regex.hpp>
 
+#include <cmath>
+#include <limits>
+
 namespace Mantid {
 namespace Kernel {
 namespace {
 /// static Logger definition
 Logger g_log("TimeSeriesProperty");
+
+/// Append a signed integer to a byte stream as a zigzag LEB128 varint
+void appendVarInt(std::vector<uint8_t> &out, int64_t value) {
+  auto bits =
+      (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+  while (bits >= 0x80) {
+    out.push_back(static_cast<uint8_t>(bits | 0x80));
+    bits >>= 7;
+  }
+  out.push_back(static_cast<uint8_t>(bits));
+}
+
+/// Read a zigzag LEB128 varint written by appendVarInt and advance the cursor
+int64_t readVarInt(const uint8_t *&in) {
+  uint64_t bits = 0;
+  int shift = 0;
+  while (*in & 0x80) {
+    bits |= static_cast<uint64_t>(*in++ & 0x7f) << shift;
+    shift += 7;
+  }
+  bits |= static_cast<uint64_t>(*in++) << shift;
+  return static_cast<int64_t>(bits >> 1) ^ -static_cast<int64_t>(bits & 1);
+}
 }
 
 /**
@@ -22,7 +48,29 @@ Logger g_log("TimeSeriesProperty");
 template <typename TYPE>
 TimeSeriesProperty<TYPE>::TimeSeriesProperty(const std::string &name)
     : Property(name, typeid(std::vector<TimeValueUnit<TYPE>>)), m_values(),
-      m_size(), m_propSortedFlag(), m_filterApplied() {}
+      m_compressed(), m_isCompressed(false), m_size(), m_propSortedFlag(),
+      m_filterApplied(), m_intervalIndex(), m_hasIntervalIndex(false) {}
+
+/**
+ * Copy constructor. Compressed values stay compressed in the copy.
+ *  @param other :: The property to copy
+ */
+template <typename TYPE>
+TimeSeriesProperty<TYPE>::TimeSeriesProperty(
+    const TimeSeriesProperty<TYPE> &other)
+    : Property(other), ITimeSeriesProperty(other) {
+  std::lock_guard<std::mutex> lock(other.m_lazyMutex);
+  m_values = other.m_values;
+  m_compressed = other.m_compressed;
+  m_isCompressed = other.m_isCompressed.load();
+  m_intervalIndex = other.m_intervalIndex;
+  m_hasIntervalIndex = other.m_hasIntervalIndex.load();
+  m_size = other.m_size;
+  m_propSortedFlag = other.m_propSortedFlag;
+  m_filter = other.m_filter;
+  m_filterQuickRef = other.m_filterQuickRef;
+  m_filterApplied = other.m_filterApplied;
+}
 
 /// Virtual destructor
 template <typename TYPE> TimeSeriesProperty<TYPE>::~TimeSeriesProperty() {}
@@ -65,6 +113,7 @@ TimeSeriesProperty<TYPE>::cloneWithTimeShift(const double timeShift) const {
 template <typename TYPE>
 std::unique_ptr<TimeSeriesProperty<double>>
 TimeSeriesProperty<TYPE>::getDerivative() const {
+  decompress();
 
   if (this->m_values.size() < 2) {
     throw std::runtime_error("Derivative is not defined for a time-series "
@@ -107,8 +156,23 @@ TimeSeriesProperty<std::string>::getDerivative() const {
  * */
 template <typename TYPE>
 size_t TimeSeriesProperty<TYPE>::getMemorySize() const {
+  if (isCompressed()) {
+    std::lock_guard<std::mutex> lock(m_lazyMutex);
+    if (isCompressed())
+      return m_compressed.timeDeltas.size() +
+             m_compressed.runValues.size() * sizeof(TYPE) +
+             m_compressed.runLengths.size() * sizeof(uint32_t);
+  }
   // Rough estimate
-  return m_values.size() * (sizeof(TYPE) + sizeof(DateAndTime));
+  size_t size = m_values.size() * (sizeof(TYPE) + sizeof(DateAndTime));
+  if (m_hasIntervalIndex) {
+    std::lock_guard<std::mutex> lock(m_lazyMutex);
+    size += (m_intervalIndex.integral.size() +
+             m_intervalIndex.integralOfSquares.size()) *
+                sizeof(double) +
+            m_intervalIndex.minMax.size() * sizeof(std::pair<double, double>);
+  }
+  return size;
 }
 
 /**
@@ -134,6 +198,9 @@ operator+=(Property const *right) {
 
   if (rhs) {
     if (this->operator!=(*rhs)) {
+      decompress();
+      rhs->decompress();
+      clearIntervalIndex();
       m_values.insert(m_values.end(), rhs->m_values.begin(),
                       rhs->m_values.end());
       m_propSortedFlag = TimeSeriesSortStatus::TSUNKNOWN;
@@ -260,6 +327,8 @@ void TimeSeriesProperty<TYPE>::setName(const std::string name) {
 template <typename TYPE>
 void TimeSeriesProperty<TYPE>::filterByTime(const Kernel::DateAndTime &start,
                                             const Kernel::DateAndTime &stop) {
+  decompress();
+  clearIntervalIndex();
   // 0. Sort
   sort();
 
@@ -318,6 +387,8 @@ void TimeSeriesProperty<TYPE>::filterByTime(const Kernel::DateAndTime &start,
 template <typename TYPE>
 void TimeSeriesProperty<TYPE>::filterByTimes(
     const std::vector<SplittingInterval> &splittervec) {
+  decompress();
+  clearIntervalIndex();
   // 1. Sort
   sort();
 
@@ -405,6 +476,7 @@ template <typename TYPE>
 void TimeSeriesProperty<TYPE>::splitByTime(
     std::vector<SplittingInterval> &splitter, std::vector<Property *> outputs,
     bool isPeriodic) const {
+  decompress();
   // 0. Sort if necessary
   sort();
 
@@ -420,13 +492,12 @@ void TimeSeriesProperty<TYPE>::splitByTime(
         dynamic_cast<TimeSeriesProperty<TYPE> *>(outputs[i]);
     if (myOutput) {
       outputs_tsp.push_back(myOutput);
+      // The values written below replace any compressed ones
+      myOutput->clear();
       if (this->m_values.size() == 1) {
         // Special case for TSP with a single entry = just copy.
         myOutput->m_values = this->m_values;
         myOutput->m_size = 1;
-      } else {
-        myOutput->m_values.clear();
-        myOutput->m_size = 0;
       }
     } else {
       outputs_tsp.push_back(nullptr);
@@ -555,6 +626,7 @@ template <typename TYPE>
 void TimeSeriesProperty<TYPE>::makeFilterByValue(
     std::vector<SplittingInterval> &split, double min, double max,
     double TimeTolerance, bool centre) const {
+  decompress();
   const bool emptyMin = (min == EMPTY_DBL());
   const bool emptyMax = (max == EMPTY_DBL());
 
@@ -714,6 +786,7 @@ void TimeSeriesProperty<std::string>::expandFilterToRange(
 template <typename TYPE>
 double TimeSeriesProperty<TYPE>::averageValueInFilter(
     const std::vector<SplittingInterval> &filter) const {
+  decompress();
   // TODO: Consider logs that aren't giving starting values.
 
   // First of all, if the log or the filter is empty, return NaN
@@ -726,10 +799,19 @@ double TimeSeriesProperty<TYPE>::averageValueInFilter(
     return static_cast<double>(m_values.front().value());
   }
 
+  double numerator(0.0), totalTime(0.0);
+  if (m_hasIntervalIndex) {
+    for (const auto &time : filter) {
+      totalTime += time.duration();
+      numerator += integralsUpTo(m_intervalIndex, time.stop()).first -
+                   integralsUpTo(m_intervalIndex, time.start()).first;
+    }
+    return m_intervalIndex.shift + numerator / totalTime;
+  }
+
   // Sort, if necessary.
   sort();
 
-  double numerator(0.0), totalTime(0.0);
   // Loop through the filter ranges
   for (const auto &time : filter) {
     // Calculate the total time duration (in seconds) within by the filter
@@ -774,6 +856,211 @@ double TimeSeriesProperty<TYPE>::timeAverageValue() const {
   return retVal;
 }
 
+/** Index the log so that averageValueInFilter and getStatisticsInInterval
+ * take O(log n) instead of O(n). The index takes 48 bytes per entry,
+ * is counted by getMemorySize and is kept until the values change or
+ * clearIntervalIndex is called, so only build it for logs that are queried
+ * many times. Const methods may call this from several threads: only the
+ * first one builds it.
+ */
+template <typename TYPE>
+void TimeSeriesProperty<TYPE>::buildIntervalIndex() const {
+  decompress();
+  if (m_hasIntervalIndex)
+    return;
+  std::lock_guard<std::mutex> lock(m_lazyMutex);
+  sort();
+  if (m_values.empty() || m_hasIntervalIndex)
+    return;
+  m_intervalIndex = makeIntervalIndex();
+  m_hasIntervalIndex = true;
+}
+
+/** Free the index made by buildIntervalIndex
+ */
+template <typename TYPE>
+void TimeSeriesProperty<TYPE>::clearIntervalIndex() const {
+  if (m_hasIntervalIndex) {
+    std::lock_guard<std::mutex> lock(m_lazyMutex);
+    m_intervalIndex = IntervalIndex();
+    m_hasIntervalIndex = false;
+  }
+}
+
+/** Create the running integrals and the segment tree of extrema of the
+ * values. Each value is taken to hold from its own time up to the time of
+ * the next one. The values are integrated relative to their mean, which
+ * keeps the variance accurate when it is small compared to the values
+ * themselves. The log must be sorted and not empty.
+ *  @return The index of the current values
+ */
+template <typename TYPE>
+typename TimeSeriesProperty<TYPE>::IntervalIndex
+TimeSeriesProperty<TYPE>::makeIntervalIndex() const {
+  const size_t nvalues = m_values.size();
+  IntervalIndex index;
+  for (const auto &entry : m_values)
+    index.shift += static_cast<double>(entry.value());
+  index.shift /= static_cast<double>(nvalues);
+  index.integral.resize(nvalues);
+  index.integralOfSquares.resize(nvalues);
+  index.minMax.resize(2 * nvalues);
+  double integral(0.0), integralOfSquares(0.0);
+  for (size_t i = 0; i < nvalues; ++i) {
+    const auto value = static_cast<double>(m_values[i].value());
+    index.integral[i] = integral;
+    index.integralOfSquares[i] = integralOfSquares;
+    index.minMax[nvalues + i] = std::make_pair(value, value);
+    if (i + 1 < nvalues) {
+      const double dt = DateAndTime::secondsFromDuration(
+          m_values[i + 1].time() - m_values[i].time());
+      const double shifted = value - index.shift;
+      integral += shifted * dt;
+      integralOfSquares += shifted * shifted * dt;
+    }
+  }
+  for (size_t node = nvalues - 1; node > 0; --node) {
+    const auto &left = index.minMax[2 * node];
+    const auto &right = index.minMax[2 * node + 1];
+    index.minMax[node] = std::make_pair(std::min(left.first, right.first),
+                                        std::max(left.second, right.second));
+  }
+  return index;
+}
+
+/** Function specialization for TimeSeriesProperty<std::string>
+ *  @throws Kernel::Exception::NotImplementedError always
+ */
+template <>
+TimeSeriesProperty<std::string>::IntervalIndex
+TimeSeriesProperty<std::string>::makeIntervalIndex() const {
+  throw Exception::NotImplementedError("TimeSeriesProperty::"
+                                       "getStatisticsInInterval is not "
+                                       "implemented for string properties");
+}
+
+/** Returns the time integrals of the value less the shift of the index, and
+ * of its square, from the first entry up to the given time. Like
+ * getSingleValue, the first value is assumed to hold before the first entry
+ * and the last value after the last one, so the result is negative for times
+ * before the first entry. The index must be up to date and the log must not
+ * be empty.
+ *  @param index :: The index of the current values
+ *  @param time :: The upper limit of the integrals
+ *  @return The pair (integral of shifted value, integral of its square)
+ */
+template <typename TYPE>
+std::pair<double, double>
+TimeSeriesProperty<TYPE>::integralsUpTo(const IntervalIndex &index,
+                                        const DateAndTime &time) const {
+  auto next = std::upper_bound(
+      m_values.begin(), m_values.end(), time,
+      [](const DateAndTime &t, const TimeValueUnit<TYPE> &entry) {
+        return t < entry.time();
+      });
+  // The entry in force at that time, or the first one
+  size_t i = static_cast<size_t>(next - m_values.begin());
+  if (i > 0)
+    --i;
+  const double value = index.minMax[m_values.size() + i].first - index.shift;
+  const double dt = DateAndTime::secondsFromDuration(time - m_values[i].time());
+  return std::make_pair(index.integral[i] + value * dt,
+                        index.integralOfSquares[i] + value * value * dt);
+}
+
+/** Returns the statistics of the log within a time interval, weighting each
+ * value by how long it was held. This takes O(log n) after
+ * buildIntervalIndex; otherwise an index is made for this query and freed.
+ * The median cannot be found this way and is always NaN.
+ *  @param interval :: The time interval to look at
+ *  @return The time-weighted statistics; all NaN for an empty log
+ */
+template <typename TYPE>
+TimeSeriesPropertyStatistics TimeSeriesProperty<TYPE>::getStatisticsInInterval(
+    const TimeInterval &interval) const {
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  TimeSeriesPropertyStatistics out;
+  out.median = nan;
+  out.duration = DateAndTime::secondsFromDuration(interval.length());
+  decompress();
+  if (m_values.empty()) {
+    out.minimum = out.maximum = out.mean = out.standard_deviation = nan;
+    return out;
+  }
+  const IntervalIndex *index = &m_intervalIndex;
+  IntervalIndex localIndex;
+  if (!m_hasIntervalIndex) {
+    {
+      std::lock_guard<std::mutex> lock(m_lazyMutex);
+      sort();
+    }
+    localIndex = makeIntervalIndex();
+    index = &localIndex;
+  }
+
+  // Extrema of the values held at any time in [begin, end)
+  const size_t nvalues = m_values.size();
+  const auto held = std::upper_bound(
+      m_values.begin(), m_values.end(), interval.begin(),
+      [](const DateAndTime &t, const TimeValueUnit<TYPE> &entry) {
+        return t < entry.time();
+      });
+  // The entry in force at that time, or the first one
+  size_t first = static_cast<size_t>(held - m_values.begin());
+  if (first > 0)
+    --first;
+  const auto stop = std::lower_bound(
+      m_values.begin(), m_values.end(), interval.end(),
+      [](const TimeValueUnit<TYPE> &entry, const DateAndTime &t) {
+        return entry.time() < t;
+      });
+  size_t last = static_cast<size_t>(stop - m_values.begin());
+  last = last > first + 1 ? last - 1 : first;
+  out.minimum = std::numeric_limits<double>::max();
+  out.maximum = std::numeric_limits<double>::lowest();
+  for (size_t lo = first + nvalues, hi = last + nvalues + 1; lo < hi;
+       lo /= 2, hi /= 2) {
+    if (lo & 1) {
+      out.minimum = std::min(out.minimum, index->minMax[lo].first);
+      out.maximum = std::max(out.maximum, index->minMax[lo].second);
+      ++lo;
+    }
+    if (hi & 1) {
+      --hi;
+      out.minimum = std::min(out.minimum, index->minMax[hi].first);
+      out.maximum = std::max(out.maximum, index->minMax[hi].second);
+    }
+  }
+
+  if (out.duration > 0.0) {
+    const auto upToBegin = integralsUpTo(*index, interval.begin());
+    const auto upToEnd = integralsUpTo(*index, interval.end());
+    // Mean and variance of the values relative to the shift
+    const double mean = (upToEnd.first - upToBegin.first) / out.duration;
+    const double meanOfSquares =
+        (upToEnd.second - upToBegin.second) / out.duration;
+    out.mean = index->shift + mean;
+    out.standard_deviation =
+        std::sqrt(std::max(meanOfSquares - mean * mean, 0.0));
+  } else {
+    out.mean = index->minMax[first + nvalues].first;
+    out.standard_deviation = 0.0;
+  }
+  return out;
+}
+
+/** Function specialization for TimeSeriesProperty<std::string>
+ *  @throws Kernel::Exception::NotImplementedError always
+ */
+template <>
+TimeSeriesPropertyStatistics
+TimeSeriesProperty<std::string>::getStatisticsInInterval(
+    const TimeInterval &) const {
+  throw Exception::NotImplementedError("TimeSeriesProperty::"
+                                       "getStatisticsInInterval is not "
+                                       "implemented for string properties");
+}
+
 /** Function specialization for TimeSeriesProperty<std::string>
  *  @throws Kernel::Exception::NotImplementedError always
  */
@@ -802,6 +1089,7 @@ double TimeSeriesProperty<std::string>::averageValueInFilter(
 template <typename TYPE>
 std::map<DateAndTime, TYPE>
 TimeSeriesProperty<TYPE>::valueAsCorrectMap() const {
+  decompress();
   // 1. Sort if necessary
   sort();
 
@@ -822,6 +1110,7 @@ TimeSeriesProperty<TYPE>::valueAsCorrectMap() const {
  */
 template <typename TYPE>
 std::vector<TYPE> TimeSeriesProperty<TYPE>::valuesAsVector() const {
+  decompress();
   sort();
 
   std::vector<TYPE> out;
@@ -842,6 +1131,7 @@ std::vector<TYPE> TimeSeriesProperty<TYPE>::valuesAsVector() const {
 template <typename TYPE>
 std::multimap<DateAndTime, TYPE>
 TimeSeriesProperty<TYPE>::valueAsMultiMap() const {
+  decompress();
   std::multimap<DateAndTime, TYPE> asMultiMap;
 
   if (!m_values.empty()) {
@@ -859,6 +1149,7 @@ TimeSeriesProperty<TYPE>::valueAsMultiMap() const {
  */
 template <typename TYPE>
 std::vector<DateAndTime> TimeSeriesProperty<TYPE>::timesAsVector() const {
+  decompress();
   sort();
 
   std::vector<DateAndTime> out;
@@ -877,6 +1168,7 @@ std::vector<DateAndTime> TimeSeriesProperty<TYPE>::timesAsVector() const {
  */
 template <typename TYPE>
 std::vector<double> TimeSeriesProperty<TYPE>::timesAsVectorSeconds() const {
+  decompress();
   // 1. Sort if necessary
   sort();
 
@@ -900,6 +1192,8 @@ std::vector<double> TimeSeriesProperty<TYPE>::timesAsVectorSeconds() const {
 template <typename TYPE>
 void TimeSeriesProperty<TYPE>::addValue(const Kernel::DateAndTime &time,
                                         const TYPE value) {
+  decompress();
+  clearIntervalIndex();
   TimeValueUnit<TYPE> newvalue(time, value);
   // Add the value to the back of the vector
   m_values.push_back(newvalue);
@@ -960,6 +1254,8 @@ template <typename TYPE>
 void TimeSeriesProperty<TYPE>::addValues(
     const std::vector<Kernel::DateAndTime> &times,
     const std::vector<TYPE> &values) {
+  decompress();
+  clearIntervalIndex();
   size_t length = std::min(times.size(), values.size());
   m_size += static_cast<int>(length);
   for (size_t i = 0; i < length; ++i) {
@@ -989,6 +1285,7 @@ void TimeSeriesProperty<TYPE>::replaceValues(
  */
 template <typename TYPE>
 DateAndTime TimeSeriesProperty<TYPE>::lastTime() const {
+  decompress();
   if (m_values.empty()) {
     const std::string error("lastTime(): TimeSeriesProperty '" + name() +
                             "' is empty");
@@ -1005,6 +1302,7 @@ DateAndTime TimeSeriesProperty<TYPE>::lastTime() const {
  *  @return Value
  */
 template <typename TYPE> TYPE TimeSeriesProperty<TYPE>::firstValue() const {
+  decompress();
   if (m_values.empty()) {
     const std::string error("firstValue(): TimeSeriesProperty '" + name() +
                             "' is empty");
@@ -1022,6 +1320,7 @@ template <typename TYPE> TYPE TimeSeriesProperty<TYPE>::firstValue() const {
  */
 template <typename TYPE>
 DateAndTime TimeSeriesProperty<TYPE>::firstTime() const {
+  decompress();
   if (m_values.empty()) {
     const std::string error("firstTime(): TimeSeriesProperty '" + name() +
                             "' is empty");
@@ -1039,6 +1338,7 @@ DateAndTime TimeSeriesProperty<TYPE>::firstTime() const {
  *  @return Value
  */
 template <typename TYPE> TYPE TimeSeriesProperty<TYPE>::lastValue() const {
+  decompress();
   if (m_values.empty()) {
     const std::string error("lastValue(): TimeSeriesProperty '" + name() +
                             "' is empty");
@@ -1052,11 +1352,13 @@ template <typename TYPE> TYPE TimeSeriesProperty<TYPE>::lastValue() const {
 }
 
 template <typename TYPE> TYPE TimeSeriesProperty<TYPE>::minValue() const {
+  decompress();
   return std::min_element(m_values.begin(), m_values.end(),
                           TimeValueUnit<TYPE>::valueCmp)->value();
 }
 
 template <typename TYPE> TYPE TimeSeriesProperty<TYPE>::maxValue() const {
+  decompress();
   return std::max_element(m_values.begin(), m_values.end(),
                           TimeValueUnit<TYPE>::valueCmp)->value();
 }
@@ -1072,6 +1374,11 @@ template <typename TYPE> int TimeSeriesProperty<TYPE>::size() const {
  * the number of entries, including repeated ones.
  */
 template <typename TYPE> int TimeSeriesProperty<TYPE>::realSize() const {
+  if (isCompressed()) {
+    std::lock_guard<std::mutex> lock(m_lazyMutex);
+    if (isCompressed())
+      return static_cast<int>(m_compressed.size);
+  }
   return static_cast<int>(m_values.size());
 }
 
@@ -1080,6 +1387,7 @@ template <typename TYPE> int TimeSeriesProperty<TYPE>::realSize() const {
  * @return time series property as a string
  */
 template <typename TYPE> std::string TimeSeriesProperty<TYPE>::value() const {
+  decompress();
   sort();
 
   std::stringstream ins;
@@ -1104,6 +1412,7 @@ template <typename TYPE> std::string TimeSeriesProperty<TYPE>::value() const {
  */
 template <typename TYPE>
 std::vector<std::string> TimeSeriesProperty<TYPE>::time_tValue() const {
+  decompress();
   sort();
 
   std::vector<std::string> values;
@@ -1127,6 +1436,7 @@ std::vector<std::string> TimeSeriesProperty<TYPE>::time_tValue() const {
  */
 template <typename TYPE>
 std::map<DateAndTime, TYPE> TimeSeriesProperty<TYPE>::valueAsMap() const {
+  decompress();
   // 1. Sort if necessary
   sort();
 
@@ -1178,6 +1488,9 @@ TimeSeriesProperty<TYPE>::setDataItem(const boost::shared_ptr<DataItem>) {
 template <typename TYPE> void TimeSeriesProperty<TYPE>::clear() {
   m_size = 0;
   m_values.clear();
+  m_compressed = Compressed();
+  m_isCompressed = false;
+  clearIntervalIndex();
 
   m_propSortedFlag = TimeSeriesSortStatus::TSSORTED;
   m_filterApplied = false;
@@ -1190,6 +1503,8 @@ template <typename TYPE> void TimeSeriesProperty<TYPE>::clear() {
  *  It is up to the client to call sort() first if this is a requirement.
  */
 template <typename TYPE> void TimeSeriesProperty<TYPE>::clearOutdated() {
+  decompress();
+  clearIntervalIndex();
   if (realSize() > 1) {
     auto lastValue = m_values.back();
     clear();
@@ -1233,6 +1548,8 @@ void TimeSeriesProperty<TYPE>::create(const Kernel::DateAndTime &start_time,
 template <typename TYPE>
 void TimeSeriesProperty<TYPE>::create(const std::vector<DateAndTime> &new_times,
                                       const std::vector<TYPE> &new_values) {
+  decompress();
+  clearIntervalIndex();
   if (new_times.size() != new_values.size())
     throw std::invalid_argument("TimeSeriesProperty::create: mismatched size "
                                 "for the time and values vectors.");
@@ -1263,6 +1580,7 @@ void TimeSeriesProperty<TYPE>::create(const std::vector<DateAndTime> &new_times,
  */
 template <typename TYPE>
 TYPE TimeSeriesProperty<TYPE>::getSingleValue(const DateAndTime &t) const {
+  decompress();
   if (m_values.empty()) {
     const std::string error("getSingleValue(): TimeSeriesProperty '" + name() +
                             "' is empty");
@@ -1312,6 +1630,7 @@ TYPE TimeSeriesProperty<TYPE>::getSingleValue(const DateAndTime &t) const {
 template <typename TYPE>
 TYPE TimeSeriesProperty<TYPE>::getSingleValue(const DateAndTime &t,
                                               int &index) const {
+  decompress();
   if (m_values.empty()) {
     const std::string error("getSingleValue(): TimeSeriesProperty '" + name() +
                             "' is empty");
@@ -1367,6 +1686,7 @@ TYPE TimeSeriesProperty<TYPE>::getSingleValue(const DateAndTime &t,
  */
 template <typename TYPE>
 TimeInterval TimeSeriesProperty<TYPE>::nthInterval(int n) const {
+  decompress();
   // 0. Throw exception
   if (m_values.empty()) {
     const std::string error("nthInterval(): TimeSeriesProperty '" + name() +
@@ -1484,6 +1804,7 @@ TimeInterval TimeSeriesProperty<TYPE>::nthInterval(int n) const {
  *  @return Value
  */
 template <typename TYPE> TYPE TimeSeriesProperty<TYPE>::nthValue(int n) const {
+  decompress();
   TYPE value;
 
   // 1. Throw error if property is empty
@@ -1541,6 +1862,7 @@ template <typename TYPE> TYPE TimeSeriesProperty<TYPE>::nthValue(int n) const {
  */
 template <typename TYPE>
 Kernel::DateAndTime TimeSeriesProperty<TYPE>::nthTime(int n) const {
+  decompress();
   sort();
 
   if (m_values.empty()) {
@@ -1576,6 +1898,7 @@ Kernel::DateAndTime TimeSeriesProperty<TYPE>::nthTime(int n) const {
 template <typename TYPE>
 void TimeSeriesProperty<TYPE>::filterWith(
     const TimeSeriesProperty<bool> *filter) {
+  decompress();
   // 1. Clear the current
   m_filter.clear();
   m_filterQuickRef.clear();
@@ -1654,6 +1977,7 @@ template <typename TYPE> void TimeSeriesProperty<TYPE>::clearFilter() {
  * Updates size()
  */
 template <typename TYPE> void TimeSeriesProperty<TYPE>::countSize() const {
+  decompress();
   if (m_filter.empty()) {
     // 1. Not filter
     m_size = int(m_values.size());
@@ -1731,6 +2055,8 @@ TimeSeriesPropertyStatistics TimeSeriesProperty<TYPE>::getStatistics() const {
  * If there is any, keep one of them
  */
 template <typename TYPE> void TimeSeriesProperty<TYPE>::eliminateDuplicates() {
+  decompress();
+  clearIntervalIndex();
   // 1. Sort if necessary
   sort();
 
@@ -1773,6 +2099,7 @@ template <typename TYPE> void TimeSeriesProperty<TYPE>::eliminateDuplicates() {
  */
 template <typename TYPE>
 std::string TimeSeriesProperty<TYPE>::toString() const {
+  decompress();
   std::stringstream ss;
   for (size_t i = 0; i < m_values.size(); ++i)
     ss << m_values[i].time() << "\t\t" << m_values[i].value() << "\n";
@@ -1789,6 +2116,7 @@ std::string TimeSeriesProperty<TYPE>::toString() const {
  * Sort vector mP and set the flag
  */
 template <typename TYPE> void TimeSeriesProperty<TYPE>::sort() const {
+  decompress();
   if (m_propSortedFlag == TimeSeriesSortStatus::TSUNKNOWN) {
     bool sorted = is_sorted(m_values.begin(), m_values.end());
     if (sorted)
@@ -1813,6 +2141,7 @@ template <typename TYPE> void TimeSeriesProperty<TYPE>::sort() const {
  */
 template <typename TYPE>
 int TimeSeriesProperty<TYPE>::findIndex(Kernel::DateAndTime t) const {
+  decompress();
   // 0. Return with an empty container
   if (m_values.empty())
     return 0;
@@ -1848,6 +2177,7 @@ int TimeSeriesProperty<TYPE>::findIndex(Kernel::DateAndTime t) const {
 template <typename TYPE>
 int TimeSeriesProperty<TYPE>::upperBound(Kernel::DateAndTime t, int istart,
                                          int iend) const {
+  decompress();
   // 0. Check validity
   if (istart < 0) {
     throw std::invalid_argument("Start Index cannot be less than 0");
@@ -1893,6 +2223,7 @@ int TimeSeriesProperty<TYPE>::upperBound(Kernel::DateAndTime t, int istart,
  *altered
  */
 template <typename TYPE> void TimeSeriesProperty<TYPE>::applyFilter() const {
+  decompress();
   // 1. Check and reset
   if (m_filterApplied)
     return;
@@ -2049,6 +2380,10 @@ TimeSeriesProperty<TYPE>::setValueFromProperty(const Property &right) {
     return "Could not set value: properties have different type.";
   }
   m_values = prop->m_values;
+  m_compressed = prop->m_compressed;
+  m_isCompressed = prop->m_isCompressed.load();
+  m_intervalIndex = prop->m_intervalIndex;
+  m_hasIntervalIndex = prop->m_hasIntervalIndex.load();
   m_size = prop->m_size;
   m_propSortedFlag = prop->m_propSortedFlag;
   m_filter = prop->m_filter;
@@ -2057,6 +2392,73 @@ TimeSeriesProperty<TYPE>::setValueFromProperty(const Property &right) {
   return "";
 }
 
+/** Replace the values by a compact representation: the times as
+ * variable-length encoded differences to the previous time and the values as
+ * runs of equal values. Logs that change rarely or are sampled at a steady
+ * rate shrink considerably. The values are transparently decompressed again
+ * by the first method that needs to access them, so this is only worthwhile
+ * for logs that are kept but seldom used. The order of the entries, and hence
+ * any filter, is unaffected.
+ */
+template <typename TYPE> void TimeSeriesProperty<TYPE>::compress() {
+  if (m_values.empty() || isCompressed())
+    return;
+
+  Compressed packed;
+  packed.size = m_values.size();
+  packed.timeDeltas.reserve(m_values.size());
+  uint64_t previous = 0;
+  for (const auto &entry : m_values) {
+    const uint64_t current = entry.time().totalNanoseconds();
+    appendVarInt(packed.timeDeltas, static_cast<int64_t>(current - previous));
+    previous = current;
+
+    if (packed.runLengths.empty() || entry.value() != packed.runValues.back() ||
+        packed.runLengths.back() == std::numeric_limits<uint32_t>::max()) {
+      packed.runValues.push_back(entry.value());
+      packed.runLengths.push_back(1);
+    } else {
+      ++packed.runLengths.back();
+    }
+  }
+  packed.timeDeltas.shrink_to_fit();
+  packed.runValues.shrink_to_fit();
+  packed.runLengths.shrink_to_fit();
+
+  m_compressed = std::move(packed);
+  m_isCompressed = true;
+  std::vector<TimeValueUnit<TYPE>>().swap(m_values);
+  clearIntervalIndex();
+}
+
+/** Restore m_values from the compressed form created by compress(). Does
+ * nothing if the values are not compressed. Const methods may call this from
+ * several threads: the first one decompresses and the others wait for it.
+ */
+template <typename TYPE> void TimeSeriesProperty<TYPE>::decompress() const {
+  if (!isCompressed())
+    return;
+  std::lock_guard<std::mutex> lock(m_lazyMutex);
+  if (!isCompressed())
+    return;
+
+  std::vector<TimeValueUnit<TYPE>> values;
+  values.reserve(m_compressed.size);
+  const uint8_t *delta = m_compressed.timeDeltas.data();
+  uint64_t time = 0;
+  for (size_t run = 0; run < m_compressed.runValues.size(); ++run) {
+    const TYPE &value = m_compressed.runValues[run];
+    for (uint32_t i = 0; i < m_compressed.runLengths[run]; ++i) {
+      time += static_cast<uint64_t>(readVarInt(delta));
+      values.emplace_back(DateAndTime(static_cast<int64_t>(time)), value);
+    }
+  }
+
+  m_values.swap(values);
+  m_compressed = Compressed();
+  m_isCompressed = false;
+}
+
 //----------------------------------------------------------------------------------------------
 /** Saves the time vector has time + start attribute */
 template <typename TYPE>
@@ -2153,6 +2555,7 @@ template <typename TYPE>
 void TimeSeriesProperty<TYPE>::histogramData(
     const Kernel::DateAndTime &tMin, const Kernel::DateAndTime &tMax,
     std::vector<double> &counts) const {
+  decompress();
 
   size_t nPoints = counts.size();
   if (nPoints == 0)
@@ -6,6 +6,7 @@
 #include "MantidKernel/PhysicalConstants.h"
 #include "MantidKernel/UnitFactory.h"
 #include "MantidKernel/UnitLabelTypes.h"
+#include <algorithm>
 #include <cfloat>
 
 namespace Mantid {
@@ -139,9 +140,7 @@ void Unit::toTOF(std::vector<double> &xdata, std::vector<double> &ydata,
                  const double &_delta) {
   UNUSED_ARG(ydata);
   this->initialize(_l1, _l2, _twoTheta, _emode, _efixed, _delta);
-  size_t numX = xdata.size();
-  for (size_t i = 0; i < numX; i++)
-    xdata[i] = this->singleToTOF(xdata[i]);
+  this->manyToTOF(xdata.data(), xdata.size());
 }
 
 /** Convert a single value to TOF
@@ -170,9 +169,7 @@ void Unit::fromTOF(std::vector<double> &xdata, std::vector<double> &ydata,
                    const double &_efixed, const double &_delta) {
   UNUSED_ARG(ydata);
   this->initialize(_l1, _l2, _twoTheta, _emode, _efixed, _delta);
-  size_t numX = xdata.size();
-  for (size_t i = 0; i < numX; i++)
-    xdata[i] = this->singleFromTOF(xdata[i]);
+  this->manyFromTOF(xdata.data(), xdata.size());
 }
 
 /** Convert a single value from TOF
@@ -192,6 +189,24 @@ double Unit::convertSingleFromTOF(const double xvalue, const double &l1,
   return this->singleFromTOF(xvalue);
 }
 
+/** Convert many values to TOF in place, one at a time with singleToTOF()
+ * @param values :: the values to convert
+ * @param count :: the number of values
+ */
+void Unit::manyToTOF(double *values, const size_t count) const {
+  for (size_t i = 0; i < count; ++i)
+    values[i] = this->singleToTOF(values[i]);
+}
+
+/** Convert many tof values in place, one at a time with singleFromTOF()
+ * @param values :: the values to convert
+ * @param count :: the number of values
+ */
+void Unit::manyFromTOF(double *values, const size_t count) const {
+  for (size_t i = 0; i < count; ++i)
+    values[i] = this->singleFromTOF(values[i]);
+}
+
 std::pair<double, double> Unit::conversionRange() const {
   double u1 = this->singleFromTOF(this->conversionTOFMin());
   double u2 = this->singleFromTOF(this->conversionTOFMax());
@@ -288,6 +303,18 @@ double TOF::singleFromTOF(const double tof) const {
   return tof;
 }
 
+void TOF::manyToTOF(double *values, const size_t count) const {
+  // Nothing to do
+  UNUSED_ARG(values);
+  UNUSED_ARG(count);
+}
+
+void TOF::manyFromTOF(double *values, const size_t count) const {
+  // Nothing to do
+  UNUSED_ARG(values);
+  UNUSED_ARG(count);
+}
+
 Unit *TOF::clone() const { return new TOF(*this); }
 double TOF::conversionTOFMin() const { return -DBL_MAX; }
 ///@return DBL_MAX as ToF convetanble to TOF for in any time range
@@ -396,6 +423,31 @@ double Wavelength::singleFromTOF(const double tof) const {
   x *= factorFrom;
   return x;
 }
+
+void Wavelength::manyToTOF(double *values, const size_t count) const {
+  // Copy the factors so that the loops can be vectorized
+  const double factor = factorTo;
+  if (emode == 1 || emode == 2) {
+    const double sfp = sfpTo;
+    for (size_t i = 0; i < count; ++i)
+      values[i] = values[i] * factor + sfp;
+  } else {
+    for (size_t i = 0; i < count; ++i)
+      values[i] *= factor;
+  }
+}
+
+void Wavelength::manyFromTOF(double *values, const size_t count) const {
+  const double factor = factorFrom;
+  if (do_sfpFrom) {
+    const double sfp = sfpFrom;
+    for (size_t i = 0; i < count; ++i)
+      values[i] = (values[i] - sfp) * factor;
+  } else {
+    for (size_t i = 0; i < count; ++i)
+      values[i] *= factor;
+  }
+}
 ///@return  Minimal time of flight, which can be reversively converted into
 /// wavelength
 double Wavelength::conversionTOFMin() const {
@@ -472,6 +524,22 @@ double Energy::singleFromTOF(const double tof) const {
   return factorFrom / (temp * temp);
 }
 
+void Energy::manyToTOF(double *values, const size_t count) const {
+  const double factor = factorTo;
+  for (size_t i = 0; i < count; ++i) {
+    const double temp = (values[i] == 0.0) ? DBL_MIN : values[i];
+    values[i] = factor / sqrt(temp);
+  }
+}
+
+void Energy::manyFromTOF(double *values, const size_t count) const {
+  const double factor = factorFrom;
+  for (size_t i = 0; i < count; ++i) {
+    const double temp = (values[i] == 0.0) ? DBL_MIN : values[i];
+    values[i] = factor / (temp * temp);
+  }
+}
+
 Unit *Energy::clone() const { return new Energy(*this); }
 
 // ============================================================================================
@@ -578,6 +646,18 @@ double dSpacing::singleToTOF(const double x) const { return x * factorTo; }
 double dSpacing::singleFromTOF(const double tof) const {
   return tof / factorFrom;
 }
+
+void dSpacing::manyToTOF(double *values, const size_t count) const {
+  const double factor = factorTo;
+  for (size_t i = 0; i < count; ++i)
+    values[i] *= factor;
+}
+
+void dSpacing::manyFromTOF(double *values, const size_t count) const {
+  const double factor = factorFrom;
+  for (size_t i = 0; i < count; ++i)
+    values[i] /= factor;
+}
 double dSpacing::conversionTOFMin() const { return 0; }
 double dSpacing::conversionTOFMax() const { return DBL_MAX / factorTo; }
 
@@ -634,6 +714,18 @@ double MomentumTransfer::singleFromTOF(const double tof) const {
   return factorFrom / temp;
 }
 
+void MomentumTransfer::manyToTOF(double *values, const size_t count) const {
+  const double factor = factorTo;
+  for (size_t i = 0; i < count; ++i)
+    values[i] = factor / ((values[i] == 0.0) ? DBL_MIN : values[i]);
+}
+
+void MomentumTransfer::manyFromTOF(double *values, const size_t count) const {
+  const double factor = factorFrom;
+  for (size_t i = 0; i < count; ++i)
+    values[i] = factor / ((values[i] == 0.0) ? DBL_MIN : values[i]);
+}
+
 double MomentumTransfer::conversionTOFMin() const {
   return factorFrom / DBL_MAX;
 }
@@ -687,6 +779,22 @@ double QSquared::singleFromTOF(const double tof) const {
   return factorFrom / (temp * temp);
 }
 
+void QSquared::manyToTOF(double *values, const size_t count) const {
+  const double factor = factorTo;
+  for (size_t i = 0; i < count; ++i) {
+    const double temp = (values[i] == 0.0) ? DBL_MIN : values[i];
+    values[i] = factor / sqrt(temp);
+  }
+}
+
+void QSquared::manyFromTOF(double *values, const size_t count) const {
+  const double factor = factorFrom;
+  for (size_t i = 0; i < count; ++i) {
+    const double temp = (values[i] == 0.0) ? DBL_MIN : values[i];
+    values[i] = factor / (temp * temp);
+  }
+}
+
 double QSquared::conversionTOFMin() const {
   if (factorTo > 0)
     return factorTo / sqrt(DBL_MAX);
@@ -806,6 +914,54 @@ double DeltaE::singleFromTOF(const double tof) const {
     return DBL_MAX;
 }
 
+void DeltaE::manyToTOF(double *values, const size_t count) const {
+  const double maxTOF = DeltaE::conversionTOFMax();
+  if (emode != 1 && emode != 2) {
+    std::fill(values, values + count, maxTOF);
+    return;
+  }
+  // The energy of the neutron on the other side of the sample is efixed - x
+  // in direct geometry and efixed + x in indirect geometry
+  const double sign = (emode == 1) ? -1.0 : 1.0;
+  const double fixed = efixed;
+  const double scaling = unitScaling;
+  const double factor = factorTo;
+  const double other = t_other;
+  for (size_t i = 0; i < count; ++i) {
+    const double e = fixed + sign * values[i] / scaling;
+    // e <= 0 shouldn't ever happen (unless the efixed value is wrong)
+    values[i] = (e <= 0.0) ? maxTOF : factor / sqrt(e) + other;
+  }
+}
+
+void DeltaE::manyFromTOF(double *values, const size_t count) const {
+  if (emode != 1 && emode != 2) {
+    std::fill(values, values + count, DBL_MAX);
+    return;
+  }
+  const double fixed = efixed;
+  const double scaling = unitScaling;
+  const double factor = factorFrom;
+  const double other = t_otherFrom;
+  if (emode == 1) {
+    for (size_t i = 0; i < count; ++i) {
+      // This is t2
+      const double this_t = values[i] - other;
+      values[i] = (this_t <= 0.0)
+                      ? -DBL_MAX
+                      : (fixed - factor / (this_t * this_t)) * scaling;
+    }
+  } else {
+    for (size_t i = 0; i < count; ++i) {
+      // This is t1
+      const double this_t = values[i] - other;
+      values[i] = (this_t <= 0.0)
+                      ? DBL_MAX
+                      : (factor / (this_t * this_t) - fixed) * scaling;
+    }
+  }
+}
+
 double DeltaE::conversionTOFMin() const {
   double time(
       DBL_MAX); // impossible for elastic, this units do not work for elastic
@@ -1025,6 +1181,15 @@ double SpinEchoLength::singleFromTOF(const double tof) const {
   return x;
 }
 
+void SpinEchoLength::manyToTOF(double *values, const size_t count) const {
+  // Not the conversion of the Wavelength base class
+  Unit::manyToTOF(values, count);
+}
+
+void SpinEchoLength::manyFromTOF(double *values, const size_t count) const {
+  Unit::manyFromTOF(values, count);
+}
+
 Unit *SpinEchoLength::clone() const { return new SpinEchoLength(*this); }
 
 // ============================================================================================
@@ -1070,6 +1235,15 @@ double SpinEchoTime::singleFromTOF(const double tof) const {
   return x;
 }
 
+void SpinEchoTime::manyToTOF(double *values, const size_t count) const {
+  // Not the conversion of the Wavelength base class
+  Unit::manyToTOF(values, count);
+}
+
+void SpinEchoTime::manyFromTOF(double *values, const size_t count) const {
+  Unit::manyFromTOF(values, count);
+}
+
 Unit *SpinEchoTime::clone() const { return new SpinEchoTime(*this); }
 
 // ================================================================================
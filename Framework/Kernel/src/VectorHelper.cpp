@@ -218,6 +218,114 @@ void rebin(const std::vector<double> &xold, const std::vector<double> &yold,
   }
 }
 
+/** Computes the overlaps of the old and new bins.
+ *  @param[in] xold Old X array of data.
+ *  @param[in] xnew X array of data to rebin to.
+ *  @param[in] distribution Flag defining if the data to rebin is a
+ *distribution.
+ *  @throw invalid_argument If the new X array contains consecutive equal values
+ *and distribution is true.
+ */
+RebinOverlaps::RebinOverlaps(const std::vector<double> &xold,
+                             const std::vector<double> &xnew,
+                             bool distribution)
+    : m_sizeOld(xold.empty() ? 0 : xold.size() - 1),
+      m_firstOverlap(xnew.empty() ? 1 : xnew.size(), 0),
+      m_distribution(distribution) {
+  const size_t size_ynew = m_firstOverlap.size() - 1;
+  size_t iold = 0, inew = 0;
+  // Same walk through the bins as in rebin(), recording the weights instead of
+  // adding to the new values.
+  while ((inew < size_ynew) && (iold < m_sizeOld)) {
+    double xo_low = xold[iold];
+    double xo_high = xold[iold + 1];
+    double xn_low = xnew[inew];
+    double xn_high = xnew[inew + 1];
+    if (xn_high <= xo_low) {
+      m_firstOverlap[++inew] = m_oldIndex.size();
+    } else if (xo_high <= xn_low) {
+      iold++;
+    } else {
+      double delta = xo_high < xn_high ? xo_high : xn_high;
+      delta -= xo_low > xn_low ? xo_low : xn_low;
+      const double width = xo_high - xo_low;
+      if ((delta <= 0.0) || (width <= 0.0)) {
+        m_normalize = false;
+        break;
+      }
+      m_oldIndex.push_back(iold);
+      if (distribution) {
+        m_yWeight.push_back(delta);
+        m_eWeight.push_back(delta * width);
+      } else {
+        m_yWeight.push_back(delta / width);
+        m_eWeight.push_back(delta / width);
+      }
+      if (xn_high > xo_high) {
+        iold++;
+      } else {
+        m_firstOverlap[++inew] = m_oldIndex.size();
+      }
+    }
+  }
+  // New bins after the last overlap, or after an invalid bin, are empty.
+  for (++inew; inew <= size_ynew; ++inew)
+    m_firstOverlap[inew] = m_oldIndex.size();
+
+  if (m_normalize && distribution) {
+    m_newWidths.resize(size_ynew);
+    for (size_t i = 0; i < size_ynew; ++i) {
+      m_newWidths[i] = xnew[i + 1] - xnew[i];
+      if (m_newWidths[i] == 0.0)
+        throw std::invalid_argument(
+            "rebin: Invalid output X array, contains consecutive X values");
+    }
+  }
+}
+
+/** Rebins the data of one histogram, with the X arrays given to the
+ *constructor.
+ *  @param[in] yold Old Y array of data. Must be 1 element shorter than xold.
+ *  @param[in] eold Old error array of data. Must be same length as yold.
+ *  @param[out] ynew Y array of data to be filled. Must be 1 element shorter
+ *than xnew.
+ *  @param[out] enew Error array of data to be filled. Must be same length as
+ *ynew.
+ *  @throw runtime_error Thrown if vector sizes are inconsistent
+ */
+void RebinOverlaps::apply(const std::vector<double> &yold,
+                          const std::vector<double> &eold,
+                          std::vector<double> &ynew,
+                          std::vector<double> &enew) const {
+  if (m_sizeOld != yold.size() || m_sizeOld != eold.size())
+    throw std::runtime_error(
+        "rebin: y and error vectors should be of same size & 1 shorter than x");
+  const size_t size_ynew = m_firstOverlap.size() - 1;
+  if (size_ynew != ynew.size() || size_ynew != enew.size())
+    throw std::runtime_error(
+        "rebin: y and error vectors should be of same size & 1 shorter than x");
+
+  for (size_t inew = 0; inew < size_ynew; ++inew) {
+    double y = 0.0;
+    double e = 0.0;
+    for (size_t i = m_firstOverlap[inew]; i < m_firstOverlap[inew + 1]; ++i) {
+      const double eo = eold[m_oldIndex[i]];
+      y += yold[m_oldIndex[i]] * m_yWeight[i];
+      e += eo * eo * m_eWeight[i];
+    }
+    if (!m_normalize) {
+      ynew[inew] = y;
+      enew[inew] = e;
+    } else if (m_distribution) {
+      ynew[inew] = y / m_newWidths[inew];
+      enew[inew] = sqrt(e) / m_newWidths[inew];
+    } else {
+      ynew[inew] = y;
+      enew[inew] = sqrt(e);
+    }
+  }
+}
+
 //-------------------------------------------------------------------------------------------------
 /** Rebins histogram data according to a new output X array. Should be faster
  *than previous one.
@@ -266,6 +266,67 @@ public:
     for (size_t i = 0; i < size_t(bigNum); i++)
       delete bigData[i];
   }
+
+  //--------------------------------------------------------------------------------
+  /** Prefetched objects are loaded in the background and added to the buffer
+   */
+  void test_prefetch() {
+    DiskBuffer dbuf(100);
+    std::vector<ISaveable *> items;
+    for (size_t i = 0; i < num; i++) {
+      data[i]->clearDataFromMemory();
+      items.push_back(data[i]);
+    }
+
+    dbuf.prefetch(items);
+    dbuf.waitForPrefetch();
+    TS_ASSERT_EQUALS(dbuf.getStatistics().numPrefetched, num);
+    for (size_t i = 0; i < num; i++) {
+      TS_ASSERT(data[i]->isLoaded());
+      TS_ASSERT_EQUALS(data[i]->m_memory, 2);
+    }
+    TS_ASSERT_EQUALS(dbuf.getWriteBufferUsed(), 2 * num);
+
+    // Using a prefetched object is a hit, loading one on use a miss
+    dbuf.toWrite(data[0]);
+    dbuf.toWrite(data[0]);
+    dbuf.objectLoaded(data[1]);
+    auto statistics = dbuf.getStatistics();
+    TS_ASSERT_EQUALS(statistics.numPrefetched, num);
+    TS_ASSERT_EQUALS(statistics.numHits, 1);
+    TS_ASSERT_EQUALS(statistics.numMisses, 1);
+    TS_ASSERT_EQUALS(statistics.dataRead, 2 * num + 2);
+
+    dbuf.resetStatistics();
+    statistics = dbuf.getStatistics();
+    TS_ASSERT_EQUALS(statistics.numPrefetched, 0);
+    TS_ASSERT_EQUALS(statistics.dataRead, 0);
+  }
+
+  /** Prefetching stops when the to-write buffer is full */
+  void test_prefetch_stays_within_write_buffer() {
+    // Room for 3 objects of 2
+    DiskBuffer dbuf(6);
+    std::vector<ISaveable *> items;
+    for (size_t i = 0; i < num; i++) {
+      data[i]->clearDataFromMemory();
+      items.push_back(data[i]);
+    }
+
+    dbuf.prefetch(items);
+    dbuf.waitForPrefetch();
+    TS_ASSERT_EQUALS(dbuf.getStatistics().numPrefetched, 3);
+    TS_ASSERT(data[2]->isLoaded());
+    TS_ASSERT(!data[3]->isLoaded());
+
+    // Objects deleted or cancelled are not loaded any more
+    dbuf.objectDeleted(data[3]);
+    dbuf.cancelPrefetch();
+    dbuf.flushCache();
+    dbuf.waitForPrefetch();
+    TS_ASSERT_EQUALS(dbuf.getStatistics().numPrefetched, 3);
+    TS_ASSERT(!data[4]->isLoaded());
+  }
   ////--------------------------------------------------------------------------------
   ////--------------------------------------------------------------------------------
   ////----------TESTS FOR FREE SPACE MAPS
@@ -11,6 +11,7 @@
 using namespace Mantid::Kernel;
 
 int ThreadPoolRunnableTest_value;
+bool ThreadPoolRunnableTest_inPoolThread;
 
 class ThreadPoolRunnableTest : public CxxTest::TestSuite {
 public:
@@ -20,7 +21,10 @@ public:
 
   //=======================================================================================
   class SimpleTask : public Task {
-    void run() override { ThreadPoolRunnableTest_value = 1234; }
+    void run() override {
+      ThreadPoolRunnableTest_value = 1234;
+      ThreadPoolRunnableTest_inPoolThread = ThreadPoolRunnable::inPoolThread();
+    }
   };
 
   void test_run() {
@@ -36,6 +40,9 @@ public:
 
     // The task worked
     TS_ASSERT_EQUALS(ThreadPoolRunnableTest_value, 1234);
+    // It knew it ran in a pool thread, and the thread does not any more
+    TS_ASSERT(ThreadPoolRunnableTest_inPoolThread);
+    TS_ASSERT(!ThreadPoolRunnable::inPoolThread());
     // Nothing more in the queue.
     TS_ASSERT_EQUALS(sc->size(), 0);
     delete tpr;
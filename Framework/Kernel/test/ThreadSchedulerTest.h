@@ -6,6 +6,7 @@
 #include <MantidKernel/System.h>
 
 #include <MantidKernel/ThreadScheduler.h>
+#include <MantidKernel/ThreadSchedulerWorkStealing.h>
 #include <MantidKernel/Task.h>
 
 using namespace Mantid::Kernel;
@@ -60,6 +61,10 @@ public:
     do_basic_test(new ThreadSchedulerLargestCost());
   }
 
+  void test_basic_ThreadSchedulerWorkStealing() {
+    do_basic_test(new ThreadSchedulerWorkStealing(4));
+  }
+
   //==================================================================================================
 
   void do_test(ThreadScheduler *sc, double *costs, size_t *poppedIndices) {
@@ -115,6 +120,46 @@ public:
     do_test(sc, costs, poppedIndices);
     delete sc;
   }
+
+  void test_ThreadSchedulerWorkStealing_one_queue() {
+    // With one queue, a thread pops the newest task first
+    ThreadScheduler *sc = new ThreadSchedulerWorkStealing(1);
+    double costs[4] = {0, 1, 2, 3};
+    size_t poppedIndices[4] = {3, 2, 1, 0};
+    do_test(sc, costs, poppedIndices);
+    delete sc;
+  }
+
+  void test_ThreadSchedulerWorkStealing_places_by_cost_and_steals() {
+    ThreadSchedulerWorkStealing sc(2);
+    TS_ASSERT_EQUALS(sc.numQueues(), 2);
+    // The expensive task fills the first queue, so the cheap ones go to the
+    // second
+    TaskDoNothing *big = new TaskDoNothing(10.);
+    TaskDoNothing *small1 = new TaskDoNothing(1.);
+    TaskDoNothing *small2 = new TaskDoNothing(1.);
+    sc.push(big);
+    sc.push(small1);
+    sc.push(small2);
+    TS_ASSERT_EQUALS(sc.size(), 3);
+    TS_ASSERT_DELTA(sc.totalCost(), 12., 1e-10);
+
+    // Thread 1 takes the newest task of its own queue
+    Task *task = sc.pop(1);
+    TS_ASSERT_EQUALS(task, small2);
+    delete task;
+    // Thread 0 has its own task
+    task = sc.pop(0);
+    TS_ASSERT_EQUALS(task, big);
+    delete task;
+    // Thread 0 then steals from thread 1
+    task = sc.pop(0);
+    TS_ASSERT_EQUALS(task, small1);
+    delete task;
+    TS_ASSERT(sc.empty());
+    TS_ASSERT(!sc.pop(0));
+    TS_ASSERT(!sc.pop(1));
+  }
 };
 
 #endif /* MANTID_KERNEL_THREADSCHEDULERTEST_H_ */
@@ -4,6 +4,7 @@
 #include <cxxtest/TestSuite.h>
 #include "MantidKernel/TimeSeriesProperty.h"
 #include "MantidKernel/Exception.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/PropertyWithValue.h"
 #include "MantidKernel/TimeSplitter.h"
 
@@ -574,6 +575,26 @@ public:
     delete intLog;
   }
 
+  void test_averageValueInFilter_with_interval_index() {
+    std::unique_ptr<TimeSeriesProperty<double>> dblLog(createDoubleTSP());
+    std::unique_ptr<TimeSeriesProperty<int>> intLog(createIntegerTSP(5));
+    TimeSplitterType filter{
+        SplittingInterval(DateAndTime("2007-11-30T16:16:50"),
+                          DateAndTime("2007-11-30T16:17:03")),
+        SplittingInterval(DateAndTime("2007-11-30T16:17:12"),
+                          DateAndTime("2007-11-30T16:17:45"))};
+    const double dblAverage = dblLog->averageValueInFilter(filter);
+    const double intAverage = intLog->averageValueInFilter(filter);
+
+    dblLog->buildIntervalIndex();
+    intLog->buildIntervalIndex();
+    TS_ASSERT_DELTA(dblLog->averageValueInFilter(filter), dblAverage, 1e-10);
+    TS_ASSERT_DELTA(intLog->averageValueInFilter(filter), intAverage, 1e-10);
+
+    dblLog->clearIntervalIndex();
+    TS_ASSERT_DELTA(dblLog->averageValueInFilter(filter), dblAverage, 1e-10);
+  }
+
   void test_timeAverageValue() {
     auto dblLog = createDoubleTSP();
     auto intLog = createIntegerTSP(5);
@@ -586,6 +607,104 @@ public:
     delete intLog;
   }
 
+  void test_getStatisticsInInterval() {
+    auto dblLog = createDoubleTSP();
+
+    auto stats = dblLog->getStatisticsInInterval(
+        TimeInterval(DateAndTime("2007-11-30T16:17:05"),
+                     DateAndTime("2007-11-30T16:17:25")));
+    TS_ASSERT_DELTA(stats.mean, 7.66, 1e-6);
+    TS_ASSERT_DELTA(stats.standard_deviation, 1.573626, 1e-6);
+    TS_ASSERT_EQUALS(stats.minimum, 5.55);
+    TS_ASSERT_EQUALS(stats.maximum, 9.99);
+    TS_ASSERT_DELTA(stats.duration, 20.0, 1e-9);
+    TS_ASSERT(std::isnan(stats.median));
+
+    // The value at the end of the interval is not included
+    stats = dblLog->getStatisticsInInterval(
+        TimeInterval(DateAndTime("2007-11-30T16:17:10"),
+                     DateAndTime("2007-11-30T16:17:20")));
+    TS_ASSERT_DELTA(stats.mean, 7.55, 1e-6);
+    TS_ASSERT_EQUALS(stats.minimum, 7.55);
+    TS_ASSERT_EQUALS(stats.maximum, 7.55);
+
+    // Before and after the log the first and last values are assumed
+    stats = dblLog->getStatisticsInInterval(
+        TimeInterval(DateAndTime("2007-11-30T16:16:30"),
+                     DateAndTime("2007-11-30T16:16:50")));
+    TS_ASSERT_DELTA(stats.mean, 9.99, 1e-6);
+    TS_ASSERT_DELTA(stats.standard_deviation, 0.0, 1e-6);
+    TS_ASSERT_EQUALS(stats.minimum, 9.99);
+    TS_ASSERT_EQUALS(stats.maximum, 9.99);
+
+    // Changing the log updates the results
+    dblLog->addValue(DateAndTime("2007-11-30T16:17:40"), 0.0);
+    stats = dblLog->getStatisticsInInterval(
+        TimeInterval(DateAndTime("2007-11-30T16:17:30"),
+                     DateAndTime("2007-11-30T16:17:50")));
+    TS_ASSERT_DELTA(stats.mean, 5.275, 1e-6);
+    TS_ASSERT_EQUALS(stats.minimum, 0.0);
+    TS_ASSERT_EQUALS(stats.maximum, 10.55);
+
+    // Check the correct behaviour of empty logs
+    stats = dProp->getStatisticsInInterval(
+        TimeInterval(DateAndTime("2007-11-30T16:17:30"),
+                     DateAndTime("2007-11-30T16:17:50")));
+    TS_ASSERT(std::isnan(stats.mean));
+    TS_ASSERT(std::isnan(stats.minimum));
+
+    delete dblLog;
+  }
+
+  void test_getStatisticsInInterval_of_large_values_with_small_spread() {
+    TimeSeriesProperty<double> log("doubleProp");
+    const DateAndTime start("2007-11-30T16:17:00");
+    for (int i = 0; i < 10000; ++i)
+      log.addValue(start + static_cast<double>(i), 1e9 + (i % 2));
+
+    // Concurrent queries, first with a temporary index for each query and
+    // then with the one built by the first call to buildIntervalIndex
+    for (const bool indexed : {false, true}) {
+      std::vector<TimeSeriesPropertyStatistics> results(8);
+      PARALLEL_FOR_NO_WSP_CHECK()
+      for (int i = 0; i < 8; ++i) {
+        if (indexed)
+          log.buildIntervalIndex();
+        results[i] =
+            log.getStatisticsInInterval(TimeInterval(start, start + 1000.0));
+      }
+      for (const auto &stats : results) {
+        TS_ASSERT_DELTA(stats.mean, 1e9 + 0.5, 1e-6);
+        TS_ASSERT_DELTA(stats.standard_deviation, 0.5, 1e-6);
+      }
+    }
+  }
+
+  void test_splitByTime_outputs_drop_their_interval_index() {
+    std::unique_ptr<TimeSeriesProperty<int>> log(createIntegerTSP(12));
+    TimeSeriesProperty<int> output("MyIntLog");
+    output.addValue("2007-11-30T16:16:00", 99);
+    output.buildIntervalIndex();
+    const TimeInterval interval(DateAndTime("2007-11-30T16:17:10"),
+                                DateAndTime("2007-11-30T16:17:40"));
+    TS_ASSERT_EQUALS(output.getStatisticsInInterval(interval).maximum, 99);
+
+    TimeSplitterType splitter{
+        SplittingInterval(interval.begin(), interval.end(), 0)};
+    log->splitByTime(splitter, {&output}, false);
+
+    const auto stats = output.getStatisticsInInterval(interval);
+    TS_ASSERT_EQUALS(stats.minimum, 2);
+    TS_ASSERT_EQUALS(stats.maximum, 4);
+  }
+
+  void test_getStatisticsInInterval_throws_for_string_property() {
+    TS_ASSERT_THROWS(sProp->getStatisticsInInterval(TimeInterval(
+                         DateAndTime("2007-11-30T16:17:30"),
+                         DateAndTime("2007-11-30T16:17:50"))),
+                     Exception::NotImplementedError);
+  }
+
   void test_averageValueInFilter_throws_for_string_property() {
     TimeSplitterType splitter;
     TS_ASSERT_THROWS(sProp->averageValueInFilter(splitter),
@@ -1805,11 +1924,108 @@ public:
     memsize = p->getMemorySize();
     TS_ASSERT_EQUALS(memsize, 128);
 
+    // The interval index holds 6 doubles for each entry until it is freed
+    p->getStatisticsInInterval(TimeInterval(
+        DateAndTime("2007-11-30T16:17:00"), DateAndTime("2007-11-30T16:27:00")));
+    TS_ASSERT_EQUALS(p->getMemorySize(), 128);
+    p->buildIntervalIndex();
+    TS_ASSERT_EQUALS(p->getMemorySize(), 128 + 8 * 6 * sizeof(double));
+    p->clearIntervalIndex();
+    TS_ASSERT_EQUALS(p->getMemorySize(), 128);
+
     delete p;
 
     return;
   }
 
+  void test_compress() {
+    // A 1kHz log that only changes value every 100 samples
+    TimeSeriesProperty<double> log("doubleProp");
+    TimeSeriesProperty<double> reference("doubleProp");
+    const DateAndTime start("2007-11-30T16:17:00");
+    for (int i = 0; i < 1000; ++i) {
+      const DateAndTime time = start + 0.001 * i;
+      log.addValue(time, static_cast<double>(i / 100));
+      reference.addValue(time, static_cast<double>(i / 100));
+    }
+    const size_t uncompressedSize = log.getMemorySize();
+
+    log.compress();
+    TS_ASSERT(log.isCompressed());
+    TS_ASSERT_EQUALS(log.realSize(), 1000);
+    TS_ASSERT_LESS_THAN(log.getMemorySize() * 3, uncompressedSize);
+
+    // Statistics decode the values again
+    TS_ASSERT_DELTA(log.timeAverageValue(), reference.timeAverageValue(),
+                    1e-10);
+    TS_ASSERT(!log.isCompressed());
+    TS_ASSERT_EQUALS(log.timesAsVector(), reference.timesAsVector());
+    TS_ASSERT_EQUALS(log.valuesAsVector(), reference.valuesAsVector());
+    TS_ASSERT_EQUALS(log.getMemorySize(), uncompressedSize);
+
+    log.compress();
+    reference.filterByTime(start + 0.25, start + 0.75);
+    log.filterByTime(start + 0.25, start + 0.75);
+    TS_ASSERT_EQUALS(log.realSize(), reference.realSize());
+    TS_ASSERT_EQUALS(log.firstValue(), reference.firstValue());
+    TS_ASSERT_EQUALS(log.lastTime(), reference.lastTime());
+  }
+
+  void test_compress_unsorted_and_string_values() {
+    TimeSeriesProperty<std::string> log("stringProp");
+    log.addValue("2007-11-30T16:17:20", "b");
+    log.addValue("2007-11-30T16:17:00", "a");
+    log.addValue("2007-11-30T16:17:10", "c");
+
+    // Compressing before sorting has to cope with times going backwards
+    log.compress();
+    TS_ASSERT(log.isCompressed());
+    TS_ASSERT_EQUALS(log.valuesAsVector(),
+                     std::vector<std::string>({"a", "c", "b"}));
+    TS_ASSERT_EQUALS(log.nthTime(2), DateAndTime("2007-11-30T16:17:20"));
+
+    log.compress();
+    log.clear();
+    TS_ASSERT(!log.isCompressed());
+    TS_ASSERT_EQUALS(log.realSize(), 0);
+  }
+
+  void test_splitByTime_replaces_compressed_outputs() {
+    std::unique_ptr<TimeSeriesProperty<int>> log(createIntegerTSP(12));
+    TimeSeriesProperty<int> output("MyIntLog");
+    output.addValue("2007-11-30T16:16:00", 99);
+    output.compress();
+
+    TimeSplitterType splitter{
+        SplittingInterval(DateAndTime("2007-11-30T16:17:10"),
+                          DateAndTime("2007-11-30T16:17:40"), 0)};
+    log->splitByTime(splitter, {&output}, false);
+
+    TS_ASSERT(!output.isCompressed());
+    TS_ASSERT_EQUALS(output.realSize(), 3);
+    TS_ASSERT_EQUALS(output.firstValue(), 2);
+  }
+
+  void test_copy_and_concurrent_reads_of_compressed_values() {
+    TimeSeriesProperty<double> log("doubleProp");
+    const DateAndTime start("2007-11-30T16:17:00");
+    for (int i = 0; i < 1000; ++i)
+      log.addValue(start + 0.001 * i, static_cast<double>(i / 100));
+    log.compress();
+
+    TimeSeriesProperty<double> copy(log);
+    TS_ASSERT(copy.isCompressed());
+
+    std::vector<double> lastValues(8);
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int i = 0; i < 8; ++i)
+      lastValues[i] = copy.lastValue();
+    for (const auto value : lastValues)
+      TS_ASSERT_EQUALS(value, 9.0);
+    TS_ASSERT(!copy.isCompressed());
+    TS_ASSERT(log.isCompressed());
+  }
+
   void test_filter_by_first_value() {
     TimeSeriesProperty<double> series("doubleProperty");
 
@@ -234,6 +234,40 @@ public:
     delete unit;
   }
 
+  void test_many_conversions_match_single_ones() {
+    std::vector<Unit *> units{new TOF,
+                              new Wavelength,
+                              new Energy,
+                              new Energy_inWavenumber,
+                              new dSpacing,
+                              new MomentumTransfer,
+                              new QSquared,
+                              new DeltaE,
+                              new DeltaE_inWavenumber,
+                              new Momentum};
+    const std::vector<double> input{0.0,    0.5,    1.0,    3.0,
+                                    20.0,   1000.0, 5000.0, 20000.0};
+    for (auto unit : units) {
+      for (int emode = 0; emode < 3; ++emode) {
+        // Energy transfer needs an inelastic mode
+        if (emode == 0 && unit->unitID().find("DeltaE") == 0)
+          continue;
+        unit->initialize(10.0, 2.0, 0.5, emode, 25.0, 0.0);
+        auto toTOF = input;
+        unit->manyToTOF(toTOF.data(), toTOF.size());
+        auto fromTOF = input;
+        unit->manyFromTOF(fromTOF.data(), fromTOF.size());
+        for (size_t i = 0; i < input.size(); ++i) {
+          TSM_ASSERT_EQUALS(unit->unitID(), toTOF[i],
+                            unit->singleToTOF(input[i]));
+          TSM_ASSERT_EQUALS(unit->unitID(), fromTOF[i],
+                            unit->singleFromTOF(input[i]));
+        }
+      }
+      delete unit;
+    }
+  }
+
   //----------------------------------------------------------------------
   // TOF tests
   //----------------------------------------------------------------------
@@ -136,6 +136,40 @@ public:
     TS_ASSERT_DELTA(bin_edges[2], 2.0, 1e-12);
   }
 
+  void test_RebinOverlaps_matches_rebin() {
+    const std::vector<double> xold{-1.0, 0.5, 1.0, 2.5, 3.0, 4.0, 7.0};
+    const std::vector<double> yold{2.0, 3.0, 5.0, 7.0, 11.0, 13.0};
+    const std::vector<double> eold{1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+    const std::vector<double> xnew{-3.0, -2.0, 0.0, 0.7, 2.0, 5.0, 9.0, 10.0};
+    for (const bool distribution : {false, true}) {
+      std::vector<double> yexpected(xnew.size() - 1);
+      std::vector<double> eexpected(xnew.size() - 1);
+      VectorHelper::rebin(xold, yold, eold, xnew, yexpected, eexpected,
+                          distribution);
+      // Output is overwritten, not added to.
+      std::vector<double> ynew(xnew.size() - 1, 1.0);
+      std::vector<double> enew(xnew.size() - 1, 1.0);
+      const VectorHelper::RebinOverlaps overlaps(xold, xnew, distribution);
+      overlaps.apply(yold, eold, ynew, enew);
+      for (size_t i = 0; i < ynew.size(); ++i) {
+        TS_ASSERT_DELTA(ynew[i], yexpected[i], 1e-12);
+        TS_ASSERT_DELTA(enew[i], eexpected[i], 1e-12);
+      }
+    }
+  }
+
+  void test_RebinOverlaps_throws_for_wrong_lengths() {
+    const std::vector<double> xold{0.0, 1.0, 2.0};
+    const std::vector<double> xnew{0.0, 2.0};
+    const VectorHelper::RebinOverlaps overlaps(xold, xnew, false);
+    std::vector<double> y(1), e(1), ynew(1), enew(1);
+    TS_ASSERT_THROWS(overlaps.apply(y, e, ynew, enew), std::runtime_error);
+    std::vector<double> y2(2), e2(2), ynew2(2), enew2(2);
+    TS_ASSERT_THROWS(overlaps.apply(y2, e2, ynew2, enew2), std::runtime_error);
+    TS_ASSERT_THROWS(VectorHelper::RebinOverlaps(xold, {0.0, 1.0, 1.0}, true),
+                     std::invalid_argument);
+  }
+
   void test_flattenContainer_EmptyInputVector() {
     const std::vector<std::vector<int>> emptyInput;
     const auto result = VectorHelper::flattenVector<int>(emptyInput);
@@ -483,6 +517,28 @@ public:
     }
   }
 
+  void testRebinOverlapsSmaller() {
+    auto size = smallerBinEdges.size() - 1;
+    const VectorHelper::RebinOverlaps overlaps(binEdges, smallerBinEdges,
+                                               false);
+    for (size_t i = 0; i < nIters; i++) {
+      std::vector<double> yout(size);
+      std::vector<double> eout(size);
+      overlaps.apply(counts, errors, yout, eout);
+    }
+  }
+
+  void testRebinOverlapsLarger() {
+    auto size = largerBinEdges.size() - 1;
+    const VectorHelper::RebinOverlaps overlaps(binEdges, largerBinEdges,
+                                               false);
+    for (size_t i = 0; i < nIters; i++) {
+      std::vector<double> yout(size);
+      std::vector<double> eout(size);
+      overlaps.apply(counts, errors, yout, eout);
+    }
+  }
+
 private:
   const size_t binSize = 10000;
   const size_t nIters = 10000;
@@ -8,6 +8,7 @@
 #include "MantidGeometry/MDGeometry/MDImplicitFunction.h"
 #include "MantidKernel/System.h"
 #include "MantidKernel/VMD.h"
+#include "MantidDataObjects/CoordTransformAligned.h"
 #include "MantidDataObjects/MDBox.h"
 #include "MantidDataObjects/MDEventFactory.h"
 #include "MantidDataObjects/MDEventWorkspace.h"
@@ -63,10 +64,21 @@ private:
   template <typename MDE, size_t nd>
   void binByIterating(typename DataObjects::MDEventWorkspace<MDE, nd>::sptr ws);
 
+  /// Whether a box lies within a single bin of a chunk
+  bool boxInSingleBin(API::IMDNode *box, const size_t *const chunkMin,
+                      const size_t *const chunkMax, size_t &linearIndex) const;
+
   /// Method to bin a single MDBox
   template <typename MDE, size_t nd>
   void binMDBox(DataObjects::MDBox<MDE, nd> *box, const size_t *const chunkMin,
-                const size_t *const chunkMax);
+                const size_t *const chunkMax, const bool inSingleBin,
+                const size_t boxIndex);
+
+  /// Method to bin the events of a MDBox with an axis-aligned transform
+  template <typename MDE, size_t nd>
+  void binMDBoxAligned(DataObjects::MDBox<MDE, nd> *box,
+                       const size_t *const chunkMin,
+                       const size_t *const chunkMax);
 
   /// The output MDHistoWorkspace
   Mantid::DataObjects::MDHistoWorkspace_sptr outWS;
@@ -75,6 +87,9 @@ private:
   /// ImplicitFunction used
   Mantid::Geometry::MDImplicitFunction *implicitFunction;
 
+  /// The transform to the output, if it is axis-aligned
+  const DataObjects::CoordTransformAligned *m_alignedTransform;
+
   /// Cached values for speed up
   size_t *indexMultiplier;
   signal_t *signals;
@@ -47,6 +47,8 @@ public:
   const std::string category() const override {
     return "MDAlgorithms\\DataHandling";
   }
+  /// Check that compressed events are not written back in place
+  std::map<std::string, std::string> validateInputs() override;
 
 private:
   /// Initialise the properties
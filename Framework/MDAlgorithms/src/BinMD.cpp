@@ -9,11 +9,13 @@
 #include "MantidDataObjects/CoordTransformAligned.h"
 #include "MantidDataObjects/MDBoxBase.h"
 #include "MantidDataObjects/MDBox.h"
+#include "MantidDataObjects/MDBoxMortonTree.h"
 #include "MantidDataObjects/MDEventFactory.h"
 #include "MantidDataObjects/MDEventWorkspace.h"
 #include "MantidDataObjects/MDHistoWorkspace.h"
 #include "MantidMDAlgorithms/BinMD.h"
 #include <boost/algorithm/string.hpp>
+#include <algorithm>
 #include "MantidKernel/EnabledWhenProperty.h"
 #include "MantidDataObjects/CoordTransformAffine.h"
 
@@ -36,8 +38,8 @@ using namespace Mantid::DataObjects;
  */
 BinMD::BinMD()
     : outWS(), prog(nullptr), implicitFunction(nullptr),
-      indexMultiplier(nullptr), signals(nullptr), errors(nullptr),
-      numEvents(nullptr) {}
+      m_alignedTransform(nullptr), indexMultiplier(nullptr), signals(nullptr),
+      errors(nullptr), numEvents(nullptr) {}
 
 //----------------------------------------------------------------------------------------------
 /** Initialize the algorithm's properties.
@@ -81,99 +83,118 @@ void BinMD::init() {
 }
 
 //----------------------------------------------------------------------------------------------
-/** Bin the contents of a MDBox
+/** Find whether the whole of a box lies in one bin of the current chunk. The
+ * cached signal of such a box is used as it is, and its events are not read.
  *
- * @param box :: pointer to the MDBox to bin
+ * @param box :: the box to check
  * @param chunkMin :: the minimum index in each dimension to consider "valid"
  *(inclusive)
  * @param chunkMax :: the maximum index in each dimension to consider "valid"
  *(exclusive)
+ * @param linearIndex :: set to the linear index of the bin of the box
+ * @return true if the box is within a single bin
  */
-template <typename MDE, size_t nd>
-inline void BinMD::binMDBox(MDBox<MDE, nd> *box, const size_t *const chunkMin,
-                            const size_t *const chunkMax) {
-  // An array to hold the rotated/transformed coordinates
-  auto outCenter = new coord_t[m_outD];
-
-  // Evaluate whether the entire box is in the same bin
-  if (box->getNPoints() > (1 << nd) * 2) {
-    // There is a check that the number of events is enough for it to make sense
-    // to do all this processing.
-    size_t numVertexes = 0;
-    coord_t *vertexes = box->getVertexesArray(numVertexes);
-
-    // All vertexes have to be within THE SAME BIN = have the same linear index.
-    size_t lastLinearIndex = 0;
-    bool badOne = false;
-
-    for (size_t i = 0; i < numVertexes; i++) {
-      // Cache the center of the event (again for speed)
-      const coord_t *inCenter = vertexes + i * nd;
-
-      // Now transform to the output dimensions
-      m_transform->apply(inCenter, outCenter);
-      // std::cout << "Input coord " << VMD(nd,inCenter) << " transformed to "
-      // <<  VMD(nd,outCenter) << '\n';
+bool BinMD::boxInSingleBin(API::IMDNode *box, const size_t *const chunkMin,
+                           const size_t *const chunkMax,
+                           size_t &linearIndex) const {
+  linearIndex = 0;
+  if (m_alignedTransform) {
+    // The box is within a single bin if its lower and upper corners are. This
+    // costs no more than a single event, so it is checked for every box.
+    const size_t *dimensionToBinFrom =
+        m_alignedTransform->getDimensionToBinFrom();
+    const coord_t *origin = m_alignedTransform->getOrigin();
+    const coord_t *scaling = m_alignedTransform->getScaling();
+    for (size_t bd = 0; bd < m_outD; bd++) {
+      const auto &extents = box->getExtents(dimensionToBinFrom[bd]);
+      const coord_t xMin = (extents.getMin() - origin[bd]) * scaling[bd];
+      const coord_t xMax = (extents.getMax() - origin[bd]) * scaling[bd];
+      // Check the range before converting to an index
+      if (!(xMin >= coord_t(chunkMin[bd]) && xMin < coord_t(chunkMax[bd])))
+        return false;
+      const auto ix = static_cast<size_t>(static_cast<int64_t>(xMin));
+      if (!(xMax < coord_t(ix + 1)))
+        return false;
+      linearIndex += indexMultiplier[bd] * ix;
+    }
+    return true;
+  }
 
-      // To build up the linear index
-      size_t linearIndex = 0;
-      // To mark VERTEXES outside range
-      badOne = false;
+  // There is a check that the number of events is enough for it to make sense
+  // to do all this processing.
+  if (box->getNPoints() <= (size_t(1) << box->getNumDims()) * 2)
+    return false;
 
-      /// Loop through the dimensions on which we bin
-      for (size_t bd = 0; bd < m_outD; bd++) {
-        // What is the bin index in that dimension
-        coord_t x = outCenter[bd];
-        size_t ix = size_t(x);
-        // Within range (for this chunk)?
-        if ((x >= 0) && (ix >= chunkMin[bd]) && (ix < chunkMax[bd])) {
-          // Build up the linear index
-          linearIndex += indexMultiplier[bd] * ix;
-        } else {
-          // Outside the range
-          badOne = true;
-          break;
-        }
-      } // (for each dim in MDHisto)
+  size_t numVertexes = 0;
+  std::unique_ptr<coord_t[]> vertexes(box->getVertexesArray(numVertexes));
+  // An array to hold the rotated/transformed coordinates
+  std::vector<coord_t> outCenter(m_outD);
 
-      // Is the vertex at the same place as the last one?
-      if (!badOne) {
-        if ((i > 0) && (linearIndex != lastLinearIndex)) {
-          // Change of index
-          badOne = true;
-          break;
-        }
-        lastLinearIndex = linearIndex;
-      }
+  // All vertexes have to be within THE SAME BIN = have the same linear index.
+  const size_t nd = box->getNumDims();
+  for (size_t i = 0; i < numVertexes; i++) {
+    // Now transform to the output dimensions
+    m_transform->apply(vertexes.get() + i * nd, outCenter.data());
 
-      // Was the vertex completely outside the range?
-      if (badOne)
-        break;
-    } // (for each vertex)
+    // To build up the linear index
+    size_t vertexIndex = 0;
+    /// Loop through the dimensions on which we bin
+    for (size_t bd = 0; bd < m_outD; bd++) {
+      // Within range (for this chunk)?
+      const coord_t x = outCenter[bd];
+      if (!(x >= coord_t(chunkMin[bd]) && x < coord_t(chunkMax[bd])))
+        return false;
+      // What is the bin index in that dimension
+      vertexIndex +=
+          indexMultiplier[bd] * static_cast<size_t>(static_cast<int64_t>(x));
+    }
 
-    delete[] vertexes;
+    // Is the vertex at the same place as the last one?
+    if (i > 0 && vertexIndex != linearIndex)
+      return false;
+    linearIndex = vertexIndex;
+  }
+  return true;
+}
 
-    if (!badOne) {
-      // Yes, the entire box is within a single bin
-      //        std::cout << "Box at " << box->getExtentsStr() << " is within a
-      //        single bin.\n";
-      // Add the CACHED signal from the entire box
-      signals[lastLinearIndex] += box->getSignal();
-      errors[lastLinearIndex] += box->getErrorSquared();
-      // TODO: If DataObjects get a weight, this would need to get the summed
-      // weight.
-      numEvents[lastLinearIndex] += static_cast<signal_t>(box->getNPoints());
+//----------------------------------------------------------------------------------------------
+/** Bin the contents of a MDBox
+ *
+ * @param box :: pointer to the MDBox to bin
+ * @param chunkMin :: the minimum index in each dimension to consider "valid"
+ *(inclusive)
+ * @param chunkMax :: the maximum index in each dimension to consider "valid"
+ *(exclusive)
+ * @param inSingleBin :: whether the entire box is in the same bin, as found
+ *by boxInSingleBin
+ * @param boxIndex :: the linear index of that bin
+ */
+template <typename MDE, size_t nd>
+inline void BinMD::binMDBox(MDBox<MDE, nd> *box, const size_t *const chunkMin,
+                            const size_t *const chunkMax,
+                            const bool inSingleBin, const size_t boxIndex) {
+  if (inSingleBin) {
+    // Add the CACHED signal from the entire box
+    signals[boxIndex] += box->getSignal();
+    errors[boxIndex] += box->getErrorSquared();
+    // TODO: If DataObjects get a weight, this would need to get the summed
+    // weight.
+    numEvents[boxIndex] += static_cast<signal_t>(box->getNPoints());
+    // And don't bother looking at each event. This may save lots of time
+    // loading from disk.
+    return;
+  }
 
-      // And don't bother looking at each event. This may save lots of time
-      // loading from disk.
-      delete[] outCenter;
-      return;
-    }
+  if (m_alignedTransform) {
+    this->binMDBoxAligned(box, chunkMin, chunkMax);
+    return;
   }
 
-  // If you get here, you could not determine that the entire box was in the
-  // same bin.
-  // So you need to iterate through events.
+  // An array to hold the rotated/transformed coordinates
+  auto outCenter = new coord_t[m_outD];
+
+  // The box is not within a single bin, so you need to iterate through
+  // events.
   const std::vector<MDE> &events = box->getConstEvents();
   for (auto it = events.begin(); it != events.end(); ++it) {
     // Cache the center of the event (again for speed)
@@ -218,6 +239,69 @@ inline void BinMD::binMDBox(MDBox<MDE, nd> *box, const size_t *const chunkMin,
   delete[] outCenter;
 }
 
+//----------------------------------------------------------------------------------------------
+/** Bin the events of a MDBox when the transform to the output is
+ * axis-aligned. Each output dimension is then a shifted and scaled input
+ * dimension, so the bin of an event needs no general transform.
+ *
+ * @param box :: pointer to the MDBox to bin
+ * @param chunkMin :: the minimum index in each dimension to consider "valid"
+ *(inclusive)
+ * @param chunkMax :: the maximum index in each dimension to consider "valid"
+ *(exclusive)
+ */
+template <typename MDE, size_t nd>
+void BinMD::binMDBoxAligned(MDBox<MDE, nd> *box, const size_t *const chunkMin,
+                            const size_t *const chunkMax) {
+  const size_t *dimensionToBinFrom =
+      m_alignedTransform->getDimensionToBinFrom();
+  const coord_t *origin = m_alignedTransform->getOrigin();
+  const coord_t *scaling = m_alignedTransform->getScaling();
+
+  // The bins of the events are found a block at a time, one dimension after
+  // the other.
+  const size_t blockSize = 256;
+  size_t linearIndex[blockSize];
+  bool inside[blockSize];
+
+  const std::vector<MDE> &events = box->getConstEvents();
+  for (size_t start = 0; start < events.size(); start += blockSize) {
+    const size_t count = std::min(blockSize, events.size() - start);
+    const MDE *block = events.data() + start;
+    std::fill_n(linearIndex, count, size_t(0));
+    std::fill_n(inside, count, true);
+
+    for (size_t bd = 0; bd < m_outD; bd++) {
+      const size_t d = dimensionToBinFrom[bd];
+      const coord_t offset = origin[bd];
+      const coord_t scale = scaling[bd];
+      const coord_t min = coord_t(chunkMin[bd]);
+      const coord_t max = coord_t(chunkMax[bd]);
+      const size_t multiplier = indexMultiplier[bd];
+      for (size_t i = 0; i < count; i++) {
+        const coord_t x = (block[i].getCenter(d) - offset) * scale;
+        // Only coordinates within the chunk (not NaN) are converted
+        const bool within = x >= min && x < max;
+        inside[i] = inside[i] && within;
+        const auto ix = static_cast<int64_t>(within ? x : 0);
+        linearIndex[i] += multiplier * static_cast<size_t>(ix);
+      }
+    }
+
+    for (size_t i = 0; i < count; i++) {
+      if (inside[i]) {
+        // Sum the signals as doubles to preserve precision
+        signals[linearIndex[i]] += static_cast<signal_t>(block[i].getSignal());
+        errors[linearIndex[i]] +=
+            static_cast<signal_t>(block[i].getErrorSquared());
+        numEvents[linearIndex[i]] += 1.0;
+      }
+    }
+  }
+  // Done with the events list
+  box->releaseEvents();
+}
+
 //----------------------------------------------------------------------------------------------
 /** Perform binning by iterating through every event and placing them in the
  *output workspace
@@ -244,6 +328,8 @@ void BinMD::binByIterating(typename MDEventWorkspace<MDE, nd>::sptr ws) {
   signals = outWS->getSignalArray();
   errors = outWS->getErrorSquaredArray();
   numEvents = outWS->getNumEventsArray();
+  // Axis-aligned binning finds the bins without the general transform
+  m_alignedTransform = dynamic_cast<const CoordTransformAligned *>(m_transform);
 
   // Start with signal/error/numEvents at 0.0
   outWS->setTo(0.0, 0.0, 0.0);
@@ -268,6 +354,9 @@ void BinMD::binByIterating(typename MDEventWorkspace<MDE, nd>::sptr ws) {
   if (!doParallel)
     chunkNumBins = int(m_binDimensions[chunkDimension]->getNBins());
 
+  // Flat copy of the box structure, searched once for each chunk
+  const MDBoxMortonTree boxTree(ws->getBox());
+
   // Total number of steps
   size_t progNumSteps = 0;
   if (prog)
@@ -304,10 +393,9 @@ void BinMD::binByIterating(typename MDEventWorkspace<MDE, nd>::sptr ws) {
       MDImplicitFunction *function =
           this->getImplicitFunctionForChunk(chunkMin.data(), chunkMax.data());
 
-      // Use getBoxes() to get an array with a pointer to each box
+      // Leaf boxes touching the implicit function, in Morton order
       std::vector<API::IMDNode *> boxes;
-      // Leaf-only; no depth limit; with the implicit function passed to it.
-      ws->getBox()->getBoxes(boxes, 1000, true, function);
+      boxTree.getBoxes(boxes, *function);
 
       // Sort boxes by file position IF file backed. This reduces seeking time,
       // hopefully.
@@ -324,12 +412,34 @@ void BinMD::binByIterating(typename MDEventWorkspace<MDE, nd>::sptr ws) {
         }
       }
 
+      // Find the boxes within a single bin, and the linear index of that bin,
+      // before the prefetch starts adding events to the other boxes
+      std::vector<std::pair<bool, size_t>> singleBins(boxes.size());
+      for (size_t i = 0; i < boxes.size(); ++i) {
+        if (!boxes[i]->getIsMasked())
+          singleBins[i].first = boxInSingleBin(
+              boxes[i], chunkMin.data(), chunkMax.data(), singleBins[i].second);
+      }
+
+      // Load the boxes from the file in the background, ahead of binning them.
+      // Boxes within a single bin are binned without reading their events.
+      if (bc->isFileBacked()) {
+        std::vector<Kernel::ISaveable *> toLoad;
+        toLoad.reserve(boxes.size());
+        for (size_t i = 0; i < boxes.size(); ++i) {
+          if (!boxes[i]->getIsMasked() && !singleBins[i].first)
+            toLoad.push_back(boxes[i]->getISaveable());
+        }
+        bc->getFileIO()->prefetch(toLoad);
+      }
+
       // Go through every box for this chunk.
-      for (auto &boxe : boxes) {
-        MDBox<MDE, nd> *box = dynamic_cast<MDBox<MDE, nd> *>(boxe);
+      for (size_t i = 0; i < boxes.size(); ++i) {
+        MDBox<MDE, nd> *box = dynamic_cast<MDBox<MDE, nd> *>(boxes[i]);
         // Perform the binning in this separate method.
         if (box && !box->getIsMasked())
-          this->binMDBox(box, chunkMin.data(), chunkMax.data());
+          this->binMDBox(box, chunkMin.data(), chunkMax.data(),
+                         singleBins[i].first, singleBins[i].second);
 
         // Progress reporting
         if (prog)
@@ -338,10 +448,20 @@ void BinMD::binByIterating(typename MDEventWorkspace<MDE, nd>::sptr ws) {
         if (this->m_cancel)
           break;
       } // for each box in the vector
+      if (bc->isFileBacked())
+        bc->getFileIO()->cancelPrefetch();
       PARALLEL_END_INTERUPT_REGION
     } // for each chunk in parallel
     PARALLEL_CHECK_INTERUPT_REGION
 
+    if (bc->isFileBacked()) {
+      const auto statistics = bc->getFileIO()->getStatistics();
+      g_log.debug() << "Boxes loaded from file: " << statistics.numPrefetched
+                    << " prefetched (" << statistics.numHits << " used), "
+                    << statistics.numMisses << " not prefetched. Data read: "
+                    << statistics.dataRead << " events.\n";
+    }
+
     // Now the implicit function
     if (implicitFunction) {
       if (prog)
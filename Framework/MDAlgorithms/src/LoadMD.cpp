@@ -90,7 +90,9 @@ void LoadMD::init() {
       "currently equivalent to MetadataOnly");
 
   declareProperty(make_unique<PropertyWithValue<bool>>("FileBackEnd", false),
-                  "Set to true to load the data only on demand.");
+                  "Set to true to load the data only on demand.\n"
+                  "Boxes that change are written back to the end of a file "
+                  "saved with CompressEvents, which makes it grow.");
   setPropertySettings("FileBackEnd", make_unique<EnabledWhenProperty>(
                                          "MetadataOnly", IS_EQUAL_TO, "0"));
 
@@ -57,6 +57,14 @@ void MergeMDFiles::init() {
                   "Run the loading tasks in parallel.\n"
                   "This can be faster but might use more memory.");
 
+  declareProperty("CompressEvents", false,
+                  "Compress the events in the output file. The file is "
+                  "smaller, at the cost of compressing the events.\n"
+                  "The output workspace is then merged in memory and written "
+                  "to the file once, since boxes written back to a "
+                  "compressed file take new space in it.\n"
+                  "Ignored if no OutputFilename is given.");
+
   declareProperty(make_unique<WorkspaceProperty<IMDEventWorkspace>>(
                       "OutputWorkspace", "", Direction::Output),
                   "An output MDEventWorkspace.");
@@ -311,7 +319,15 @@ void MergeMDFiles::finalizeOutput(const std::string &outputFile) {
 
   g_log.information() << overallTime << " to run refreshCache().\n";
 
-  if (!outputFile.empty()) {
+  if (!outputFile.empty() && !m_fileBasedTargetWS) {
+    // CompressEvents: the workspace was merged in memory
+    g_log.notice() << "Starting SaveMD to write the compressed file.\n";
+    IAlgorithm_sptr saver = createChildAlgorithm("SaveMD", 0.9, 1.0, true, 1);
+    saver->setProperty<IMDWorkspace_sptr>("InputWorkspace", m_OutIWS);
+    saver->setPropertyValue("Filename", outputFile);
+    saver->setProperty("CompressEvents", true);
+    saver->executeAsChildAlg();
+  } else if (!outputFile.empty()) {
     g_log.notice() << "Starting SaveMD to update the file back-end.\n";
     // create or open WS group and put there additional information about WS and
     // its dimensions
@@ -361,9 +377,10 @@ void MergeMDFiles::exec() {
   std::string firstFile = m_Filenames[0];
 
   std::string outputFile = getProperty("OutputFilename");
+  const bool compressEvents = getProperty("CompressEvents");
   m_fileBasedTargetWS = false;
   if (!outputFile.empty()) {
-    m_fileBasedTargetWS = true;
+    m_fileBasedTargetWS = !compressEvents;
     if (Poco::File(outputFile).exists())
       throw std::invalid_argument(
           " File " + outputFile + " already exists. Can not use existing file "
@@ -74,6 +74,18 @@ void SaveMD::init() {
   setPropertySettings(
       "MakeFileBacked",
       make_unique<EnabledWhenProperty>("UpdateFileBackEnd", IS_EQUAL_TO, "0"));
+
+  declareProperty("CompressEvents", false,
+                  "Compress the events in the file. The file is smaller and "
+                  "file-backed workspaces read fewer bytes from it, at the "
+                  "cost of compressing and decompressing the events.\n"
+                  "Only used if the workspace is not file-backed, and not "
+                  "with MakeFileBacked: boxes written again to a compressed "
+                  "file take new space in it instead of reusing their old "
+                  "space.");
+  setPropertySettings(
+      "CompressEvents",
+      make_unique<EnabledWhenProperty>("UpdateFileBackEnd", IS_EQUAL_TO, "0"));
 }
 
 //----------------------------------------------------------------------------------------------
@@ -157,8 +169,10 @@ void SaveMD::doSaveEvents(typename MDEventWorkspace<MDE, nd>::sptr ws) {
     // the boxes file positions are unknown and we need to calculate it.
     BoxFlatStruct.initFlatStructure(ws, filename);
     // create saver class
-    auto Saver = boost::shared_ptr<API::IBoxControllerIO>(
-        new DataObjects::BoxControllerNeXusIO(bc.get()));
+    auto nexusSaver = new DataObjects::BoxControllerNeXusIO(bc.get());
+    const bool compressEvents = getProperty("CompressEvents");
+    nexusSaver->setCompressEvents(compressEvents);
+    auto Saver = boost::shared_ptr<API::IBoxControllerIO>(nexusSaver);
     Saver->setDataType(sizeof(coord_t), MDE::getTypeName());
     if (makeFileBackend) {
       // store saver with box controller
@@ -313,6 +327,21 @@ void SaveMD::doSaveHisto(Mantid::DataObjects::MDHistoWorkspace_sptr ws) {
   file->close();
 }
 
+//----------------------------------------------------------------------------------------------
+/** Validate the inputs. A file-backed workspace writes its boxes back to the
+ * file whenever they change, which a compressed file does in new space.
+ * @return map of property names to error messages
+ */
+std::map<std::string, std::string> SaveMD::validateInputs() {
+  std::map<std::string, std::string> errors;
+  const bool compressEvents = getProperty("CompressEvents");
+  const bool makeFileBacked = getProperty("MakeFileBacked");
+  if (compressEvents && makeFileBacked)
+    errors["CompressEvents"] =
+        "Compressed events cannot be used with MakeFileBacked.";
+  return errors;
+}
+
 //----------------------------------------------------------------------------------------------
 /** Execute the algorithm.
  */
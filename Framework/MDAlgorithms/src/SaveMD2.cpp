@@ -62,6 +62,18 @@ void SaveMD2::init() {
   setPropertySettings(
       "MakeFileBacked",
       make_unique<EnabledWhenProperty>("UpdateFileBackEnd", IS_EQUAL_TO, "0"));
+
+  declareProperty("CompressEvents", false,
+                  "Compress the events in the file. The file is smaller and "
+                  "file-backed workspaces read fewer bytes from it, at the "
+                  "cost of compressing and decompressing the events.\n"
+                  "Only used if the workspace is not file-backed, and not "
+                  "with MakeFileBacked: boxes written again to a compressed "
+                  "file take new space in it instead of reusing their old "
+                  "space.");
+  setPropertySettings(
+      "CompressEvents",
+      make_unique<EnabledWhenProperty>("UpdateFileBackEnd", IS_EQUAL_TO, "0"));
 }
 
 //----------------------------------------------------------------------------------------------
@@ -188,6 +200,21 @@ void SaveMD2::doSaveHisto(Mantid::DataObjects::MDHistoWorkspace_sptr ws) {
   file->close();
 }
 
+//----------------------------------------------------------------------------------------------
+/** Validate the inputs. A file-backed workspace writes its boxes back to the
+ * file whenever they change, which a compressed file does in new space.
+ * @return map of property names to error messages
+ */
+std::map<std::string, std::string> SaveMD2::validateInputs() {
+  std::map<std::string, std::string> errors;
+  const bool compressEvents = getProperty("CompressEvents");
+  const bool makeFileBacked = getProperty("MakeFileBacked");
+  if (compressEvents && makeFileBacked)
+    errors["CompressEvents"] =
+        "Compressed events cannot be used with MakeFileBacked.";
+  return errors;
+}
+
 //----------------------------------------------------------------------------------------------
 /** Execute the algorithm.
  */
@@ -207,6 +234,8 @@ void SaveMD2::exec() {
                                 getProperty("UpdateFileBackEnd"));
     saveMDv1->setProperty<bool>("MakeFileBacked",
                                 getProperty("MakeFileBacked"));
+    saveMDv1->setProperty<bool>("CompressEvents",
+                                getProperty("CompressEvents"));
     saveMDv1->execute();
   } else if (histoWS) {
     this->doSaveHisto(histoWS);
@@ -858,6 +858,33 @@ public:
     do_compare_histo("binned0", "binned2", "mdew");
   }
 
+  //---------------------------------------------------------------------------------------------
+  /** Axis-aligned binning of a MDEW gives the same result as the general
+   * transform, with bins that do not line up with the boxes */
+  void test_exec_Aligned_matches_nonAligned_with_uneven_bins() {
+    do_prepare_comparison();
+
+    FrameworkManager::Instance().exec(
+        "BinMD", 10, "InputWorkspace", "mdew", "OutputWorkspace", "binned0",
+        "AxisAligned", "1", "AlignedDim0", "x, -10, 10, 7", "AlignedDim1",
+        "y, -10, 10, 9");
+
+    FrameworkManager::Instance().exec(
+        "BinMD", 18, "InputWorkspace", "mdew", "OutputWorkspace", "binned1",
+        "AxisAligned", "0", "BasisVector0", "rx,m, 1.0, 0.0", "BasisVector1",
+        "ry,m, 0.0, 1.0", "ForceOrthogonal", "1", "Translation", "-10, -10",
+        "OutputExtents", "0,20, 0,20", "OutputBins", "7,9");
+
+    MDHistoWorkspace_sptr binned0 =
+        AnalysisDataService::Instance().retrieveWS<MDHistoWorkspace>(
+            "binned0");
+    MDHistoWorkspace_sptr binned1 =
+        do_compare_histo("binned0", "binned1", "mdew");
+    TS_ASSERT_EQUALS(binned0->getNPoints(), 7 * 9);
+    for (size_t i = 0; i < binned0->getNPoints(); i++)
+      TS_ASSERT_EQUALS(binned0->getNumEventsAt(i), binned1->getNumEventsAt(i));
+  }
+
   //---------------------------------------------------------------------------------------------
   /** Can't do Axis-Aligned on a MDHisto because the transformation gets too
    * annoying. */
@@ -26,7 +26,11 @@ public:
 
   void test_exec_fileBacked() { do_test_exec("MergeMDFilesTest_OutputWS.nxs"); }
 
-  void do_test_exec(std::string OutputFilename) {
+  void test_exec_CompressEvents_keeps_the_output_in_memory() {
+    do_test_exec("MergeMDFilesTest_OutputWS.nxs", true);
+  }
+
+  void do_test_exec(std::string OutputFilename, bool compressEvents = false) {
     if (OutputFilename != "") {
       if (Poco::File(OutputFilename).exists())
         Poco::File(OutputFilename).remove();
@@ -60,6 +64,7 @@ public:
     TS_ASSERT_THROWS_NOTHING(alg.setProperty("Filenames", filenames));
     TS_ASSERT_THROWS_NOTHING(
         alg.setPropertyValue("OutputFilename", OutputFilename));
+    TS_ASSERT_THROWS_NOTHING(alg.setProperty("CompressEvents", compressEvents));
     TS_ASSERT_THROWS_NOTHING(
         alg.setPropertyValue("OutputWorkspace", outWSName));
 
@@ -94,9 +99,10 @@ public:
       TS_ASSERT_LESS_THAN(1, box->getChild(i)->getNPoints());
 
     if (!OutputFilename.empty()) {
-      TS_ASSERT(ws->isFileBacked());
+      TS_ASSERT_EQUALS(ws->isFileBacked(), !compressEvents);
       TS_ASSERT(Poco::File(actualOutputFilename).exists());
-      ws->clearFileBacked(false);
+      if (ws->isFileBacked())
+        ws->clearFileBacked(false);
       Poco::File(actualOutputFilename).remove();
     }
 
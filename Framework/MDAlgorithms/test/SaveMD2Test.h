@@ -40,6 +40,86 @@ public:
     do_test_exec(23, "SaveMD2Test_updating.nxs", true, true);
   }
 
+  void test_CompressEvents_with_MakeFileBacked_is_rejected() {
+    SaveMD2 alg;
+    TS_ASSERT_THROWS_NOTHING(alg.initialize())
+    TS_ASSERT_THROWS_NOTHING(alg.setProperty("MakeFileBacked", true));
+    TS_ASSERT_THROWS_NOTHING(alg.setProperty("CompressEvents", true));
+    TS_ASSERT_EQUALS(alg.validateInputs().count("CompressEvents"), 1);
+  }
+
+  void test_CompressEvents_loads_back_the_same_events() {
+    MDEventWorkspace1Lean::sptr ws =
+        MDEventsTestHelper::makeMDEW<1>(10, 0.0, 10.0, 23);
+    ws->splitBox();
+    ws->refreshCache();
+    AnalysisDataService::Instance().addOrReplace("SaveMD2Test_ws", ws);
+
+    SaveMD2 saveAlg;
+    TS_ASSERT_THROWS_NOTHING(saveAlg.initialize())
+    TS_ASSERT_THROWS_NOTHING(
+        saveAlg.setPropertyValue("InputWorkspace", "SaveMD2Test_ws"));
+    TS_ASSERT_THROWS_NOTHING(
+        saveAlg.setPropertyValue("Filename", "SaveMD2Test_compressed.nxs"));
+    TS_ASSERT_THROWS_NOTHING(saveAlg.setProperty("CompressEvents", true));
+    saveAlg.execute();
+    TS_ASSERT(saveAlg.isExecuted());
+    const std::string this_filename = saveAlg.getProperty("Filename");
+
+    // Read the events back, both into memory and from the file back-end
+    for (const bool fileBackEnd : {false, true}) {
+      LoadMD loadAlg;
+      TS_ASSERT_THROWS_NOTHING(loadAlg.initialize())
+      TS_ASSERT_THROWS_NOTHING(
+          loadAlg.setPropertyValue("Filename", this_filename));
+      TS_ASSERT_THROWS_NOTHING(loadAlg.setProperty("FileBackEnd", fileBackEnd));
+      TS_ASSERT_THROWS_NOTHING(
+          loadAlg.setPropertyValue("OutputWorkspace", "SaveMD2Test_loaded"));
+      TS_ASSERT_THROWS_NOTHING(loadAlg.execute());
+      TS_ASSERT(loadAlg.isExecuted());
+      auto loaded =
+          AnalysisDataService::Instance().retrieveWS<MDEventWorkspace1Lean>(
+              "SaveMD2Test_loaded");
+      TS_ASSERT(loaded);
+      if (!loaded)
+        return;
+      TS_ASSERT_EQUALS(loaded->getNPoints(), 230);
+
+      std::vector<IMDNode *> savedBoxes;
+      std::vector<IMDNode *> loadedBoxes;
+      ws->getBox()->getBoxes(savedBoxes, 1000, true);
+      loaded->getBox()->getBoxes(loadedBoxes, 1000, true);
+      TS_ASSERT_EQUALS(savedBoxes.size(), loadedBoxes.size());
+      for (size_t i = 0; i < std::min(savedBoxes.size(), loadedBoxes.size());
+           ++i) {
+        auto savedBox = dynamic_cast<MDBox<MDLeanEvent<1>, 1> *>(savedBoxes[i]);
+        auto loadedBox =
+            dynamic_cast<MDBox<MDLeanEvent<1>, 1> *>(loadedBoxes[i]);
+        TS_ASSERT(savedBox && loadedBox);
+        if (!savedBox || !loadedBox)
+          continue;
+        const auto &savedEvents = savedBox->getConstEvents();
+        const auto &loadedEvents = loadedBox->getConstEvents();
+        TS_ASSERT_EQUALS(savedEvents.size(), loadedEvents.size());
+        for (size_t j = 0;
+             j < std::min(savedEvents.size(), loadedEvents.size()); ++j) {
+          TS_ASSERT_EQUALS(savedEvents[j].getCenter(0),
+                           loadedEvents[j].getCenter(0));
+          TS_ASSERT_EQUALS(savedEvents[j].getSignal(),
+                           loadedEvents[j].getSignal());
+        }
+        savedBox->releaseEvents();
+        loadedBox->releaseEvents();
+      }
+      if (fileBackEnd)
+        loaded->clearFileBacked(false);
+      AnalysisDataService::Instance().remove("SaveMD2Test_loaded");
+    }
+    AnalysisDataService::Instance().remove("SaveMD2Test_ws");
+    if (Poco::File(this_filename).exists())
+      Poco::File(this_filename).remove();
+  }
+
   void do_test_exec(size_t numPerBox, std::string filename,
                     bool MakeFileBacked = false,
                     bool UpdateFileBackEnd = false) {
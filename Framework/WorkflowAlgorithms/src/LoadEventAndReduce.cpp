@@ -0,0 +1,257 @@
+#include "MantidWorkflowAlgorithms/LoadEventAndReduce.h"
+#include "MantidAPI/AlgorithmFactory.h"
+#include "MantidAPI/AlgorithmManager.h"
+#include "MantidAPI/ExperimentInfo.h"
+#include "MantidAPI/FileProperty.h"
+#include "MantidAPI/ITableWorkspace.h"
+#include "MantidAPI/MatrixWorkspace.h"
+#include "MantidAPI/Run.h"
+
+#include <json/json.h>
+
+namespace Mantid {
+namespace WorkflowAlgorithms {
+
+using std::size_t;
+using std::string;
+using namespace Kernel;
+using namespace API;
+
+// Register the algorithm into the AlgorithmFactory
+DECLARE_ALGORITHM(LoadEventAndReduce)
+
+namespace {
+/** Parse the list of steps run on each chunk
+ * @param text :: a JSON array of algorithms, or an empty string for none
+ * @param steps :: set to the array
+ * @return a description of the first problem found, or an empty string
+ */
+string parseSteps(const string &text, Json::Value &steps) {
+  steps = Json::Value(Json::arrayValue);
+  if (text.find_first_not_of(" \t\r\n") == string::npos)
+    return "";
+  Json::Reader reader;
+  if (!reader.parse(text, steps))
+    return "Not valid JSON: " + reader.getFormattedErrorMessages();
+  if (!steps.isArray())
+    return "Must be a JSON array of algorithms";
+
+  for (const auto &step : steps) {
+    if (!step.isObject() || !step["name"].isString())
+      return "Each step must be an object with a \"name\"";
+    const string name = step["name"].asString();
+    const int version = step.get("version", -1).asInt();
+    if (!AlgorithmFactory::Instance().exists(name, version))
+      return "Unknown algorithm " + name;
+    if (!step["properties"].isNull() && !step["properties"].isObject())
+      return "The \"properties\" of " + name + " must be an object";
+    auto alg = AlgorithmManager::Instance().createUnmanaged(name, version);
+    alg->initialize();
+    if (!alg->existsProperty("InputWorkspace") ||
+        !alg->existsProperty("OutputWorkspace"))
+      return name + " does not have InputWorkspace and OutputWorkspace "
+                    "properties";
+  }
+  return "";
+}
+}
+
+//----------------------------------------------------------------------------------------------
+
+/// Algorithms name for identification. @see Algorithm::name
+const string LoadEventAndReduce::name() const { return "LoadEventAndReduce"; }
+
+/// Algorithm's version for identification. @see Algorithm::version
+int LoadEventAndReduce::version() const { return 1; }
+
+/// Algorithm's category for identification. @see Algorithm::category
+const string LoadEventAndReduce::category() const {
+  return "Workflow\\DataHandling";
+}
+
+/// Algorithm's summary for use in the GUI and help. @see Algorithm::summary
+const string LoadEventAndReduce::summary() const {
+  return "Load an event file in chunks, reduce each chunk and sum the results";
+}
+
+//----------------------------------------------------------------------------------------------
+/** Initialize the algorithm's properties.
+ */
+void LoadEventAndReduce::init() {
+  // algorithms to copy properties from
+  auto algLoadEventNexus =
+      AlgorithmManager::Instance().createUnmanaged("LoadEventNexus");
+  algLoadEventNexus->initialize();
+  auto algDetermineChunking =
+      AlgorithmManager::Instance().createUnmanaged("DetermineChunking");
+  algDetermineChunking->initialize();
+
+  // declare properties
+  copyProperty(algLoadEventNexus, "Filename");
+  copyProperty(algLoadEventNexus, "OutputWorkspace");
+  copyProperty(algDetermineChunking, "MaxChunkSize");
+
+  declareProperty(
+      "ChunkSteps", "",
+      "The algorithms run on each chunk, in order, as a JSON array of objects "
+      "with a \"name\", an optional \"version\" and optional \"properties\", "
+      "e.g. [{\"name\": \"CompressEvents\", \"properties\": {\"Tolerance\": "
+      "0.01}}]. Each algorithm must have InputWorkspace and OutputWorkspace "
+      "properties, which are set to the chunk.");
+
+  copyProperty(algLoadEventNexus, "FilterByTofMin");
+  copyProperty(algLoadEventNexus, "FilterByTofMax");
+  copyProperty(algLoadEventNexus, "FilterByTimeStart");
+  copyProperty(algLoadEventNexus, "FilterByTimeStop");
+
+  std::string grp1 = "Filter Events";
+  setPropertyGroup("FilterByTofMin", grp1);
+  setPropertyGroup("FilterByTofMax", grp1);
+  setPropertyGroup("FilterByTimeStart", grp1);
+  setPropertyGroup("FilterByTimeStop", grp1);
+
+  copyProperty(algLoadEventNexus, "NXentryName");
+  copyProperty(algLoadEventNexus, "CompactEvents");
+}
+
+/// @copydoc Algorithm::validateInputs
+std::map<std::string, std::string> LoadEventAndReduce::validateInputs() {
+  std::map<std::string, std::string> errors;
+  Json::Value steps;
+  const string error = parseSteps(getPropertyValue("ChunkSteps"), steps);
+  if (!error.empty())
+    errors["ChunkSteps"] = error;
+  return errors;
+}
+
+/// @see DataProcessorAlgorithm::determineChunk(const std::string &)
+ITableWorkspace_sptr
+LoadEventAndReduce::determineChunk(const std::string &filename) {
+  double maxChunkSize = getProperty("MaxChunkSize");
+
+  auto alg = createChildAlgorithm("DetermineChunking");
+  alg->setProperty("Filename", filename);
+  alg->setProperty("MaxChunkSize", maxChunkSize);
+  alg->executeAsChildAlg();
+  ITableWorkspace_sptr chunkingTable = alg->getProperty("OutputWorkspace");
+
+  if (chunkingTable->rowCount() > 1)
+    g_log.information() << "Will load data in " << chunkingTable->rowCount()
+                        << " chunks\n";
+  else
+    g_log.information("Not chunking");
+
+  return chunkingTable;
+}
+
+/** Load a chunk. Only the first chunk reads the sample logs.
+ * @see DataProcessorAlgorithm::loadChunk(const size_t)
+ */
+MatrixWorkspace_sptr LoadEventAndReduce::loadChunk(const size_t rowIndex) {
+  g_log.debug() << "loadChunk(" << rowIndex << ")\n";
+
+  const double rowCount = static_cast<double>(m_chunkingTable->rowCount());
+  const double numChunks = std::max(rowCount, 1.);
+  const double progStart = static_cast<double>(rowIndex) / numChunks;
+  const double progStop = (static_cast<double>(rowIndex) + 0.5) / numChunks;
+
+  auto alg = createChildAlgorithm("LoadEventNexus", progStart, progStop, true);
+  alg->setProperty<string>("Filename", getProperty("Filename"));
+  alg->setProperty<double>("FilterByTofMin", getProperty("FilterByTofMin"));
+  alg->setProperty<double>("FilterByTofMax", getProperty("FilterByTofMax"));
+  alg->setProperty<double>("FilterByTimeStart",
+                           getProperty("FilterByTimeStart"));
+  alg->setProperty<double>("FilterByTimeStop", getProperty("FilterByTimeStop"));
+  alg->setProperty<string>("NXentryName", getProperty("NXentryName"));
+  alg->setProperty<bool>("CompactEvents", getProperty("CompactEvents"));
+  alg->setProperty<bool>("LoadLogs", rowIndex == 0);
+
+  // set chunking information
+  if (rowCount > 0.) {
+    const std::vector<string> COL_NAMES = m_chunkingTable->getColumnNames();
+    for (const auto &name : COL_NAMES) {
+      alg->setProperty(name, m_chunkingTable->getRef<int>(name, rowIndex));
+    }
+  }
+
+  alg->executeAsChildAlg();
+  Workspace_sptr wksp = alg->getProperty("OutputWorkspace");
+  return boost::dynamic_pointer_cast<MatrixWorkspace>(wksp);
+}
+
+/**
+ * Run the steps on a chunk
+ *
+ * @param wksp :: the chunk
+ * @param steps :: the algorithms to run, as checked by validateInputs()
+ * @return the reduced chunk
+ */
+MatrixWorkspace_sptr
+LoadEventAndReduce::processChunk(MatrixWorkspace_sptr wksp,
+                                 const Json::Value &steps) {
+  for (const auto &step : steps) {
+    const string name = step["name"].asString();
+    auto alg = createChildAlgorithm(name, -1., -1., true,
+                                    step.get("version", -1).asInt());
+    if (step["properties"].isObject())
+      alg->setProperties(step["properties"],
+                         {"InputWorkspace", "OutputWorkspace"});
+    Workspace_sptr input = wksp;
+    alg->setProperty("InputWorkspace", input);
+    alg->setProperty("OutputWorkspace", input);
+    alg->executeAsChildAlg();
+    Workspace_sptr output = alg->getProperty("OutputWorkspace");
+    wksp = boost::dynamic_pointer_cast<MatrixWorkspace>(output);
+    if (!wksp)
+      throw std::runtime_error(name + " did not give a MatrixWorkspace");
+  }
+  return wksp;
+}
+
+//----------------------------------------------------------------------------------------------
+/** Execute the algorithm.
+ */
+void LoadEventAndReduce::exec() {
+  const std::string filename = getPropertyValue("Filename");
+  Json::Value steps;
+  parseSteps(getPropertyValue("ChunkSteps"), steps);
+
+  m_chunkingTable = determineChunk(filename);
+  const size_t numChunks = std::max(m_chunkingTable->rowCount(), size_t(1));
+  Progress progress(this, 0, 1, numChunks);
+
+  // The logs, instrument and sample of the first chunk, given to the others
+  boost::shared_ptr<ExperimentInfo> experiment;
+  // The logs cover the whole run so are not summed
+  Run run;
+  MatrixWorkspace_sptr resultWS;
+  for (size_t i = 0; i < numChunks; ++i) {
+    MatrixWorkspace_sptr chunk = loadChunk(i);
+    if (experiment)
+      chunk->copyExperimentInfoFrom(experiment.get());
+    else
+      experiment.reset(chunk->cloneExperimentInfo());
+    chunk = processChunk(chunk, steps);
+
+    if (!resultWS) {
+      resultWS = chunk;
+      run = resultWS->run();
+    } else {
+      auto plusAlg = createChildAlgorithm("Plus");
+      plusAlg->setProperty("LHSWorkspace", resultWS);
+      plusAlg->setProperty("RHSWorkspace", chunk);
+      plusAlg->setProperty("OutputWorkspace", resultWS);
+      plusAlg->setProperty("ClearRHSWorkspace", true);
+      plusAlg->executeAsChildAlg();
+      resultWS = plusAlg->getProperty("OutputWorkspace");
+    }
+    progress.report();
+  }
+  if (numChunks > 1)
+    resultWS->mutableRun() = run;
+
+  setProperty("OutputWorkspace", assemble(resultWS));
+}
+
+} // namespace WorkflowAlgorithms
+} // namespace Mantid
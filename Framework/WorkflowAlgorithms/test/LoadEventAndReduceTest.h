@@ -0,0 +1,121 @@
+#ifndef MANTID_WORKFLOWALGORITHMS_LOADEVENTANDREDUCETEST_H_
+#define MANTID_WORKFLOWALGORITHMS_LOADEVENTANDREDUCETEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidAPI/FrameworkManager.h"
+#include "MantidAPI/Run.h"
+#include "MantidDataObjects/EventWorkspace.h"
+#include "MantidWorkflowAlgorithms/LoadEventAndReduce.h"
+
+using Mantid::WorkflowAlgorithms::LoadEventAndReduce;
+using namespace Mantid::DataObjects;
+using namespace Mantid::API;
+
+class LoadEventAndReduceTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static LoadEventAndReduceTest *createSuite() {
+    return new LoadEventAndReduceTest();
+  }
+  static void destroySuite(LoadEventAndReduceTest *suite) { delete suite; }
+
+  void test_Init() {
+    LoadEventAndReduce alg;
+    TS_ASSERT_THROWS_NOTHING(alg.initialize());
+    TS_ASSERT(alg.isInitialized());
+  }
+
+  void test_invalid_steps_are_rejected() {
+    const std::vector<std::string> invalidSteps{
+        "[{\"name\": \"CompressEvents\"",   // not valid JSON
+        "{\"name\": \"CompressEvents\"}",   // not an array
+        "[{\"name\": \"NotAnAlgorithm\"}]", // unknown algorithm
+        "[{\"name\": \"CreateWorkspace\"}]" // no InputWorkspace
+    };
+    for (const auto &steps : invalidSteps) {
+      LoadEventAndReduce alg;
+      alg.initialize();
+      alg.setPropertyValue("Filename", FILENAME);
+      alg.setPropertyValue("OutputWorkspace", "LoadEventAndReduce_invalid");
+      alg.setPropertyValue("ChunkSteps", steps);
+      TS_ASSERT_THROWS(alg.execute(), std::runtime_error);
+      TS_ASSERT(!alg.isExecuted());
+    }
+  }
+
+  void test_exec() {
+    const std::string STEPS("[{\"name\": \"CompressEvents\", "
+                            "\"properties\": {\"Tolerance\": 0.01}}]");
+
+    // run without chunks
+    const std::string WS_NAME_NO_CHUNKS("LoadEventAndReduce_no_chunks");
+    LoadEventAndReduce algWithoutChunks;
+    TS_ASSERT_THROWS_NOTHING(algWithoutChunks.initialize());
+    TS_ASSERT_THROWS_NOTHING(
+        algWithoutChunks.setPropertyValue("Filename", FILENAME));
+    TS_ASSERT_THROWS_NOTHING(algWithoutChunks.setPropertyValue(
+        "OutputWorkspace", WS_NAME_NO_CHUNKS));
+    TS_ASSERT_THROWS_NOTHING(
+        algWithoutChunks.setPropertyValue("ChunkSteps", STEPS));
+    TS_ASSERT_THROWS_NOTHING(algWithoutChunks.execute(););
+    TS_ASSERT(algWithoutChunks.isExecuted());
+
+    EventWorkspace_sptr wsNoChunks;
+    TS_ASSERT_THROWS_NOTHING(
+        wsNoChunks = AnalysisDataService::Instance().retrieveWS<EventWorkspace>(
+            WS_NAME_NO_CHUNKS));
+    TS_ASSERT(wsNoChunks);
+    if (!wsNoChunks)
+      return;
+    TS_ASSERT_EQUALS(wsNoChunks->getEventType(), EventType::WEIGHTED_NOTIME);
+
+    // run with chunks
+    const std::string WS_NAME_CHUNKS("LoadEventAndReduce_chunks");
+    LoadEventAndReduce algWithChunks;
+    TS_ASSERT_THROWS_NOTHING(algWithChunks.initialize());
+    TS_ASSERT_THROWS_NOTHING(
+        algWithChunks.setPropertyValue("Filename", FILENAME));
+    TS_ASSERT_THROWS_NOTHING(
+        algWithChunks.setPropertyValue("OutputWorkspace", WS_NAME_CHUNKS));
+    TS_ASSERT_THROWS_NOTHING(
+        algWithChunks.setProperty("MaxChunkSize", .005)); // REALLY small file
+    TS_ASSERT_THROWS_NOTHING(
+        algWithChunks.setPropertyValue("ChunkSteps", STEPS));
+    TS_ASSERT_THROWS_NOTHING(algWithChunks.execute(););
+    TS_ASSERT(algWithChunks.isExecuted());
+
+    EventWorkspace_sptr wsWithChunks;
+    TS_ASSERT_THROWS_NOTHING(
+        wsWithChunks =
+            AnalysisDataService::Instance().retrieveWS<EventWorkspace>(
+                WS_NAME_CHUNKS));
+    TS_ASSERT(wsWithChunks);
+    if (!wsWithChunks)
+      return;
+
+    // the logs are those of the whole run, not the sum of the chunks
+    TS_ASSERT_EQUALS(wsWithChunks->run().getProtonCharge(),
+                     wsNoChunks->run().getProtonCharge());
+    TS_ASSERT_EQUALS(wsWithChunks->run().getProperties().size(),
+                     wsNoChunks->run().getProperties().size());
+
+    TS_ASSERT_EQUALS(wsWithChunks->getNumberEvents(),
+                     wsNoChunks->getNumberEvents());
+    auto checkAlg =
+        FrameworkManager::Instance().createAlgorithm("CheckWorkspacesMatch");
+    checkAlg->setPropertyValue("Workspace1", WS_NAME_NO_CHUNKS);
+    checkAlg->setPropertyValue("Workspace2", WS_NAME_CHUNKS);
+    checkAlg->execute();
+    TS_ASSERT_EQUALS(checkAlg->getPropertyValue("Result"), "Success!");
+
+    AnalysisDataService::Instance().remove(WS_NAME_NO_CHUNKS);
+    AnalysisDataService::Instance().remove(WS_NAME_CHUNKS);
+  }
+
+private:
+  const std::string FILENAME{"ARCS_sim_event.nxs"};
+};
+
+#endif /* MANTID_WORKFLOWALGORITHMS_LOADEVENTANDREDUCETEST_H_ */